@@ -22,23 +22,52 @@ For full examples, see:
   - dial-menu.yaml (complete)
   - dial-menu-simple.yaml (with packages)
 """
+import ast
+import hashlib
+import logging
 import math
+import re
+from pathlib import Path
+from esphome import external_files
 import esphome.codegen as cg
 import esphome.config_validation as cv
+import esphome.final_validate as fv
+from esphome.core import CORE, ID, EsphomeError
 from esphome.const import (
+    CONF_FILE,
     CONF_ID,
     CONF_NAME,
     CONF_TYPE,
+    CONF_URL,
     CONF_DISPLAY_ID,
+    CONF_DIMENSIONS,
+    CONF_HEIGHT,
+    CONF_WIDTH,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_BYTES,
+    UNIT_MILLISECOND,
+    UNIT_PERCENT,
 )
+from esphome.components import sensor
 from esphome.components import switch
 from esphome.components import cover
 from esphome.components import time as time_component
 from esphome.components import font
+from esphome.components.lvgl.helpers import (
+    add_lv_use,
+    esphome_fonts_used,
+    lv_fonts_used,
+    lv_images_used,
+)
+
+_LOGGER = logging.getLogger(__name__)
 
 CODEOWNERS = ["@antorfr"]
 DEPENDENCIES = ["lvgl"]
-AUTO_LOAD = []
+# Controllers and apps keep no global state, several dial menus can coexist
+MULTI_CONF = True
+AUTO_LOAD = ["sensor"]
 
 # Reference to homeassistant_addon components (cover, climate, media_player)
 # These are local components, so we reference them by namespace
@@ -46,6 +75,16 @@ homeassistant_addon_ns = cg.esphome_ns.namespace("homeassistant_addon")
 HomeassistantCover = homeassistant_addon_ns.class_("HomeassistantCover", cg.Component)
 HomeassistantClimate = homeassistant_addon_ns.class_("HomeassistantClimate", cg.Component)
 HomeassistantMediaPlayer = homeassistant_addon_ns.class_("HomeassistantMediaPlayer", cg.Component)
+HomeassistantLight = homeassistant_addon_ns.class_("HomeassistantLight", cg.Component)
+HomeassistantNumber = homeassistant_addon_ns.class_("HomeassistantNumber", cg.Component)
+
+# Reference to ESPHome's online_image (used to download and decode album art)
+online_image_ns = cg.esphome_ns.namespace("online_image")
+OnlineImage = online_image_ns.class_("OnlineImage", cg.PollingComponent)
+
+# The lvgl component, whose loop stops drawing when the render task takes over
+lvgl_ns = cg.esphome_ns.namespace("lvgl")
+LvglComponent = lvgl_ns.class_("LvglComponent", cg.PollingComponent)
 
 # Configuration keys
 CONF_ENCODER_ID = "encoder"
@@ -61,18 +100,60 @@ CONF_SWITCH_ID = "switch_id"
 CONF_SWITCHES = "switches"
 CONF_COVER_ID = "cover_id"
 CONF_COVERS = "covers"
+CONF_COVER_GROUPS = "cover_groups"
+CONF_ALL_COVERS = "all_covers"
+CONF_POSITION_STEP = "position_step"
 CONF_CLIMATE_ID = "climate_id"
 CONF_TEMPERATURE_STEP = "temperature_step"
 CONF_MEDIA_PLAYER_ID = "media_player_id"
 CONF_VOLUME_STEP = "volume_step"
+CONF_ALBUM_ART_ID = "album_art_id"
+CONF_ALBUM_ART_BASE_URL = "album_art_base_url"
+CONF_ALBUM_ART_CACHE_SIZE = "album_art_cache_size"
+CONF_LIGHT_ID = "light_id"
+CONF_BRIGHTNESS_STEP = "brightness_step"
+CONF_COLOR_TEMP_STEP = "color_temp_step"
+CONF_NUMBER_ID = "number_id"
+CONF_STEP = "step"
+CONF_UNIT = "unit"
 CONF_IDLE_TIMEOUT = "idle_timeout"
+CONF_TICK_BUDGET = "tick_budget"
+CONF_SNAPSHOT_INTERVAL = "snapshot_interval"
+CONF_RENDER_BUDGET = "render_budget"
+CONF_LOOP_STALL = "loop_stall"
+CONF_RENDER_TASK = "render_task"
+CONF_RENDER_CORE = "render_core"
+CONF_LVGL_ID = "lvgl_id"
 CONF_TIME_ID = "time_id"
 CONF_LANGUAGE = "language"
 CONF_FONT_14 = "font_14"
 CONF_FONT_18 = "font_18"
-
-# Supported languages
-LANGUAGES = ["en", "fr"]
+CONF_SUBSET_FONTS = "subset_fonts"
+CONF_ICON_FONT = "icon_font"
+CONF_SHA256 = "sha256"
+CONF_DIAMETER = "diameter"
+CONF_PERFORMANCE_PROFILE = "performance_profile"
+# Memory diagnostic sensors
+CONF_MEMORY = "memory"
+CONF_HEAP_FREE = "heap_free"
+CONF_HEAP_LARGEST_BLOCK = "heap_largest_block"
+CONF_HEAP_FRAGMENTATION = "heap_fragmentation"
+CONF_LVGL_USED = "lvgl_used"
+CONF_LVGL_OBJECTS = "lvgl_objects"
+CONF_UI_BYTES = "ui_bytes"
+# Boot timing diagnostic sensors
+CONF_BOOT = "boot"
+CONF_FIRST_FRAME = "first_frame"
+CONF_UI_READY = "ui_ready"
+# Keys of ESPHome's font component
+CONF_FONT_GLYPHS = "glyphs"
+CONF_FONT_GLYPHSETS = "glyphsets"
+CONF_FONT_SIZE = "size"
+CONF_FONT_BPP = "bpp"
+# What ESPHome compiles when a font: entry has neither glyphs nor glyphsets
+FONT_DEFAULT_GLYPHSET = "GF_Latin_Kernel"
+# Per glyph, besides its bitmap: ESPHome's glyph descriptor (pointers, advance, offsets, size)
+FONT_GLYPH_DESCRIPTOR_BYTES = 28
 
 # FontAwesome icons mapping (LVGL built-in)
 ICON_FONTAWESOME = {
@@ -108,6 +189,29 @@ ICON_FONTAWESOME = {
     "tv": "\uF26C",            # tv
 }
 
+# Launcher geometry on the 240 px reference display, (default, min, max) in px,
+# scaled to the configured diameter (layout.h scales the apps the same way)
+REFERENCE_DIAMETER = 240
+MIN_DIAMETER = 120
+MAX_DIAMETER = 1024
+RING_GEOMETRY = {
+    CONF_RADIUS: (85, 50, 110),
+    CONF_BUTTON_SIZE: (50, 30, 80),
+    CONF_BUTTON_SIZE_FOCUSED: (58, 30, 90),
+}
+
+# Rendering profiles: drop shadows, LVGL refresh period, and the LVGL buffer size they are tuned for
+PERFORMANCE_PROFILES = {
+    "quality": {"shadows": True, "refresh_period": 20, "buffer_size": 0.5},
+    "balanced": {"shadows": True, "refresh_period": 30, "buffer_size": 0.25},
+    "fast": {"shadows": False, "refresh_period": 40, "buffer_size": 0.125},
+}
+# "auto" keeps balanced up to this diameter; a 466 px panel has ~4x the pixels of a 240 px one
+AUTO_BALANCED_MAX_DIAMETER = 280
+
+# Icon height relative to the button diameter
+ICON_SIZE_RATIO = 0.44
+
 # Default colors for apps
 DEFAULT_COLORS = [
     0xFD5C4C,  # Red-orange
@@ -130,6 +234,15 @@ SwitchApp = dial_menu_ns.class_("SwitchApp", DialApp)
 CoverApp = dial_menu_ns.class_("CoverApp", DialApp)
 ClimateApp = dial_menu_ns.class_("ClimateApp", DialApp)
 MediaPlayerApp = dial_menu_ns.class_("MediaPlayerApp", DialApp)
+LightApp = dial_menu_ns.class_("LightApp", DialApp)
+NumberApp = dial_menu_ns.class_("NumberApp", DialApp)
+
+# Supported languages, one column each in localization.h
+Language = dial_menu_ns.enum("Language", is_class=True)
+LANGUAGES = {
+    "en": Language.EN,
+    "fr": Language.FR,
+}
 
 
 def app_schema(app_type):
@@ -162,6 +275,37 @@ COVER_ITEM_SCHEMA = cv.Schema(
     }
 )
 
+# Schéma pour un groupe de covers (membres pris dans la liste covers de l'app)
+COVER_GROUP_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_NAME): cv.string,
+        cv.Optional(CONF_COLOR): cv.hex_uint32_t,
+        cv.Required(CONF_COVERS): cv.All(cv.ensure_list(cv.use_id(cover.Cover)), cv.Length(min=1)),
+    }
+)
+
+# Groups keep their members in a 32-bit mask (MAX_COVERS in cover_app.h)
+MAX_COVERS = 32
+
+
+def validate_cover_groups(config):
+    """Group members must be covers listed in the same app"""
+    if CONF_COVER_GROUPS not in config and CONF_ALL_COVERS not in config:
+        return config
+    cover_ids = [c[CONF_COVER_ID] for c in config.get(CONF_COVERS, [])]
+    if not cover_ids:
+        raise cv.Invalid(f"'{CONF_COVER_GROUPS}' and '{CONF_ALL_COVERS}' require a '{CONF_COVERS}' list")
+    if len(cover_ids) > MAX_COVERS:
+        raise cv.Invalid(f"Cover groups support at most {MAX_COVERS} covers per app")
+    for group in config.get(CONF_COVER_GROUPS, []):
+        for member in group[CONF_COVERS]:
+            if member not in cover_ids:
+                raise cv.Invalid(
+                    f"Cover '{member}' of group '{group[CONF_NAME]}' is not in this app's '{CONF_COVERS}' list"
+                )
+    return config
+
+
 # Schéma pour une app - supports single switch_id or list of switches
 APP_SCHEMA = cv.Schema(
     {
@@ -174,32 +318,549 @@ APP_SCHEMA = cv.Schema(
         cv.Optional(CONF_SWITCHES): cv.ensure_list(SWITCH_ITEM_SCHEMA),
         cv.Optional(CONF_COVER_ID): cv.use_id(cover.Cover),
         cv.Optional(CONF_COVERS): cv.ensure_list(COVER_ITEM_SCHEMA),
+        cv.Optional(CONF_COVER_GROUPS): cv.ensure_list(COVER_GROUP_SCHEMA),
+        cv.Optional(CONF_ALL_COVERS): cv.string,
+        cv.Optional(CONF_POSITION_STEP, default="5%"): cv.All(cv.percentage, cv.Range(min=0.01, max=0.25)),
         cv.Optional(CONF_CLIMATE_ID): cv.use_id(HomeassistantClimate),
         cv.Optional(CONF_TEMPERATURE_STEP, default=0.5): cv.float_range(min=0.1, max=2.0),
         cv.Optional(CONF_MEDIA_PLAYER_ID): cv.use_id(HomeassistantMediaPlayer),
         cv.Optional(CONF_VOLUME_STEP, default=0.05): cv.float_range(min=0.01, max=0.2),
+        cv.Optional(CONF_ALBUM_ART_ID): cv.use_id(OnlineImage),
+        cv.Optional(CONF_ALBUM_ART_BASE_URL, default="http://homeassistant.local:8123"): cv.url,
+        cv.Optional(CONF_ALBUM_ART_CACHE_SIZE, default=4): cv.int_range(min=1, max=16),
+        cv.Optional(CONF_LIGHT_ID): cv.use_id(HomeassistantLight),
+        cv.Optional(CONF_BRIGHTNESS_STEP, default=0.05): cv.float_range(min=0.01, max=0.25),
+        cv.Optional(CONF_COLOR_TEMP_STEP, default=100): cv.float_range(min=10, max=1000),
+        cv.Optional(CONF_NUMBER_ID): cv.use_id(HomeassistantNumber),
+        cv.Optional(CONF_STEP): cv.positive_float,
+        cv.Optional(CONF_UNIT, default=""): cv.string,
+    }
+)
+
+# LVGL widget types and built-in fonts the C++ code creates. The lvgl component
+# only enables what its own YAML widgets use, so they are declared here.
+LVGL_WIDGETS = ("obj", "label", "btn", "arc")
+LVGL_BUILTIN_FONTS = ("montserrat_14", "montserrat_18", "montserrat_28", "montserrat_48")
+
+
+def scale_to_diameter(reference, diameter):
+    """Scale a length from the 240 px reference display"""
+    return round(reference * diameter / REFERENCE_DIAMETER)
+
+
+def resolve_layout(config):
+    """Scale the launcher geometry to the display diameter and resolve the 'auto' profile"""
+    diameter = config[CONF_DIAMETER]
+    for key, (default, low, high) in RING_GEOMETRY.items():
+        if key not in config:
+            config[key] = scale_to_diameter(default, diameter)
+            continue
+        low, high = scale_to_diameter(low, diameter), scale_to_diameter(high, diameter)
+        if not low <= config[key] <= high:
+            raise cv.Invalid(f"'{key}' must be between {low} and {high} px on a {diameter} px display", path=[key])
+    if config[CONF_PERFORMANCE_PROFILE] == "auto":
+        config[CONF_PERFORMANCE_PROFILE] = "balanced" if diameter <= AUTO_BALANCED_MAX_DIAMETER else "fast"
+    return config
+
+
+def declare_lvgl_features(config):
+    """Register the widgets, fonts and images of this menu with the lvgl component"""
+    add_lv_use(*LVGL_WIDGETS)
+    if any(app_conf[CONF_ICON_TYPE] != "none" for app_conf in config[CONF_APPS]):
+        add_lv_use("img")
+    lv_fonts_used.update(LVGL_BUILTIN_FONTS)
+    for key in (CONF_FONT_14, CONF_FONT_18):
+        if key in config:
+            esphome_fonts_used.add(config[key])
+    for app_conf in config[CONF_APPS]:
+        if CONF_ALBUM_ART_ID in app_conf:
+            add_lv_use("img")
+            lv_images_used.add(app_conf[CONF_ALBUM_ART_ID])
+    return config
+
+
+def validate_sha256(value):
+    value = cv.string_strict(value).lower()
+    if not re.fullmatch(r"[0-9a-f]{64}", value):
+        raise cv.Invalid("sha256 must be 64 hexadecimal digits")
+    return value
+
+
+def fetch_icon_font(config):
+    """Local path of icon_font, downloaded once and checked against its sha256 when given as a URL.
+
+    None when no icon_font is set or no app shows an icon: the buttons draw LVGL symbols.
+    """
+    icon_font = config.get(CONF_ICON_FONT)
+    if icon_font is None or all(app_conf[CONF_ICON_TYPE] == "none" for app_conf in config[CONF_APPS]):
+        return None
+    if not isinstance(icon_font, dict):
+        return str(icon_font)
+    sha256 = icon_font[CONF_SHA256]
+    path = external_files.compute_local_file_dir("dial_menu") / f"icon_font_{sha256}.ttf"
+    if not path.is_file() or file_sha256(path) != sha256:
+        try:
+            external_files.download_content(icon_font[CONF_URL], path)
+        except Exception as err:
+            raise EsphomeError(
+                f"Could not download the icon font ({err}), set '{CONF_ICON_FONT}' to a local file"
+            ) from err
+        actual = file_sha256(path)
+        if actual != sha256:
+            path.unlink()
+            raise EsphomeError(f"{icon_font[CONF_URL]} has sha256 {actual}, '{CONF_ICON_FONT}' expects {sha256}")
+    return str(path)
+
+
+def file_sha256(path):
+    return hashlib.sha256(Path(path).read_bytes()).hexdigest()
+
+
+def rasterize_icon(face, codepoint, size):
+    """8-bit coverage bitmap of one glyph, or None if the font doesn't have it"""
+    import freetype
+
+    if face.get_char_index(codepoint) == 0:
+        return None
+    face.set_pixel_sizes(0, size)
+    face.load_char(codepoint, freetype.FT_LOAD_RENDER | freetype.FT_LOAD_TARGET_NORMAL)
+    bitmap = face.glyph.bitmap
+    data = bytearray()
+    for row in range(bitmap.rows):
+        start = row * bitmap.pitch
+        data += bytes(bitmap.buffer[start : start + bitmap.width])
+    return bitmap.width, bitmap.rows, data
+
+
+def build_icon_atlas(config, font_path):
+    """Rasterize the icons the apps use, at the normal and focused button sizes.
+
+    Returns the A8 atlas (sprites stored one after the other) and, per
+    (icon type, focused), the (offset, width, height) of its sprite. Icons the
+    font lacks are left out; the buttons show the LVGL symbol fallback for them.
+    """
+    import freetype
+
+    icon_types = sorted({app_conf[CONF_ICON_TYPE] for app_conf in config[CONF_APPS]} - {"none"})
+    if not icon_types or font_path is None:
+        return b"", {}
+    face = freetype.Face(font_path)
+    sizes = {
+        False: round(config[CONF_BUTTON_SIZE] * ICON_SIZE_RATIO),
+        True: round(config[CONF_BUTTON_SIZE_FOCUSED] * ICON_SIZE_RATIO),
+    }
+    atlas = bytearray()
+    sprites = {}
+    rendered = {}  # Aliases (gate / garage...) share their sprites
+    for icon_type in icon_types:
+        codepoint = ord(ICON_FONTAWESOME[icon_type])
+        for focused, size in sizes.items():
+            key = (codepoint, size)
+            if key not in rendered:
+                glyph = rasterize_icon(face, codepoint, size)
+                if glyph is None:
+                    _LOGGER.warning("dial_menu: icon '%s' is not in the icon font, using the LVGL symbol", icon_type)
+                    break
+                width, height, data = glyph
+                rendered[key] = (len(atlas), width, height)
+                atlas += data
+            sprites[(icon_type, focused)] = rendered[key]
+    _LOGGER.info("dial_menu: icon atlas with %d sprites, %d bytes", len(rendered), len(atlas))
+    return bytes(atlas), sprites
+
+
+def _memory_sensor_schema(unit=None):
+    return sensor.sensor_schema(
+        unit_of_measurement=unit,
+        icon="mdi:memory",
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    )
+
+
+MEMORY_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_HEAP_FREE): _memory_sensor_schema(UNIT_BYTES),
+        cv.Optional(CONF_HEAP_LARGEST_BLOCK): _memory_sensor_schema(UNIT_BYTES),
+        cv.Optional(CONF_HEAP_FRAGMENTATION): _memory_sensor_schema(UNIT_PERCENT),
+        cv.Optional(CONF_LVGL_USED): _memory_sensor_schema(UNIT_BYTES),
+        cv.Optional(CONF_LVGL_OBJECTS): _memory_sensor_schema(),
+        cv.Optional(CONF_UI_BYTES): _memory_sensor_schema(UNIT_BYTES),
+    }
+)
+
+MEMORY_SENSOR_SETTERS = {
+    CONF_HEAP_FREE: "set_heap_free_sensor",
+    CONF_HEAP_LARGEST_BLOCK: "set_heap_largest_block_sensor",
+    CONF_HEAP_FRAGMENTATION: "set_heap_fragmentation_sensor",
+    CONF_LVGL_USED: "set_lvgl_used_sensor",
+    CONF_LVGL_OBJECTS: "set_lvgl_objects_sensor",
+    CONF_UI_BYTES: "set_ui_bytes_sensor",
+}
+
+
+def _boot_sensor_schema():
+    return sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        icon="mdi:timer-outline",
+        accuracy_decimals=0,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    )
+
+
+# Time since boot when each stage is reached
+BOOT_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_FIRST_FRAME): _boot_sensor_schema(),
+        cv.Optional(CONF_UI_READY): _boot_sensor_schema(),
     }
 )
 
+BOOT_SENSOR_SETTERS = {
+    CONF_FIRST_FRAME: "set_first_frame_sensor",
+    CONF_UI_READY: "set_ui_ready_sensor",
+}
+
+
 # Schéma principal du composant
-CONFIG_SCHEMA = cv.Schema(
+CONFIG_SCHEMA = cv.All(cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(DialMenuController),
         cv.Required(CONF_DISPLAY_ID): cv.string,
         cv.Optional(CONF_TOUCHSCREEN_ID): cv.string,
         cv.Optional(CONF_ENCODER_ID): cv.string,
         cv.Optional(CONF_BUTTON_ID): cv.string,
-        cv.Optional(CONF_APPS, default=[]): cv.ensure_list(APP_SCHEMA),
-        cv.Optional(CONF_RADIUS, default=85): cv.int_range(min=50, max=110),
-        cv.Optional(CONF_BUTTON_SIZE, default=50): cv.int_range(min=30, max=80),
-        cv.Optional(CONF_BUTTON_SIZE_FOCUSED, default=58): cv.int_range(min=30, max=90),
+        cv.Optional(CONF_APPS, default=[]): cv.ensure_list(cv.All(APP_SCHEMA, validate_cover_groups)),
+        # Defaults and limits follow the diameter (see RING_GEOMETRY)
+        cv.Optional(CONF_RADIUS): cv.positive_int,
+        cv.Optional(CONF_BUTTON_SIZE): cv.positive_int,
+        cv.Optional(CONF_BUTTON_SIZE_FOCUSED): cv.positive_int,
+        # Defaults to the shorter side of display_id (see final_validate_diameter)
+        cv.Optional(CONF_DIAMETER): cv.int_range(min=MIN_DIAMETER, max=MAX_DIAMETER),
+        cv.Optional(CONF_PERFORMANCE_PROFILE, default="auto"): cv.one_of("auto", *PERFORMANCE_PROFILES, lower=True),
         cv.Optional(CONF_IDLE_TIMEOUT, default="30s"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_TICK_BUDGET, default="2ms"): cv.positive_time_period_microseconds,
+        # Selected app and shown items are restored at boot, 0s disables it
+        cv.Optional(CONF_SNAPSHOT_INTERVAL, default="5min"): cv.positive_time_period_milliseconds,
         cv.Optional(CONF_TIME_ID): cv.use_id(time_component.RealTimeClock),
-        cv.Optional(CONF_LANGUAGE, default="en"): cv.one_of(*LANGUAGES, lower=True),
+        cv.Optional(CONF_LANGUAGE, default="en"): cv.enum(LANGUAGES, lower=True),
         cv.Optional(CONF_FONT_14): cv.use_id(font.Font),
         cv.Optional(CONF_FONT_18): cv.use_id(font.Font),
+        cv.Optional(CONF_SUBSET_FONTS, default=True): cv.boolean,
+        cv.Optional(CONF_ICON_FONT): cv.Any(
+            cv.file_,
+            cv.Schema(
+                {
+                    cv.Required(CONF_URL): cv.url,
+                    cv.Required(CONF_SHA256): validate_sha256,
+                }
+            ),
+        ),
+        cv.Optional(CONF_MEMORY): MEMORY_SCHEMA,
+        cv.Optional(CONF_BOOT): BOOT_SCHEMA,
+        # Longer redraws are finished on the next refreshes, 0ms disables it
+        cv.Optional(CONF_RENDER_BUDGET, default="10ms"): cv.positive_time_period_microseconds,
+        # The lvgl block drawing on display_id (required with several lvgl blocks)
+        cv.GenerateID(CONF_LVGL_ID): cv.use_id(LvglComponent),
+        # LVGL in its own task, pinned to render_core
+        cv.Optional(CONF_RENDER_TASK, default=False): cv.boolean,
+        cv.Optional(CONF_RENDER_CORE, default=1): cv.int_range(min=0, max=1),
+        cv.Optional(CONF_LOOP_STALL): sensor.sensor_schema(
+            unit_of_measurement=UNIT_MILLISECOND,
+            icon="mdi:timer-alert-outline",
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+).extend(cv.COMPONENT_SCHEMA), declare_lvgl_features)
+
+
+# Characters drawn with the custom fonts besides names and localized strings:
+# the numbers of the climate, light and number labels ("%.1f°C", "%g - %g")
+FONT_14_EXTRA_GLYPHS = " 0123456789.,:-+e%°CK"
+FONT_18_EXTRA_GLYPHS = " °C"
+
+LOCALIZATION_HEADER = Path(__file__).parent / "localization.h"
+# X(ID, "english", "french", ...) entries of DIAL_MENU_STRINGS
+_STRING_ENTRY_RE = re.compile(r'X\(\s*(\w+)\s*((?:,\s*"(?:[^"\\]|\\.)*"\s*)+)\)')
+_C_STRING_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+
+
+def load_localized_strings():
+    """Read the string table of localization.h: {string id: [text per language]}"""
+    text = LOCALIZATION_HEADER.read_text(encoding="utf-8")
+    return {
+        match.group(1): [ast.literal_eval(f'"{s}"') for s in _C_STRING_RE.findall(match.group(2))]
+        for match in _STRING_ENTRY_RE.finditer(text)
     }
-).extend(cv.COMPONENT_SCHEMA)
+
+
+def collect_font_glyphs(config):
+    """Every character a dial menu draws with font_14 and font_18.
+
+    All languages are included, since the language can be switched at runtime.
+    """
+    glyphs = {CONF_FONT_14: set(FONT_14_EXTRA_GLYPHS), CONF_FONT_18: set(FONT_18_EXTRA_GLYPHS)}
+    for string_id, texts in load_localized_strings().items():
+        # Day and month names are the idle screen's 18px labels
+        key = CONF_FONT_18 if string_id.startswith(("DAY_", "MONTH_")) else CONF_FONT_14
+        for text in texts:
+            glyphs[key].update(text)
+    for app_conf in config.get(CONF_APPS, []):
+        glyphs[CONF_FONT_14].update(app_conf[CONF_NAME])
+        for key in (CONF_SWITCHES, CONF_COVERS, CONF_COVER_GROUPS):
+            for item in app_conf.get(key, []):
+                glyphs[CONF_FONT_14].update(item[CONF_NAME])
+        glyphs[CONF_FONT_14].update(app_conf.get(CONF_ALL_COVERS, ""))
+    return glyphs
+
+
+def estimate_glyph_bytes(size, bpp):
+    """Rough flash cost of one glyph: a 0.6 x 0.75 em bitmap plus its descriptors"""
+    return int(size * 0.6 * size * 0.75 * bpp / 8) + FONT_GLYPH_DESCRIPTOR_BYTES
+
+
+def declared_font_glyphs(font_conf):
+    """Characters a font: entry compiles: its glyphs, its glyphsets, or ESPHome's default glyphset.
+
+    Returns None when a glyphset can't be expanded (no glyphsets package).
+    """
+    declared = set("".join(font_conf.get(CONF_FONT_GLYPHS, [])))
+    glyphsets = list(font_conf.get(CONF_FONT_GLYPHSETS, []))
+    if not declared and not glyphsets:
+        glyphsets = [FONT_DEFAULT_GLYPHSET]
+    if glyphsets:
+        try:
+            import glyphsets as gf_glyphsets
+
+            for glyphset in glyphsets:
+                declared.update(chr(codepoint) for codepoint in gf_glyphsets.unicodes_per_glyphset(glyphset))
+        except Exception as err:  # pylint: disable=broad-except
+            _LOGGER.debug("dial_menu: glyphsets %s not expanded: %s", ", ".join(glyphsets), err)
+            return None
+    return declared
+
+
+def open_font_face(font_conf):
+    """freetype face of a font: entry, as ESPHome loads it, or None when it can't be opened here"""
+    try:
+        import freetype
+
+        file_conf = font_conf[CONF_FILE]
+        path = font.get_font_path(file_conf, file_conf[CONF_TYPE])
+        return freetype.Face(str(path))
+    except Exception as err:  # pylint: disable=broad-except
+        _LOGGER.debug("dial_menu: font '%s' not opened: %s", font_conf[CONF_ID].id, err)
+        return None
+
+
+def measure_font_bytes(face, glyphs, size, bpp):
+    """Flash taken by these glyphs: packed bitmaps at size/bpp, the glyph descriptors and their UTF-8 keys"""
+    import freetype
+
+    face.set_pixel_sizes(0, size)
+    total = 0
+    for glyph in glyphs:
+        if face.get_char_index(ord(glyph)) == 0:
+            continue
+        face.load_char(glyph, freetype.FT_LOAD_RENDER | freetype.FT_LOAD_TARGET_NORMAL)
+        bitmap = face.glyph.bitmap
+        total += (bitmap.width * bitmap.rows * bpp + 7) // 8
+        total += FONT_GLYPH_DESCRIPTOR_BYTES + len(glyph.encode("utf-8")) + 1
+    return total
+
+
+def final_validate_fonts(config):
+    """Reduce the custom fonts to the glyphs the dial menus actually draw.
+
+    Looks at every dial_menu block, so a font shared by several menus keeps
+    the glyphs of all of them. Running it again leaves the fonts unchanged.
+    The flash saved is measured by rendering the font with freetype, as
+    ESPHome does, and estimated when the font can't be opened here.
+    """
+    full_config = fv.full_config.get()
+    wanted = {}
+    for menu in full_config.get("dial_menu", []):
+        if not menu[CONF_SUBSET_FONTS]:
+            continue
+        for key, glyphs in collect_font_glyphs(menu).items():
+            if key in menu:
+                wanted.setdefault(menu[key].id, set()).update(glyphs)
+
+    total_before = total_after = 0
+    total_how = "measured"
+    for font_conf in full_config.get("font", []):
+        glyphs = wanted.get(font_conf[CONF_ID].id)
+        if glyphs is None:
+            continue
+        glyphsets = font_conf.get(CONF_FONT_GLYPHSETS, [])
+        if set("".join(font_conf.get(CONF_FONT_GLYPHS, []))) == glyphs and not glyphsets:
+            continue
+        declared = declared_font_glyphs(font_conf)
+        if glyphsets:
+            source = ", ".join(glyphsets)
+        else:
+            source = "glyphs" if font_conf.get(CONF_FONT_GLYPHS) else FONT_DEFAULT_GLYPHSET
+        font_conf[CONF_FONT_GLYPHS] = sorted(glyphs)
+        if glyphsets:
+            font_conf[CONF_FONT_GLYPHSETS] = []
+        if declared is None:
+            _LOGGER.info(
+                "dial_menu: font '%s' reduced to %d glyphs (from %s, size unknown here)",
+                font_conf[CONF_ID].id,
+                len(glyphs),
+                source,
+            )
+            continue
+
+        size, bpp = font_conf[CONF_FONT_SIZE], font_conf[CONF_FONT_BPP]
+        face = open_font_face(font_conf)
+        if face is not None:
+            before = measure_font_bytes(face, declared, size, bpp)
+            after = measure_font_bytes(face, glyphs, size, bpp)
+            how = "measured"
+        else:
+            before = len(declared) * estimate_glyph_bytes(size, bpp)
+            after = len(glyphs) * estimate_glyph_bytes(size, bpp)
+            how = total_how = "estimated"
+        total_before += before
+        total_after += after
+        _LOGGER.info(
+            "dial_menu: font '%s' reduced to %d of %d glyphs (%s): %.1f kB -> %.1f kB of flash (%s)",
+            font_conf[CONF_ID].id,
+            len(glyphs),
+            len(declared),
+            source,
+            before / 1024,
+            after / 1024,
+            how,
+        )
+    if total_before:
+        _LOGGER.info(
+            "dial_menu: font subsetting saves %.1f kB of flash in this configuration (%s)",
+            (total_before - total_after) / 1024,
+            total_how,
+        )
+
+
+def final_validate_buffer_size(config):
+    """Point out an LVGL buffer size other than the one the performance profile is tuned for"""
+    profile = config[CONF_PERFORMANCE_PROFILE]
+    wanted = PERFORMANCE_PROFILES[profile]["buffer_size"]
+    lvgl_confs = fv.full_config.get().get("lvgl", [])
+    if isinstance(lvgl_confs, dict):
+        lvgl_confs = [lvgl_confs]
+    for lvgl_conf in lvgl_confs:
+        buffer_size = lvgl_conf.get("buffer_size")
+        if buffer_size is not None and abs(buffer_size - wanted) > 0.001:
+            _LOGGER.info(
+                "dial_menu: the '%s' profile is tuned for an LVGL buffer_size of %g%% (configured: %g%%)",
+                profile,
+                wanted * 100,
+                buffer_size * 100,
+            )
+
+
+def final_validate_display(config):
+    """The lvgl block the menu is bound to must be the one drawing on display_id"""
+    lvgl_confs = fv.full_config.get().get("lvgl", [])
+    if isinstance(lvgl_confs, dict):
+        lvgl_confs = [lvgl_confs]
+    display_id = str(config[CONF_DISPLAY_ID])
+    lvgl_id = str(config[CONF_LVGL_ID])
+    for lvgl_conf in lvgl_confs:
+        displays = [str(display) for display in lvgl_conf.get("displays", [])]
+        if display_id not in displays:
+            continue
+        if str(lvgl_conf[CONF_ID]) != lvgl_id:
+            raise cv.Invalid(
+                f"'{display_id}' is drawn by the lvgl block '{lvgl_conf[CONF_ID]}', "
+                f"set '{CONF_LVGL_ID}: {lvgl_conf[CONF_ID]}'"
+            )
+        return
+    if len(lvgl_confs) > 1:
+        raise cv.Invalid(f"No lvgl block lists '{display_id}' in its displays")
+
+
+def display_dimensions(display_id):
+    """(width, height) of display_id as set in its YAML, None when the platform takes it from the model"""
+    for display_conf in fv.full_config.get().get("display", []):
+        if str(display_conf.get(CONF_ID)) != display_id:
+            continue
+        dimensions = display_conf.get(CONF_DIMENSIONS, display_conf)
+        if isinstance(dimensions, dict):
+            width, height = dimensions.get(CONF_WIDTH), dimensions.get(CONF_HEIGHT)
+        elif isinstance(dimensions, (list, tuple)) and len(dimensions) == 2:
+            width, height = dimensions
+        else:
+            return None
+        return (width, height) if width and height else None
+    return None
+
+
+def final_validate_diameter(config):
+    """Default the diameter to the shorter side of display_id, then scale the layout to it"""
+    display_id = str(config[CONF_DISPLAY_ID])
+    dimensions = display_dimensions(display_id)
+    if CONF_DIAMETER not in config:
+        if dimensions is None:
+            _LOGGER.info(
+                "dial_menu: '%s' sets no dimensions, laid out for %d px (set '%s')",
+                display_id,
+                REFERENCE_DIAMETER,
+                CONF_DIAMETER,
+            )
+            config[CONF_DIAMETER] = REFERENCE_DIAMETER
+        else:
+            diameter = min(dimensions)
+            if not MIN_DIAMETER <= diameter <= MAX_DIAMETER:
+                raise cv.Invalid(
+                    f"'{display_id}' is {dimensions[0]}x{dimensions[1]} px, '{CONF_DIAMETER}' must be between "
+                    f"{MIN_DIAMETER} and {MAX_DIAMETER} px"
+                )
+            config[CONF_DIAMETER] = diameter
+    elif dimensions is not None and config[CONF_DIAMETER] > min(dimensions):
+        raise cv.Invalid(
+            f"'{CONF_DIAMETER}' is {config[CONF_DIAMETER]} px, '{display_id}' is {dimensions[0]}x{dimensions[1]} px",
+            path=[CONF_DIAMETER],
+        )
+    # In place: to_code reads the same dict
+    resolve_layout(config)
+
+
+def final_validate_render_task(config):
+    """LVGL can only belong to one render task, pinned to a core the chip has"""
+    menus = fv.full_config.get().get("dial_menu", [])
+    # Any other dial_menu would drive LVGL from the main loop while the task owns it
+    if config[CONF_RENDER_TASK] and len(menus) > 1:
+        raise cv.Invalid(f"'{CONF_RENDER_TASK}' requires a single dial_menu, {len(menus)} are configured")
+    if config[CONF_RENDER_TASK] and config[CONF_RENDER_CORE] == 1 and CORE.is_esp32:
+        from esphome.components.esp32 import get_esp32_variant
+        from esphome.components.esp32.const import (
+            VARIANT_ESP32C3,
+            VARIANT_ESP32C6,
+            VARIANT_ESP32H2,
+            VARIANT_ESP32S2,
+        )
+
+        variant = get_esp32_variant()
+        if variant in (VARIANT_ESP32C3, VARIANT_ESP32C6, VARIANT_ESP32H2, VARIANT_ESP32S2):
+            raise cv.Invalid(f"{variant} has a single core, set '{CONF_RENDER_CORE}: 0'")
+
+
+def final_validate(config):
+    # First: the profile and ring geometry the other checks read follow the diameter
+    final_validate_diameter(config)
+    final_validate_fonts(config)
+    final_validate_buffer_size(config)
+    final_validate_display(config)
+    final_validate_render_task(config)
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = final_validate
 
 
 def calculate_icon_positions(num_apps, radius=85):
@@ -220,7 +881,7 @@ async def to_code(config):
     
     # Get apps configuration
     apps = config.get(CONF_APPS, [])
-    radius = config.get(CONF_RADIUS, 85)
+    radius = config[CONF_RADIUS]
     
     # Get optional custom fonts
     font_14_var = None
@@ -230,6 +891,12 @@ async def to_code(config):
     if CONF_FONT_18 in config:
         font_18_var = await cg.get_variable(config[CONF_FONT_18])
     
+    # Icon sprites, one A8 atlas in flash for the whole menu
+    atlas_data, icon_sprites = build_icon_atlas(config, fetch_icon_font(config))
+    atlas_id = ID(f"{config[CONF_ID].id}_icon_atlas", is_declaration=True, type=cg.uint8)
+    if atlas_data:
+        cg.progmem_array(atlas_id, list(atlas_data))
+    
     # Calculate positions for icons
     num_apps = len(apps)
     positions = calculate_icon_positions(num_apps, radius) if num_apps > 0 else []
@@ -270,14 +937,32 @@ async def to_code(config):
             # Pass custom font to CoverApp
             if font_14_var is not None:
                 cg.add(app_var.set_font_14(font_14_var))
+            cg.add(app_var.set_position_step(app_conf[CONF_POSITION_STEP]))
+            cg.add(app_var.set_controller(var))
             
             # Check for multiple covers first
             if CONF_COVERS in app_conf:
-                for cv_conf in app_conf[CONF_COVERS]:
-                    cv_entity = await cg.get_variable(cv_conf[CONF_COVER_ID])
+                cover_ids = [cv_conf[CONF_COVER_ID] for cv_conf in app_conf[CONF_COVERS]]
+                # HA covers are registered as such so groups can batch their service calls
+                cover_vars = [await cg.get_variable_with_full_id(cover_id) for cover_id in cover_ids]
+                if any(full_id.type.inherits_from(HomeassistantCover) for full_id, _ in cover_vars):
+                    cg.add_define("USE_DIAL_MENU_COVER_HA")
+                for cv_conf, (full_id, cv_entity) in zip(app_conf[CONF_COVERS], cover_vars):
                     cv_name = cv_conf[CONF_NAME]
                     cv_color = cv_conf.get(CONF_COLOR, DEFAULT_COLORS[i % len(DEFAULT_COLORS)])
-                    cg.add(app_var.add_cover(cv_entity, cv_name, cv_color))
+                    if full_id.type.inherits_from(HomeassistantCover):
+                        cg.add(app_var.add_homeassistant_cover(cv_entity, cv_name, cv_color))
+                    else:
+                        cg.add(app_var.add_cover(cv_entity, cv_name, cv_color))
+                
+                # Groups are shown after the covers, "All" last
+                for group_conf in app_conf.get(CONF_COVER_GROUPS, []):
+                    members = [cover_ids.index(member) for member in group_conf[CONF_COVERS]]
+                    group_color = group_conf.get(CONF_COLOR, DEFAULT_COLORS[i % len(DEFAULT_COLORS)])
+                    cg.add(app_var.add_cover_group(group_conf[CONF_NAME], group_color, members))
+                if CONF_ALL_COVERS in app_conf:
+                    all_color = app_conf.get(CONF_COLOR, DEFAULT_COLORS[i % len(DEFAULT_COLORS)])
+                    cg.add(app_var.add_cover_group(app_conf[CONF_ALL_COVERS], all_color, list(range(len(cover_ids)))))
             # Fallback to single cover_id
             elif CONF_COVER_ID in app_conf:
                 cv_entity = await cg.get_variable(app_conf[CONF_COVER_ID])
@@ -299,6 +984,7 @@ async def to_code(config):
             if CONF_CLIMATE_ID in app_conf:
                 climate_entity = await cg.get_variable(app_conf[CONF_CLIMATE_ID])
                 cg.add(app_var.set_climate(climate_entity))
+            cg.add(app_var.set_controller(var))
             
             # Set temperature step
             temp_step = app_conf.get(CONF_TEMPERATURE_STEP, 0.5)
@@ -309,7 +995,7 @@ async def to_code(config):
             app_id.type = MediaPlayerApp
             app_var = cg.new_Pvariable(app_id)
             
-            # Set controller reference for language support
+            # Volume commits are scheduled on the controller
             cg.add(app_var.set_controller(var))
             
             # Pass custom fonts to MediaPlayerApp
@@ -326,6 +1012,45 @@ async def to_code(config):
             # Set volume step
             vol_step = app_conf.get(CONF_VOLUME_STEP, 0.05)
             cg.add(app_var.set_volume_step(vol_step))
+            
+            # Album art (optional) - downloaded by an online_image, cached in PSRAM
+            if CONF_ALBUM_ART_ID in app_conf:
+                cg.add_define("USE_DIAL_MENU_ALBUM_ART")
+                art_image = await cg.get_variable(app_conf[CONF_ALBUM_ART_ID])
+                cg.add(app_var.set_album_art_image(art_image))
+                cg.add(app_var.set_album_art_base_url(app_conf[CONF_ALBUM_ART_BASE_URL].rstrip("/")))
+                cg.add(app_var.set_album_art_cache_size(app_conf[CONF_ALBUM_ART_CACHE_SIZE]))
+        elif app_type == "light":
+            # LightApp for a Home Assistant light (brightness / color temperature streamed live)
+            cg.add_define("USE_DIAL_MENU_LIGHT")
+            app_id.type = LightApp
+            app_var = cg.new_Pvariable(app_id)
+            
+            if font_14_var is not None:
+                cg.add(app_var.set_font_14(font_14_var))
+            
+            if CONF_LIGHT_ID in app_conf:
+                light_entity = await cg.get_variable(app_conf[CONF_LIGHT_ID])
+                cg.add(app_var.set_light(light_entity))
+            
+            cg.add(app_var.set_brightness_step(app_conf[CONF_BRIGHTNESS_STEP]))
+            cg.add(app_var.set_color_temp_step(app_conf[CONF_COLOR_TEMP_STEP]))
+        elif app_type == "number":
+            # NumberApp for a Home Assistant input_number / number (value streamed live)
+            cg.add_define("USE_DIAL_MENU_NUMBER")
+            app_id.type = NumberApp
+            app_var = cg.new_Pvariable(app_id)
+            
+            if font_14_var is not None:
+                cg.add(app_var.set_font_14(font_14_var))
+            
+            if CONF_NUMBER_ID in app_conf:
+                number_entity = await cg.get_variable(app_conf[CONF_NUMBER_ID])
+                cg.add(app_var.set_number(number_entity))
+            
+            if CONF_STEP in app_conf:
+                cg.add(app_var.set_step(app_conf[CONF_STEP]))
+            cg.add(app_var.set_unit(app_conf[CONF_UNIT]))
         else:
             # Generic DialApp
             app_var = cg.new_Pvariable(app_id)
@@ -337,9 +1062,15 @@ async def to_code(config):
         color = app_conf.get(CONF_COLOR, DEFAULT_COLORS[i % len(DEFAULT_COLORS)])
         cg.add(app_var.set_color(color))
         
-        # Set icon type (e.g., "settings", "wifi", etc.) - C++ will map to LVGL symbols
+        # Set icon type (e.g., "settings", "wifi", etc.) - C++ maps it to an LVGL symbol
+        # when the atlas has no sprite for it
         icon_type = app_conf.get(CONF_ICON_TYPE, "none")
         cg.add(app_var.set_icon(icon_type))
+        for focused in (False, True):
+            if (icon_type, focused) in icon_sprites:
+                offset, width, height = icon_sprites[(icon_type, focused)]
+                data = cg.RawExpression(f"{atlas_id} + {offset}")
+                cg.add(app_var.set_icon_sprite(focused, data, width, height))
         
         # Set position
         if i < len(positions):
@@ -352,11 +1083,42 @@ async def to_code(config):
     cg.add(var.set_group_name("dial_menu_group"))
     
     # Store config for LVGL generation
-    cg.add(var.set_button_size(config.get(CONF_BUTTON_SIZE, 50)))
-    cg.add(var.set_button_size_focused(config.get(CONF_BUTTON_SIZE_FOCUSED, 58)))
+    cg.add(var.set_button_size(config[CONF_BUTTON_SIZE]))
+    cg.add(var.set_button_size_focused(config[CONF_BUTTON_SIZE_FOCUSED]))
+    
+    # Display geometry and performance profile
+    profile = PERFORMANCE_PROFILES[config[CONF_PERFORMANCE_PROFILE]]
+    cg.add(var.set_diameter(config[CONF_DIAMETER]))
+    cg.add(var.set_shadows(profile["shadows"]))
+    cg.add(var.set_refresh_period(profile["refresh_period"]))
     
     # Idle screen configuration
     cg.add(var.set_idle_timeout(config.get(CONF_IDLE_TIMEOUT)))
+    cg.add(var.set_tick_budget(config[CONF_TICK_BUDGET]))
+    cg.add(var.set_snapshot_key(str(config[CONF_ID])))
+    cg.add(var.set_snapshot_interval(config[CONF_SNAPSHOT_INTERVAL]))
+    cg.add(var.set_render_budget(config[CONF_RENDER_BUDGET]))
+    # Pages, refresh timer and first frame on this lvgl block's display
+    lvgl_var = await cg.get_variable(config[CONF_LVGL_ID])
+    cg.add(var.set_lvgl(lvgl_var))
+    if config[CONF_RENDER_TASK]:
+        cg.add(var.set_render_task(config[CONF_RENDER_CORE]))
+    
+    # Memory diagnostic sensors
+    for key, setter in MEMORY_SENSOR_SETTERS.items():
+        if key in config.get(CONF_MEMORY, {}):
+            sens = await sensor.new_sensor(config[CONF_MEMORY][key])
+            cg.add(getattr(var, setter)(sens))
+    
+    # Boot timing diagnostic sensors
+    for key, setter in BOOT_SENSOR_SETTERS.items():
+        if key in config.get(CONF_BOOT, {}):
+            sens = await sensor.new_sensor(config[CONF_BOOT][key])
+            cg.add(getattr(var, setter)(sens))
+    
+    if CONF_LOOP_STALL in config:
+        sens = await sensor.new_sensor(config[CONF_LOOP_STALL])
+        cg.add(var.set_loop_stall_sensor(sens))
     
     # Time source for idle screen
     if CONF_TIME_ID in config:
@@ -364,8 +1126,7 @@ async def to_code(config):
         cg.add(var.set_time(time_var))
     
     # Language setting
-    lang = config.get(CONF_LANGUAGE, "en")
-    cg.add(var.set_language(lang))
+    cg.add(var.set_language(config[CONF_LANGUAGE]))
 
     # Custom fonts for French accents support
     if CONF_FONT_14 in config:
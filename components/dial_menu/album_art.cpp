@@ -0,0 +1,124 @@
+/**
+ * @file album_art.cpp
+ * @brief Implementation of the album art LRU cache
+ */
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DIAL_MENU_ALBUM_ART
+
+#include "album_art.h"
+#include "memory_policy.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace dial_menu {
+
+static const char *const TAG = "album_art";
+
+static const uint32_t RETRY_MIN_MS = 10 * 1000;
+static const uint32_t RETRY_MAX_MS = 10 * 60 * 1000;
+
+const lv_img_dsc_t *AlbumArtCache::find(const std::string &url) {
+  if (url.empty()) return nullptr;
+
+  for (auto &slot : this->slots_) {
+    if (slot.data != nullptr && slot.url == url) {
+      slot.last_used = ++this->use_counter_;
+      this->hits_++;
+      return &slot.dsc;
+    }
+  }
+  this->misses_++;
+  return nullptr;
+}
+
+const lv_img_dsc_t *AlbumArtCache::store(const std::string &url, const lv_img_dsc_t *src) {
+  if (url.empty() || src == nullptr || src->data == nullptr || this->slots_.empty()) {
+    return nullptr;
+  }
+
+  // Reuse the slot already holding this URL, otherwise evict the least recently used one
+  Slot *target = &this->slots_[0];
+  for (auto &slot : this->slots_) {
+    if (slot.data != nullptr && slot.url == url) {
+      target = &slot;
+      break;
+    }
+    if (slot.last_used < target->last_used) {
+      target = &slot;
+    }
+  }
+
+  // Slots are allocated once; the cache is cold data, PSRAM with internal RAM as the fallback
+  if (target->capacity < src->data_size) {
+    MemoryPolicy::deallocate(target->data, target->capacity);
+    target->data = static_cast<uint8_t *>(MemoryPolicy::allocate(Placement::COLD, src->data_size));
+    target->capacity = target->data != nullptr ? src->data_size : 0;
+    if (target->data == nullptr) {
+      ESP_LOGW(TAG, "Could not allocate %u bytes for album art", (unsigned) src->data_size);
+      return nullptr;
+    }
+  }
+
+  memcpy(target->data, src->data, src->data_size);
+  target->dsc.header = src->header;
+  target->dsc.data_size = src->data_size;
+  target->dsc.data = target->data;
+  target->url = url;
+  target->last_used = ++this->use_counter_;
+
+  // Downloaded after all: no more backoff
+  this->failed_.erase(std::remove_if(this->failed_.begin(), this->failed_.end(),
+                                     [&url](const Failure &failure) { return failure.url == url; }),
+                      this->failed_.end());
+
+  // The slot may be displayed already with older content
+  lv_img_cache_invalidate_src(&target->dsc);
+
+  ESP_LOGD(TAG, "Cached album art %dx%d (%u bytes)", target->dsc.header.w, target->dsc.header.h,
+           (unsigned) target->dsc.data_size);
+  return &target->dsc;
+}
+
+const AlbumArtCache::Failure *AlbumArtCache::find_failure_(const std::string &url) const {
+  for (const auto &failure : this->failed_) {
+    if (failure.url == url) return &failure;
+  }
+  return nullptr;
+}
+
+void AlbumArtCache::mark_failed(const std::string &url, uint32_t now) {
+  if (url.empty()) return;
+  this->failures_++;
+  for (auto &failure : this->failed_) {
+    if (failure.url != url) continue;
+    failure.failed_at = now;
+    failure.backoff_ms = std::min(failure.backoff_ms * 2, RETRY_MAX_MS);
+    ESP_LOGW(TAG, "Album art failed again, next try in %u s", (unsigned) (failure.backoff_ms / 1000));
+    return;
+  }
+
+  Failure failure{url, now, RETRY_MIN_MS};
+  size_t limit = std::max<size_t>(1, this->slots_.size());
+  if (this->failed_.size() < limit) {
+    this->failed_.push_back(std::move(failure));
+    return;
+  }
+  auto oldest = std::min_element(this->failed_.begin(), this->failed_.end(), [now](const Failure &a, const Failure &b) {
+    return now - a.failed_at > now - b.failed_at;
+  });
+  *oldest = std::move(failure);
+}
+
+bool AlbumArtCache::can_download(const std::string &url, uint32_t now) const {
+  const Failure *failure = this->find_failure_(url);
+  return failure == nullptr || now - failure->failed_at >= failure->backoff_ms;
+}
+
+}  // namespace dial_menu
+}  // namespace esphome
+
+#endif  // USE_DIAL_MENU_ALBUM_ART
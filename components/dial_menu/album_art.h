@@ -0,0 +1,78 @@
+/**
+ * @file album_art.h
+ * @brief Small LRU cache of decoded album art, kept in PSRAM
+ *
+ * Album art is fetched and decoded by an ESPHome online_image (JPEG, resized
+ * to the art size while decoding). Decoded frames are copied into a handful of
+ * fixed slots keyed by the picture URL, so skipping back and forth between
+ * tracks shows the art instantly without a new download. A URL whose download
+ * failed is not requested again until its backoff (doubling from 10 s to
+ * 10 min) has passed.
+ *
+ * Decoding is online_image's: the compressed picture is downloaded whole
+ * before it is decoded, there is no streamed decode.
+ */
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DIAL_MENU_ALBUM_ART
+
+#include "esphome/components/lvgl/lvgl_esphome.h"
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace dial_menu {
+
+class AlbumArtCache {
+ public:
+  // Number of decoded images to keep (each slot holds one RGB565 frame)
+  void set_capacity(size_t capacity) { this->slots_.resize(capacity); }
+  size_t get_capacity() const { return this->slots_.size(); }
+
+  // Returns the cached image for this URL (and marks it as most recently used), or nullptr
+  const lv_img_dsc_t *find(const std::string &url);
+
+  // Copies a decoded image into the least recently used slot and returns the cached copy
+  const lv_img_dsc_t *store(const std::string &url, const lv_img_dsc_t *src);
+
+  // A download of this URL failed at `now` (millis)
+  void mark_failed(const std::string &url, uint32_t now);
+  // False while a failed URL is backing off
+  bool can_download(const std::string &url, uint32_t now) const;
+
+  // Cache statistics for dump_config
+  uint32_t get_hits() const { return this->hits_; }
+  uint32_t get_misses() const { return this->misses_; }
+  uint32_t get_failures() const { return this->failures_; }
+
+ protected:
+  struct Slot {
+    std::string url;
+    uint32_t last_used{0};
+    uint8_t *data{nullptr};
+    size_t capacity{0};
+    lv_img_dsc_t dsc{};
+  };
+
+  struct Failure {
+    std::string url;
+    uint32_t failed_at;
+    uint32_t backoff_ms;
+  };
+  const Failure *find_failure_(const std::string &url) const;
+
+  std::vector<Slot> slots_;
+  // As many as there are slots, the oldest one replaced
+  std::vector<Failure> failed_;
+  uint32_t use_counter_{0};
+  uint32_t hits_{0};
+  uint32_t misses_{0};
+  uint32_t failures_{0};
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
+
+#endif  // USE_DIAL_MENU_ALBUM_ART
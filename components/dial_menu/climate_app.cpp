@@ -14,21 +14,15 @@ namespace dial_menu {
 
 static const char *const TAG = "climate_app";
 
-// Store app pointer for static callback
-static ClimateApp *g_current_climate_app = nullptr;
-
-// Debounce delay in ms before applying temperature change
-static const uint32_t TEMP_CHANGE_DEBOUNCE_MS = 800;
-
 void ClimateApp::on_enter() {
-  ESP_LOGI(TAG, "Entering Climate App: %s", this->name_.c_str());
-  g_current_climate_app = this;
+  ESP_LOGI(TAG, "Entering Climate App: %s", this->name_);
+  this->active_ = true;
   
-  // Initialize pending temp from current target
+  // Initialize the dial target from the current target
   if (this->climate_ != nullptr) {
-    this->pending_target_temp_ = this->climate_->target_temperature;
+    this->refresh_traits_();
+    this->target_temp_ = this->climate_->target_temperature;
   }
-  this->has_pending_change_ = false;
   
   // Show the app page
   if (this->page_ != nullptr) {
@@ -38,14 +32,12 @@ void ClimateApp::on_enter() {
 }
 
 void ClimateApp::on_exit() {
-  ESP_LOGI(TAG, "Exiting Climate App: %s", this->name_.c_str());
+  ESP_LOGI(TAG, "Exiting Climate App: %s", this->name_);
   
   // Apply any pending change before leaving
-  if (this->has_pending_change_) {
-    this->apply_pending_change();
-  }
+  this->temp_committer_.flush();
   
-  g_current_climate_app = nullptr;
+  this->active_ = false;
 }
 
 void ClimateApp::on_button_press() {
@@ -67,17 +59,15 @@ void ClimateApp::on_encoder_rotate(int delta) {
 void ClimateApp::increase_temperature() {
   if (this->climate_ == nullptr) return;
   
-  float new_temp = this->pending_target_temp_ + this->temperature_step_;
+  float new_temp = this->target_temp_ + this->temperature_step_;
   
   // Clamp to max
-  auto traits = this->climate_->get_traits();
-  if (new_temp > traits.get_visual_max_temperature()) {
-    new_temp = traits.get_visual_max_temperature();
+  if (new_temp > this->traits_.get_visual_max_temperature()) {
+    new_temp = this->traits_.get_visual_max_temperature();
   }
   
-  this->pending_target_temp_ = new_temp;
-  this->has_pending_change_ = true;
-  this->last_encoder_time_ = millis();
+  this->target_temp_ = new_temp;
+  this->temp_committer_.update(new_temp);
   
   ESP_LOGD(TAG, "Target temperature increased to: %.1f (pending)", new_temp);
   this->update_state();
@@ -86,17 +76,15 @@ void ClimateApp::increase_temperature() {
 void ClimateApp::decrease_temperature() {
   if (this->climate_ == nullptr) return;
   
-  float new_temp = this->pending_target_temp_ - this->temperature_step_;
+  float new_temp = this->target_temp_ - this->temperature_step_;
   
   // Clamp to min
-  auto traits = this->climate_->get_traits();
-  if (new_temp < traits.get_visual_min_temperature()) {
-    new_temp = traits.get_visual_min_temperature();
+  if (new_temp < this->traits_.get_visual_min_temperature()) {
+    new_temp = this->traits_.get_visual_min_temperature();
   }
   
-  this->pending_target_temp_ = new_temp;
-  this->has_pending_change_ = true;
-  this->last_encoder_time_ = millis();
+  this->target_temp_ = new_temp;
+  this->temp_committer_.update(new_temp);
   
   ESP_LOGD(TAG, "Target temperature decreased to: %.1f (pending)", new_temp);
   this->update_state();
@@ -104,6 +92,10 @@ void ClimateApp::decrease_temperature() {
 
 void ClimateApp::set_target_temperature(float temp) {
   if (this->climate_ == nullptr) return;
+  if (this->defer_to_main_(this, [](void *app, int32_t, float temp) {
+        static_cast<ClimateApp *>(app)->set_target_temperature(temp);
+      }, 0, temp))
+    return;
   
   ESP_LOGI(TAG, "Setting target temperature to: %.1f", temp);
   
@@ -112,19 +104,17 @@ void ClimateApp::set_target_temperature(float temp) {
   call.perform();
 }
 
-void ClimateApp::apply_pending_change() {
-  if (!this->has_pending_change_ || this->climate_ == nullptr) return;
-  
-  ESP_LOGI(TAG, "Applying pending temperature: %.1f", this->pending_target_temp_);
-  this->set_target_temperature(this->pending_target_temp_);
-  this->has_pending_change_ = false;
+void ClimateApp::on_temperature_commit_(float temp) {
+  ESP_LOGI(TAG, "Applying pending temperature: %.1f", temp);
+  this->set_target_temperature(temp);
+  // Drop the "pending" highlight
+  this->update_state();
 }
 
 void ClimateApp::toggle_mode() {
   if (this->climate_ == nullptr) return;
   
-  auto traits = this->climate_->get_traits();
-  auto modes = traits.get_supported_modes();
+  auto modes = this->traits_.get_supported_modes();
   
   // Find current mode index
   climate::ClimateMode current = this->climate_->mode;
@@ -139,6 +129,7 @@ void ClimateApp::toggle_mode() {
   }
   
   // Move to next mode
+  if (modes.empty()) return;
   int next_idx = (current_idx + 1) % modes.size();
   i = 0;
   for (auto mode : modes) {
@@ -152,6 +143,10 @@ void ClimateApp::toggle_mode() {
 
 void ClimateApp::set_mode(climate::ClimateMode mode) {
   if (this->climate_ == nullptr) return;
+  if (this->defer_to_main_(this, [](void *app, int32_t mode, float) {
+        static_cast<ClimateApp *>(app)->set_mode(static_cast<climate::ClimateMode>(mode));
+      }, mode))
+    return;
   
   ESP_LOGI(TAG, "Setting mode to: %s", climate::climate_mode_to_string(mode));
   
@@ -161,7 +156,7 @@ void ClimateApp::set_mode(climate::ClimateMode mode) {
 }
 
 void ClimateApp::create_app_ui() {
-  ESP_LOGI(TAG, "Creating UI for Climate App: %s", this->name_.c_str());
+  ESP_LOGI(TAG, "Creating UI for Climate App: %s", this->name_);
   
   // Create a new screen/page for this app
   this->page_ = lv_obj_create(nullptr);
@@ -173,61 +168,63 @@ void ClimateApp::create_app_ui() {
   
   // Climate name at top
   this->name_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->name_label_, LV_ALIGN_TOP_MID, 0, 25);
+  lv_obj_align(this->name_label_, LV_ALIGN_TOP_MID, 0, this->px(25));
   lv_obj_set_style_text_color(this->name_label_, lv_color_hex(0xFFFFFF), 0);
   lv_obj_set_style_text_font(this->name_label_, font_14, 0);
-  lv_label_set_text(this->name_label_, this->name_.c_str());
+  lv_label_set_text(this->name_label_, this->name_);
   
   // Temperature arc (background)
   this->temp_arc_ = lv_arc_create(this->page_);
-  lv_obj_set_size(this->temp_arc_, 180, 180);
-  lv_obj_align(this->temp_arc_, LV_ALIGN_CENTER, 0, 5);
+  lv_obj_set_size(this->temp_arc_, this->px(180), this->px(180));
+  lv_obj_align(this->temp_arc_, LV_ALIGN_CENTER, 0, this->px(5));
   lv_arc_set_rotation(this->temp_arc_, 135);
   lv_arc_set_bg_angles(this->temp_arc_, 0, 270);
   lv_arc_set_range(this->temp_arc_, 7, 35);  // 7-35°C range
+  this->arc_min_ = 7;
+  this->arc_max_ = 35;
   lv_arc_set_value(this->temp_arc_, 20);
   lv_obj_remove_style(this->temp_arc_, NULL, LV_PART_KNOB);
   lv_obj_clear_flag(this->temp_arc_, LV_OBJ_FLAG_CLICKABLE);
-  lv_obj_set_style_arc_width(this->temp_arc_, 12, LV_PART_MAIN);
-  lv_obj_set_style_arc_width(this->temp_arc_, 12, LV_PART_INDICATOR);
+  lv_obj_set_style_arc_width(this->temp_arc_, this->px(12), LV_PART_MAIN);
+  lv_obj_set_style_arc_width(this->temp_arc_, this->px(12), LV_PART_INDICATOR);
   lv_obj_set_style_arc_color(this->temp_arc_, lv_color_hex(0x333333), LV_PART_MAIN);
   lv_obj_set_style_arc_color(this->temp_arc_, lv_color_hex(0xEB8429), LV_PART_INDICATOR);
   
   // Target temperature (large, center)
   this->target_temp_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->target_temp_label_, LV_ALIGN_CENTER, 0, -15);
+  lv_obj_align(this->target_temp_label_, LV_ALIGN_CENTER, 0, this->px(-15));
   lv_obj_set_style_text_color(this->target_temp_label_, lv_color_hex(0xFFFFFF), 0);
   lv_obj_set_style_text_font(this->target_temp_label_, &lv_font_montserrat_48, 0);
   lv_label_set_text(this->target_temp_label_, "--");
   
   // Unit label (°C)
   this->unit_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->unit_label_, LV_ALIGN_CENTER, 50, -25);
+  lv_obj_align(this->unit_label_, LV_ALIGN_CENTER, this->px(50), this->px(-25));
   lv_obj_set_style_text_color(this->unit_label_, lv_color_hex(0x888888), 0);
   lv_obj_set_style_text_font(this->unit_label_, font_18, 0);
   lv_label_set_text(this->unit_label_, "°C");
   
   // Current temperature (smaller, below target)
   this->current_temp_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->current_temp_label_, LV_ALIGN_CENTER, 0, 25);
+  lv_obj_align(this->current_temp_label_, LV_ALIGN_CENTER, 0, this->px(25));
   lv_obj_set_style_text_color(this->current_temp_label_, lv_color_hex(0xAAAAAA), 0);
   lv_obj_set_style_text_font(this->current_temp_label_, font_14, 0);
-  lv_label_set_text(this->current_temp_label_, "Actuel: --°C");
+  lv_label_set_text(this->current_temp_label_, "");
   
   // Action label (Heating, Cooling, Idle)
   this->action_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->action_label_, LV_ALIGN_CENTER, 0, 45);
+  lv_obj_align(this->action_label_, LV_ALIGN_CENTER, 0, this->px(45));
   lv_obj_set_style_text_color(this->action_label_, lv_color_hex(0xEB8429), 0);
   lv_obj_set_style_text_font(this->action_label_, font_14, 0);
   lv_label_set_text(this->action_label_, "");
   
   // Mode button at bottom
   this->mode_btn_ = lv_btn_create(this->page_);
-  lv_obj_set_size(this->mode_btn_, 80, 36);
-  lv_obj_align(this->mode_btn_, LV_ALIGN_BOTTOM_MID, 0, -20);
-  lv_obj_set_style_radius(this->mode_btn_, 18, 0);
+  lv_obj_set_size(this->mode_btn_, this->px(80), this->px(36));
+  lv_obj_align(this->mode_btn_, LV_ALIGN_BOTTOM_MID, 0, this->px(-20));
+  lv_obj_set_style_radius(this->mode_btn_, this->px(18), 0);
   lv_obj_set_style_bg_color(this->mode_btn_, lv_color_hex(0x333333), 0);
-  lv_obj_set_style_border_width(this->mode_btn_, 2, 0);
+  lv_obj_set_style_border_width(this->mode_btn_, this->px(2), 0);
   lv_obj_set_style_border_color(this->mode_btn_, lv_color_hex(0x555555), 0);
   lv_obj_set_user_data(this->mode_btn_, this);
   lv_obj_add_event_cb(this->mode_btn_, mode_btn_event_cb, LV_EVENT_CLICKED, nullptr);
@@ -236,25 +233,33 @@ void ClimateApp::create_app_ui() {
   lv_obj_center(this->mode_label_);
   lv_obj_set_style_text_color(this->mode_label_, lv_color_hex(0xFFFFFF), 0);
   lv_obj_set_style_text_font(this->mode_label_, font_14, 0);
-  lv_label_set_text(this->mode_label_, "OFF");
+  lv_label_set_text(this->mode_label_, this->tr(StringId::CLIMATE_MODE_OFF));
   
   // Register state callback
   if (this->climate_ != nullptr) {
     this->climate_->add_on_state_callback([this](climate::Climate &) {
-      if (g_current_climate_app == this) {
+      this->run_ui_(this, [](void *ctx, int32_t, float) {
+        auto *app = static_cast<ClimateApp *>(ctx);
+        if (!app->active_) return;
         ESP_LOGD(TAG, "Climate state changed, refreshing UI");
-        // Update pending temp if no pending change
-        if (!this->has_pending_change_) {
-          this->pending_target_temp_ = this->climate_->target_temperature;
+        app->refresh_traits_();
+        // Follow the entity unless the user is changing the target
+        if (!app->temp_committer_.has_pending()) {
+          app->target_temp_ = app->climate_->target_temperature;
         }
-        this->update_state();
-      }
+        app->update_state();
+      });
     });
     
-    // Initialize pending temp
-    this->pending_target_temp_ = this->climate_->target_temperature;
+    // Initialize traits and dial target
+    this->refresh_traits_();
+    this->target_temp_ = this->climate_->target_temperature;
   }
   
+  this->temp_committer_.set_debounce(TEMP_DEBOUNCE_MS);
+  this->temp_committer_.set_max_latency(TEMP_MAX_LATENCY_MS);
+  this->temp_committer_.set_min_interval(TEMP_MIN_INTERVAL_MS);
+  
   // Set initial state
   this->update_state();
   
@@ -266,14 +271,10 @@ void ClimateApp::update_state() {
     return;
   }
   
-  // Check if we should apply pending change (debounce)
-  if (this->has_pending_change_ && (millis() - this->last_encoder_time_ > TEMP_CHANGE_DEBOUNCE_MS)) {
-    this->apply_pending_change();
-  }
-  
   // Get climate state
   float current_temp = this->climate_->current_temperature;
-  float target_temp = this->has_pending_change_ ? this->pending_target_temp_ : this->climate_->target_temperature;
+  bool pending = this->temp_committer_.has_pending();
+  float target_temp = pending ? this->target_temp_ : this->climate_->target_temperature;
   climate::ClimateMode mode = this->climate_->mode;
   climate::ClimateAction action = this->climate_->action;
   
@@ -284,7 +285,7 @@ void ClimateApp::update_state() {
     lv_label_set_text(this->target_temp_label_, buf);
     
     // Show different color when pending
-    if (this->has_pending_change_) {
+    if (pending) {
       lv_obj_set_style_text_color(this->target_temp_label_, lv_color_hex(0xFFFF00), 0);  // Yellow when pending
     } else {
       lv_obj_set_style_text_color(this->target_temp_label_, lv_color_hex(0xFFFFFF), 0);
@@ -293,21 +294,26 @@ void ClimateApp::update_state() {
   
   // Update current temperature label
   if (this->current_temp_label_ != nullptr) {
-    char buf[20];
+    char buf[32];
+    const char *current = this->tr(StringId::CLIMATE_CURRENT);
     if (!std::isnan(current_temp)) {
-      snprintf(buf, sizeof(buf), "Actuel: %.1f°C", current_temp);
+      snprintf(buf, sizeof(buf), "%s: %.1f°C", current, current_temp);
     } else {
-      snprintf(buf, sizeof(buf), "Actuel: --°C");
+      snprintf(buf, sizeof(buf), "%s: --°C", current);
     }
     lv_label_set_text(this->current_temp_label_, buf);
   }
   
   // Update arc
   if (this->temp_arc_ != nullptr) {
-    auto traits = this->climate_->get_traits();
-    lv_arc_set_range(this->temp_arc_, 
-                     (int)traits.get_visual_min_temperature(), 
-                     (int)traits.get_visual_max_temperature());
+    // Only touch the range when the traits changed (it invalidates the whole arc)
+    int arc_min = (int)this->traits_.get_visual_min_temperature();
+    int arc_max = (int)this->traits_.get_visual_max_temperature();
+    if (arc_min != this->arc_min_ || arc_max != this->arc_max_) {
+      lv_arc_set_range(this->temp_arc_, arc_min, arc_max);
+      this->arc_min_ = arc_min;
+      this->arc_max_ = arc_max;
+    }
     lv_arc_set_value(this->temp_arc_, (int)target_temp);
     
     // Arc color based on action
@@ -352,41 +358,49 @@ void ClimateApp::update_state() {
            climate::climate_action_to_string(action));
 }
 
+void ClimateApp::refresh_traits_() {
+  if (this->climate_ == nullptr) return;
+  // State callbacks come with every attribute, the traits (and their sets) rarely change
+  uint32_t generation = this->climate_->get_traits_generation();
+  if (generation == this->traits_generation_) return;
+  this->traits_ = this->climate_->get_traits();
+  this->traits_generation_ = generation;
+}
+
 const char* ClimateApp::get_action_text(climate::ClimateAction action) {
   switch (action) {
     case climate::CLIMATE_ACTION_HEATING:
-      return "Chauffage...";
+      return this->tr(StringId::CLIMATE_HEATING);
     case climate::CLIMATE_ACTION_COOLING:
-      return "Refroidissement...";
+      return this->tr(StringId::CLIMATE_COOLING);
     case climate::CLIMATE_ACTION_IDLE:
-      return "En attente";
+      return this->tr(StringId::CLIMATE_IDLE);
     case climate::CLIMATE_ACTION_DRYING:
-      return "Séchage...";
+      return this->tr(StringId::CLIMATE_DRYING);
     case climate::CLIMATE_ACTION_FAN:
-      return "Ventilation...";
+      return this->tr(StringId::CLIMATE_FAN);
     case climate::CLIMATE_ACTION_OFF:
     default:
-      return "Arrêté";
+      return this->tr(StringId::CLIMATE_STOPPED);
   }
 }
 
 const char* ClimateApp::get_mode_text(climate::ClimateMode mode) {
   switch (mode) {
     case climate::CLIMATE_MODE_HEAT:
-      return "Chauff.";
+      return this->tr(StringId::CLIMATE_MODE_HEAT);
     case climate::CLIMATE_MODE_COOL:
-      return "Froid";
+      return this->tr(StringId::CLIMATE_MODE_COOL);
     case climate::CLIMATE_MODE_HEAT_COOL:
-      return "Auto";
     case climate::CLIMATE_MODE_AUTO:
-      return "Auto";
+      return this->tr(StringId::CLIMATE_MODE_AUTO);
     case climate::CLIMATE_MODE_DRY:
-      return "Sec";
+      return this->tr(StringId::CLIMATE_MODE_DRY);
     case climate::CLIMATE_MODE_FAN_ONLY:
-      return "Vent.";
+      return this->tr(StringId::CLIMATE_MODE_FAN);
     case climate::CLIMATE_MODE_OFF:
     default:
-      return "OFF";
+      return this->tr(StringId::CLIMATE_MODE_OFF);
   }
 }
 
@@ -14,7 +14,9 @@
 #ifdef USE_DIAL_MENU_CLIMATE
 
 #include "dial_menu_controller.h"
+#include "setpoint_committer.h"
 #include "esphome/components/climate/climate.h"
+#include "esphome/components/homeassistant_addon/climate/homeassistant_climate.h"
 #include "esphome/components/font/font.h"
 
 namespace esphome {
@@ -34,7 +36,14 @@ namespace dial_menu {
 class ClimateApp : public DialApp {
  public:
   // Set the climate entity to control
-  void set_climate(climate::Climate *climate) { this->climate_ = climate; }
+  void set_climate(homeassistant_addon::HomeassistantClimate *climate) { this->climate_ = climate; }
+  
+  // Controller runs the temperature commit timer
+  void set_controller(DialMenuController *controller) { this->temp_committer_.set_owner(controller); }
+  void set_render_task(RenderTask *task) override {
+    DialApp::set_render_task(task);
+    this->temp_committer_.set_render_task(task);
+  }
   
   // Set temperature step (how much each encoder click changes temp)
   void set_temperature_step(float step) { this->temperature_step_ = step; }
@@ -54,6 +63,7 @@ class ClimateApp : public DialApp {
   
   // Create the app's UI (called during setup)
   void create_app_ui() override;
+  void relabel() override { this->update_state(); }
   
   // Update UI to match current climate state
   void update_state();
@@ -71,17 +81,26 @@ class ClimateApp : public DialApp {
   lv_obj_t *get_page() const { return this->page_; }
 
  protected:
-  climate::Climate *climate_{nullptr};
+  homeassistant_addon::HomeassistantClimate *climate_{nullptr};
   float temperature_step_{0.5f};
+  bool active_{false};  // Page shown, state callbacks refresh the UI
   
   // Custom fonts (optional)
   font::Font *font_14_{nullptr};
   font::Font *font_18_{nullptr};
   
-  // Track pending temperature change for debouncing
-  float pending_target_temp_{0.0f};
-  uint32_t last_encoder_time_{0};
-  bool has_pending_change_{false};
+  // Target shown on the dial; sent by the committer (debounced, with a deadline)
+  float target_temp_{0.0f};
+  SetpointCommitter temp_committer_{[this](float temp) { this->on_temperature_commit_(temp); }};
+  static constexpr uint32_t TEMP_DEBOUNCE_MS = 800;
+  static constexpr uint32_t TEMP_MAX_LATENCY_MS = 3000;
+  static constexpr uint32_t TEMP_MIN_INTERVAL_MS = 1000;
+  
+  // Cached climate traits, copied again only when the climate rebuilt them
+  climate::ClimateTraits traits_;
+  uint32_t traits_generation_{0};
+  int arc_min_{0};
+  int arc_max_{0};
   
   // LVGL objects for this app's UI
   lv_obj_t *page_{nullptr};
@@ -105,8 +124,11 @@ class ClimateApp : public DialApp {
   const char* get_mode_icon(climate::ClimateMode mode);
   uint32_t get_action_color(climate::ClimateAction action);
   
-  // Apply pending temperature change
-  void apply_pending_change();
+  // Called by the committer with the temperature to send
+  void on_temperature_commit_(float temp);
+  
+  // Re-read the climate traits into the cache if they changed since the last read
+  void refresh_traits_();
 };
 
 }  // namespace dial_menu
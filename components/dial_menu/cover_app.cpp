@@ -8,30 +8,83 @@
 #ifdef USE_DIAL_MENU_COVER
 
 #include "cover_app.h"
+#include "esphome/core/helpers.h"
 
 namespace esphome {
 namespace dial_menu {
 
 static const char *const TAG = "cover_app";
 
-// Store app pointer for static callback
-static CoverApp *g_current_cover_app = nullptr;
-
-void CoverApp::add_cover(cover::Cover *cover, const std::string &name, uint32_t color) {
+void CoverApp::add_cover(cover::Cover *cover, const char *name, uint32_t color) {
   CoverItem item;
   item.cover = cover;
   item.name = name;
   item.color = color;
   this->covers_.push_back(item);
-  ESP_LOGD(TAG, "Added cover: %s (total: %d)", name.c_str(), this->covers_.size());
+  ESP_LOGD(TAG, "Added cover: %s (total: %u)", name, (unsigned) this->covers_.size());
+}
+
+#ifdef USE_DIAL_MENU_COVER_HA
+void CoverApp::add_homeassistant_cover(homeassistant_addon::HomeassistantCover *cover, const char *name,
+                                       uint32_t color) {
+  this->add_cover(cover, name, color);
+  this->covers_.back().ha_cover = cover;
+}
+#endif
+
+void CoverApp::add_cover_group(const char *name, uint32_t color, const std::vector<uint8_t> &members) {
+  CoverGroup group;
+  group.name = name;
+  group.color = color;
+  group.member_mask = 0;
+  for (uint8_t index : members) {
+    if (index >= this->covers_.size() || index >= MAX_COVERS) {
+      ESP_LOGW(TAG, "Group %s: cover index %u out of range", name, index);
+      continue;
+    }
+    group.members.push_back(index);
+    group.member_mask |= 1u << index;
+  }
+  this->groups_.push_back(group);
+  ESP_LOGD(TAG, "Added cover group: %s (%u covers)", name, (unsigned) group.members.size());
+}
+
+const CoverGroup *CoverApp::get_group_(int index) const {
+  if (index < (int) this->covers_.size()) {
+    return nullptr;
+  }
+  return &this->groups_[index - this->covers_.size()];
+}
+
+void CoverApp::aggregate_group_(const CoverGroup &group, float *position, cover::CoverOperation *operation) const {
+  float sum = 0.0f;
+  bool opening = false;
+  bool closing = false;
+  for (uint8_t index : group.members) {
+    const cover::Cover *member = this->covers_[index].cover;
+    sum += member->position;
+    opening |= member->current_operation == cover::COVER_OPERATION_OPENING;
+    closing |= member->current_operation == cover::COVER_OPERATION_CLOSING;
+  }
+  *position = group.members.empty() ? 0.0f : sum / group.members.size();
+  // Any moving member makes the group move, opening wins over closing
+  if (opening) {
+    *operation = cover::COVER_OPERATION_OPENING;
+  } else if (closing) {
+    *operation = cover::COVER_OPERATION_CLOSING;
+  } else {
+    *operation = cover::COVER_OPERATION_IDLE;
+  }
 }
 
 void CoverApp::on_enter() {
-  ESP_LOGI(TAG, "Entering Cover App: %s", this->name_.c_str());
-  g_current_cover_app = this;
+  ESP_LOGI(TAG, "Entering Cover App: %s", this->name_);
+  this->active_ = true;
   
   // Reset to stop action (middle button)
   this->selected_action_ = CoverAction::STOP;
+  this->mode_ = CoverMode::ACTIONS;
+  this->target_committer_.cancel();
   
   // Show the app page
   if (this->page_ != nullptr) {
@@ -43,22 +96,33 @@ void CoverApp::on_enter() {
 }
 
 void CoverApp::on_exit() {
-  ESP_LOGI(TAG, "Exiting Cover App: %s", this->name_.c_str());
-  g_current_cover_app = nullptr;
+  ESP_LOGI(TAG, "Exiting Cover App: %s", this->name_);
+  // Don't drop a target the user just dialled in
+  this->commit_target_();
+  this->active_ = false;
 }
 
 void CoverApp::on_button_press() {
   ESP_LOGD(TAG, "Button pressed in Cover App");
+  if (this->mode_ != CoverMode::ACTIONS) {
+    this->next_mode();
+    return;
+  }
   this->execute_action();
 }
 
 void CoverApp::on_encoder_rotate(int delta) {
   ESP_LOGD(TAG, "Encoder rotated: %d", delta);
   
+  if (this->mode_ != CoverMode::ACTIONS) {
+    this->adjust_target_(delta);
+    return;
+  }
+  
   // If multiple covers, rotate through them
   // If single cover or already rotating actions, change action
-  if (this->covers_.size() > 1) {
-    // Navigate between covers
+  if (this->get_entry_count_() > 1) {
+    // Navigate between covers (and groups)
     if (delta > 0) {
       this->next_cover();
     } else if (delta < 0) {
@@ -75,25 +139,30 @@ void CoverApp::on_encoder_rotate(int delta) {
 }
 
 void CoverApp::next_cover() {
-  if (this->covers_.size() <= 1) return;
+  size_t count = this->get_entry_count_();
+  if (count <= 1) return;
+  this->set_mode_(CoverMode::ACTIONS);
   
-  this->current_index_ = (this->current_index_ + 1) % this->covers_.size();
+  this->current_index_ = (this->current_index_ + 1) % count;
   ESP_LOGD(TAG, "Next cover: index=%d", this->current_index_);
   this->update_state();
   this->update_dots();
 }
 
 void CoverApp::previous_cover() {
-  if (this->covers_.size() <= 1) return;
+  size_t count = this->get_entry_count_();
+  if (count <= 1) return;
+  this->set_mode_(CoverMode::ACTIONS);
   
-  this->current_index_ = (this->current_index_ - 1 + this->covers_.size()) % this->covers_.size();
+  this->current_index_ = (this->current_index_ - 1 + count) % count;
   ESP_LOGD(TAG, "Previous cover: index=%d", this->current_index_);
   this->update_state();
   this->update_dots();
 }
 
 void CoverApp::select_cover(int index) {
-  if (index >= 0 && index < (int)this->covers_.size()) {
+  if (index >= 0 && index < (int) this->get_entry_count_()) {
+    this->set_mode_(CoverMode::ACTIONS);
     this->current_index_ = index;
     this->update_state();
     this->update_dots();
@@ -146,8 +215,121 @@ void CoverApp::execute_action() {
   }
 }
 
+bool CoverApp::mode_supported_(CoverMode mode) const {
+  if (mode == CoverMode::ACTIONS) {
+    return true;
+  }
+  // Setpoints are per cover, groups only get the actions
+  if (this->get_current_group_() != nullptr || this->covers_.empty()) {
+    return false;
+  }
+  cover::Cover *current = this->covers_[this->current_index_].cover;
+  if (current == nullptr) {
+    return false;
+  }
+  auto traits = current->get_traits();
+  return mode == CoverMode::POSITION ? traits.get_supports_position() : traits.get_supports_tilt();
+}
+
+void CoverApp::next_mode() {
+  CoverMode mode = this->mode_;
+  do {
+    switch (mode) {
+      case CoverMode::ACTIONS:
+        mode = CoverMode::POSITION;
+        break;
+      case CoverMode::POSITION:
+        mode = CoverMode::TILT;
+        break;
+      case CoverMode::TILT:
+        mode = CoverMode::ACTIONS;
+        break;
+    }
+  } while (!this->mode_supported_(mode));
+  this->set_mode_(mode);
+}
+
+void CoverApp::set_mode_(CoverMode mode) {
+  // Leaving a setpoint mode sends whatever is still pending
+  this->commit_target_();
+  if (mode == this->mode_) {
+    return;
+  }
+  this->mode_ = mode;
+  this->target_ = this->get_live_value_();
+  ESP_LOGD(TAG, "Mode: %d", (int) mode);
+  this->update_state();
+  this->update_action_focus();
+}
+
+float CoverApp::get_live_value_() const {
+  if (this->get_current_group_() != nullptr || this->covers_.empty()) {
+    return 0.0f;
+  }
+  const cover::Cover *current = this->covers_[this->current_index_].cover;
+  if (current == nullptr) {
+    return 0.0f;
+  }
+  return this->mode_ == CoverMode::TILT ? current->tilt : current->position;
+}
+
+void CoverApp::adjust_target_(int delta) {
+  if (delta == 0) return;
+  
+  this->target_ = clamp(this->target_ + delta * this->position_step_, 0.0f, 1.0f);
+  // Only the value the dial settles on is sent
+  this->target_committer_.update(this->target_);
+  
+  // Immediate visual feedback, the cover catches up after the commit
+  this->update_state();
+}
+
+void CoverApp::commit_target_() {
+  this->target_committer_.flush();
+}
+
+void CoverApp::send_target_(int index, CoverMode mode, float target) {
+  // The render task may have moved to another cover or mode by the time the main loop runs this:
+  // both travel packed in the command's argument
+  if (this->defer_to_main_(this, [](void *app, int32_t arg, float target) {
+        static_cast<CoverApp *>(app)->send_target_(arg >> 2, static_cast<CoverMode>(arg & 3), target);
+      }, (index << 2) | static_cast<int32_t>(mode), target))
+    return;
+  if (this->get_group_(index) != nullptr || this->covers_.empty()) {
+    return;
+  }
+  CoverItem &current = this->covers_[index];
+  if (current.cover == nullptr) {
+    return;
+  }
+  
+  auto call = current.cover->make_call();
+  if (mode == CoverMode::TILT) {
+    ESP_LOGI(TAG, "Setting tilt of %s to %.0f%%", current.name, target * 100);
+    call.set_tilt(target);
+  } else {
+    ESP_LOGI(TAG, "Setting position of %s to %.0f%%", current.name, target * 100);
+    call.set_position(target);
+  }
+  call.perform();
+}
+
+void CoverApp::update_target_marker_() {
+  if (this->target_arc_ == nullptr) {
+    return;
+  }
+  if (this->mode_ == CoverMode::ACTIONS) {
+    lv_obj_add_flag(this->target_arc_, LV_OBJ_FLAG_HIDDEN);
+    return;
+  }
+  // Short segment centred on the target angle (the arc spans 270 degrees)
+  int angle = (int)(this->target_ * 270);
+  lv_arc_set_angles(this->target_arc_, angle > 3 ? angle - 3 : 0, angle < 267 ? angle + 3 : 270);
+  lv_obj_clear_flag(this->target_arc_, LV_OBJ_FLAG_HIDDEN);
+}
+
 void CoverApp::create_app_ui() {
-  ESP_LOGI(TAG, "Creating UI for Cover App: %s (%d covers)", this->name_.c_str(), this->covers_.size());
+  ESP_LOGI(TAG, "Creating UI for Cover App: %s (%d covers)", this->name_, (int) this->covers_.size());
   
   // Create a new screen/page for this app
   this->page_ = lv_obj_create(nullptr);
@@ -158,45 +340,68 @@ void CoverApp::create_app_ui() {
   
   // Cover name at top
   this->name_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->name_label_, LV_ALIGN_TOP_MID, 0, 30);
+  lv_obj_align(this->name_label_, LV_ALIGN_TOP_MID, 0, this->px(30));
   lv_obj_set_style_text_color(this->name_label_, lv_color_hex(0xFFFFFF), 0);
   lv_obj_set_style_text_font(this->name_label_, font_14, 0);
-  lv_label_set_text(this->name_label_, this->name_.c_str());
+  lv_label_set_text(this->name_label_, this->name_);
   
   // Position arc in center (visual indicator of cover position)
   this->position_arc_ = lv_arc_create(this->page_);
-  lv_obj_set_size(this->position_arc_, 100, 100);
-  lv_obj_align(this->position_arc_, LV_ALIGN_CENTER, 0, -15);
+  lv_obj_set_size(this->position_arc_, this->px(100), this->px(100));
+  lv_obj_align(this->position_arc_, LV_ALIGN_CENTER, 0, this->px(-15));
   lv_arc_set_rotation(this->position_arc_, 135);
   lv_arc_set_bg_angles(this->position_arc_, 0, 270);
   lv_arc_set_value(this->position_arc_, 0);
   lv_obj_remove_style(this->position_arc_, NULL, LV_PART_KNOB);
   lv_obj_clear_flag(this->position_arc_, LV_OBJ_FLAG_CLICKABLE);
-  lv_obj_set_style_arc_width(this->position_arc_, 8, LV_PART_MAIN);
-  lv_obj_set_style_arc_width(this->position_arc_, 8, LV_PART_INDICATOR);
+  lv_obj_set_style_arc_width(this->position_arc_, this->px(8), LV_PART_MAIN);
+  lv_obj_set_style_arc_width(this->position_arc_, this->px(8), LV_PART_INDICATOR);
   lv_obj_set_style_arc_color(this->position_arc_, lv_color_hex(0x333333), LV_PART_MAIN);
   lv_obj_set_style_arc_color(this->position_arc_, lv_color_hex(0x03A964), LV_PART_INDICATOR);
   
-  // Position percentage label inside arc
+  // Target marker on top of the position arc (only the indicator is drawn)
+  this->target_arc_ = lv_arc_create(this->page_);
+  lv_obj_set_size(this->target_arc_, this->px(100), this->px(100));
+  lv_obj_align(this->target_arc_, LV_ALIGN_CENTER, 0, this->px(-15));
+  lv_arc_set_rotation(this->target_arc_, 135);
+  lv_arc_set_bg_angles(this->target_arc_, 0, 270);
+  lv_obj_remove_style(this->target_arc_, NULL, LV_PART_KNOB);
+  lv_obj_clear_flag(this->target_arc_, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_style_arc_opa(this->target_arc_, LV_OPA_TRANSP, LV_PART_MAIN);
+  lv_obj_set_style_arc_width(this->target_arc_, this->px(14), LV_PART_INDICATOR);
+  lv_obj_set_style_arc_rounded(this->target_arc_, false, LV_PART_INDICATOR);
+  lv_obj_set_style_arc_color(this->target_arc_, lv_color_hex(0xFFFFFF), LV_PART_INDICATOR);
+  lv_obj_set_style_arc_opa(this->target_arc_, LV_OPA_70, LV_PART_INDICATOR);
+  lv_obj_add_flag(this->target_arc_, LV_OBJ_FLAG_HIDDEN);
+  
+  // Position percentage label inside arc (tap to switch position / tilt mode)
   this->position_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->position_label_, LV_ALIGN_CENTER, 0, -20);
+  lv_obj_align(this->position_label_, LV_ALIGN_CENTER, 0, this->px(-20));
   lv_obj_set_style_text_color(this->position_label_, lv_color_hex(0xFFFFFF), 0);
   lv_obj_set_style_text_font(this->position_label_, &lv_font_montserrat_28, 0);
   lv_label_set_text(this->position_label_, "--");
+  lv_obj_add_flag(this->position_label_, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_ext_click_area(this->position_label_, this->px(20));
+  lv_obj_set_user_data(this->position_label_, this);
+  lv_obj_add_event_cb(this->position_label_, position_label_event_cb, LV_EVENT_CLICKED, nullptr);
+  
+  // Commit on rest only: no deadline while the dial keeps turning
+  this->target_committer_.set_debounce(REST_DELAY_MS);
+  this->target_committer_.set_max_latency(0);
   
   // Status label (Open/Closed/Opening/Closing)
   this->status_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->status_label_, LV_ALIGN_CENTER, 0, 15);
+  lv_obj_align(this->status_label_, LV_ALIGN_CENTER, 0, this->px(15));
   lv_obj_set_style_text_color(this->status_label_, lv_color_hex(0xAAAAAA), 0);
   lv_obj_set_style_text_font(this->status_label_, font_14, 0);
   lv_label_set_text(this->status_label_, "");
   
   // Action buttons row at bottom
-  int btn_size = 50;
-  int btn_spacing = 20;
+  int btn_size = this->px(50);
+  int btn_spacing = this->px(20);
   int total_width = btn_size * 3 + btn_spacing * 2;
   int start_x = -total_width / 2 + btn_size / 2;
-  int btn_y = 75;
+  int btn_y = this->px(75);
   
   // Open button (up arrow)
   this->btn_open_ = lv_btn_create(this->page_);
@@ -204,7 +409,7 @@ void CoverApp::create_app_ui() {
   lv_obj_align(this->btn_open_, LV_ALIGN_CENTER, start_x, btn_y);
   lv_obj_set_style_radius(this->btn_open_, btn_size / 2, 0);
   lv_obj_set_style_bg_color(this->btn_open_, lv_color_hex(0x03A964), 0);
-  lv_obj_set_style_border_width(this->btn_open_, 2, 0);
+  lv_obj_set_style_border_width(this->btn_open_, this->px(2), 0);
   lv_obj_set_style_border_color(this->btn_open_, lv_color_hex(0x03A964), 0);
   lv_obj_set_user_data(this->btn_open_, this);
   lv_obj_add_event_cb(this->btn_open_, btn_open_event_cb, LV_EVENT_CLICKED, nullptr);
@@ -220,7 +425,7 @@ void CoverApp::create_app_ui() {
   lv_obj_align(this->btn_stop_, LV_ALIGN_CENTER, start_x + btn_size + btn_spacing, btn_y);
   lv_obj_set_style_radius(this->btn_stop_, btn_size / 2, 0);
   lv_obj_set_style_bg_color(this->btn_stop_, lv_color_hex(0xEB8429), 0);
-  lv_obj_set_style_border_width(this->btn_stop_, 2, 0);
+  lv_obj_set_style_border_width(this->btn_stop_, this->px(2), 0);
   lv_obj_set_style_border_color(this->btn_stop_, lv_color_hex(0xEB8429), 0);
   lv_obj_set_user_data(this->btn_stop_, this);
   lv_obj_add_event_cb(this->btn_stop_, btn_stop_event_cb, LV_EVENT_CLICKED, nullptr);
@@ -236,7 +441,7 @@ void CoverApp::create_app_ui() {
   lv_obj_align(this->btn_close_, LV_ALIGN_CENTER, start_x + (btn_size + btn_spacing) * 2, btn_y);
   lv_obj_set_style_radius(this->btn_close_, btn_size / 2, 0);
   lv_obj_set_style_bg_color(this->btn_close_, lv_color_hex(0xFD5C4C), 0);
-  lv_obj_set_style_border_width(this->btn_close_, 2, 0);
+  lv_obj_set_style_border_width(this->btn_close_, this->px(2), 0);
   lv_obj_set_style_border_color(this->btn_close_, lv_color_hex(0xFD5C4C), 0);
   lv_obj_set_user_data(this->btn_close_, this);
   lv_obj_add_event_cb(this->btn_close_, btn_close_event_cb, LV_EVENT_CLICKED, nullptr);
@@ -246,25 +451,27 @@ void CoverApp::create_app_ui() {
   lv_obj_center(label_close);
   lv_obj_set_style_text_color(label_close, lv_color_hex(0xFFFFFF), 0);
   
-  // Dots indicator (pagination) - only if multiple covers
-  if (this->covers_.size() > 1) {
+  // Dots indicator (pagination) - only if multiple covers or groups
+  size_t entry_count = this->get_entry_count_();
+  if (entry_count > 1) {
     this->dots_container_ = lv_obj_create(this->page_);
-    int container_width = this->covers_.size() * 16;
-    lv_obj_set_size(this->dots_container_, container_width, 12);
-    lv_obj_align(this->dots_container_, LV_ALIGN_BOTTOM_MID, 0, -10);
+    int dot_size = this->px(8);
+    int dot_spacing = this->px(16);
+    int container_width = entry_count * dot_spacing;
+    lv_obj_set_size(this->dots_container_, container_width, this->px(12));
+    lv_obj_align(this->dots_container_, LV_ALIGN_BOTTOM_MID, 0, this->px(-10));
     lv_obj_set_style_bg_opa(this->dots_container_, LV_OPA_TRANSP, 0);
     lv_obj_set_style_border_width(this->dots_container_, 0, 0);
     lv_obj_set_style_pad_all(this->dots_container_, 0, 0);
     lv_obj_clear_flag(this->dots_container_, LV_OBJ_FLAG_SCROLLABLE);
     
-    // Create dots for each cover
-    int dot_spacing = 16;
-    int start_dot_x = (container_width - (this->covers_.size() * dot_spacing - (dot_spacing - 8))) / 2;
-    for (size_t i = 0; i < this->covers_.size(); i++) {
+    // Create dots for each cover and group
+    int start_dot_x = (container_width - (entry_count * dot_spacing - (dot_spacing - dot_size))) / 2;
+    for (size_t i = 0; i < entry_count; i++) {
       lv_obj_t *dot = lv_obj_create(this->dots_container_);
-      lv_obj_set_size(dot, 8, 8);
-      lv_obj_set_pos(dot, start_dot_x + i * dot_spacing, 2);
-      lv_obj_set_style_radius(dot, 4, 0);
+      lv_obj_set_size(dot, dot_size, dot_size);
+      lv_obj_set_pos(dot, start_dot_x + i * dot_spacing, this->px(2));
+      lv_obj_set_style_radius(dot, dot_size / 2, 0);
       lv_obj_set_style_border_width(dot, 0, 0);
       lv_obj_set_style_bg_color(dot, lv_color_hex(0x555555), 0);
       this->dots_.push_back(dot);
@@ -274,12 +481,21 @@ void CoverApp::create_app_ui() {
   // Register state callbacks for all covers
   for (size_t i = 0; i < this->covers_.size(); i++) {
     if (this->covers_[i].cover != nullptr) {
-      this->covers_[i].cover->add_on_state_callback([this]() {
-        // Only update if this app is currently active
-        if (g_current_cover_app == this) {
-          ESP_LOGD(TAG, "Cover state changed callback, refreshing UI");
-          this->update_state();
-        }
+      this->covers_[i].cover->add_on_state_callback([this, i]() {
+        this->run_ui_(this, [](void *ctx, int32_t i, float) {
+          auto *app = static_cast<CoverApp *>(ctx);
+          // Only update if this app is active and shows this cover (or a group containing it)
+          if (!app->active_) {
+            return;
+          }
+          const CoverGroup *group = app->get_current_group_();
+          bool shown = group != nullptr ? i < (int32_t) MAX_COVERS && (group->member_mask & (1u << i)) != 0
+                                        : i == app->current_index_;
+          if (shown) {
+            ESP_LOGD(TAG, "Cover state changed callback, refreshing UI");
+            app->update_state();
+          }
+        }, (int32_t) i);
       });
     }
   }
@@ -293,37 +509,57 @@ void CoverApp::create_app_ui() {
 }
 
 void CoverApp::update_state() {
-  if (this->covers_.empty() || this->page_ == nullptr) {
+  if (this->get_entry_count_() == 0 || this->page_ == nullptr) {
     return;
   }
   
-  // Get current cover
-  CoverItem &current = this->covers_[this->current_index_];
+  const char *name;
+  uint32_t color;
+  float position;  // 0.0 = closed, 1.0 = open
+  cover::CoverOperation operation;
   
-  if (current.cover == nullptr) {
-    return;
+  const CoverGroup *group = this->get_current_group_();
+  if (group != nullptr) {
+    name = group->name;
+    color = group->color;
+    this->aggregate_group_(*group, &position, &operation);
+  } else {
+    // Get current cover
+    CoverItem &current = this->covers_[this->current_index_];
+    if (current.cover == nullptr) {
+      return;
+    }
+    name = current.name;
+    color = current.color;
+    position = this->get_live_value_();
+    operation = current.cover->current_operation;
+    // Follow the cover while nothing is pending and it is at rest
+    if (!this->target_committer_.has_pending() && operation == cover::COVER_OPERATION_IDLE) {
+      this->target_ = position;
+    }
   }
   
   // Update name label
   if (this->name_label_ != nullptr) {
-    lv_label_set_text(this->name_label_, current.name.c_str());
+    lv_label_set_text(this->name_label_, name);
   }
   
-  // Get cover state
-  float position = current.cover->position;  // 0.0 = closed, 1.0 = open
-  cover::CoverOperation operation = current.cover->current_operation;
-  
   // Update arc color based on cover's color
   if (this->position_arc_ != nullptr) {
-    lv_obj_set_style_arc_color(this->position_arc_, lv_color_hex(current.color), LV_PART_INDICATOR);
+    lv_obj_set_style_arc_color(this->position_arc_, lv_color_hex(color), LV_PART_INDICATOR);
     
     // Position is 0-1, convert to 0-100 for arc
     int arc_value = (int)(position * 100);
     lv_arc_set_value(this->position_arc_, arc_value);
   }
+  this->update_target_marker_();
   
-  // Update position label
-  if (this->position_label_ != nullptr) {
+  // Update position label (the target in position / tilt mode)
+  if (this->position_label_ != nullptr && this->mode_ != CoverMode::ACTIONS) {
+    char buf[8];
+    snprintf(buf, sizeof(buf), "%d%%", (int)(this->target_ * 100 + 0.5f));
+    lv_label_set_text(this->position_label_, buf);
+  } else if (this->position_label_ != nullptr) {
     if (position == cover::COVER_OPEN) {
       lv_label_set_text(this->position_label_, "100%");
     } else if (position == cover::COVER_CLOSED) {
@@ -337,31 +573,54 @@ void CoverApp::update_state() {
   
   // Update status label
   if (this->status_label_ != nullptr) {
-    lv_label_set_text(this->status_label_, this->get_state_text(operation, position));
+    if (this->mode_ == CoverMode::POSITION && operation == cover::COVER_OPERATION_IDLE) {
+      lv_label_set_text(this->status_label_, this->tr(StringId::COVER_POSITION));
+    } else if (this->mode_ == CoverMode::TILT && operation == cover::COVER_OPERATION_IDLE) {
+      lv_label_set_text(this->status_label_, this->tr(StringId::COVER_TILT));
+    } else {
+      lv_label_set_text(this->status_label_, this->get_state_text(operation, position));
+    }
   }
   
+  style_stale_(this->position_arc_, this->is_stale_(group));
+  style_stale_(this->position_label_, this->is_stale_(group));
+  
   ESP_LOGD(TAG, "Cover '%s' position: %.0f%%, operation: %d", 
-           current.name.c_str(), position * 100, (int)operation);
+           name, position * 100, (int)operation);
 }
 
 const char* CoverApp::get_state_text(cover::CoverOperation op, float position) {
   switch (op) {
     case cover::COVER_OPERATION_OPENING:
-      return "Opening...";
+      return this->tr(StringId::COVER_OPENING);
     case cover::COVER_OPERATION_CLOSING:
-      return "Closing...";
+      return this->tr(StringId::COVER_CLOSING);
     case cover::COVER_OPERATION_IDLE:
     default:
       if (position >= 0.99f) {
-        return "Open";
+        return this->tr(StringId::COVER_OPEN);
       } else if (position <= 0.01f) {
-        return "Closed";
+        return this->tr(StringId::COVER_CLOSED);
       } else {
-        return "Partial";
+        return this->tr(StringId::COVER_PARTIAL);
       }
   }
 }
 
+bool CoverApp::is_stale_(const CoverGroup *group) const {
+#ifdef USE_DIAL_MENU_COVER_HA
+  if (group == nullptr) {
+    const CoverItem &current = this->covers_[this->current_index_];
+    return current.ha_cover != nullptr && current.ha_cover->is_stale();
+  }
+  for (uint8_t index : group->members) {
+    const CoverItem &member = this->covers_[index];
+    if (member.ha_cover != nullptr && member.ha_cover->is_stale()) return true;
+  }
+#endif
+  return false;
+}
+
 void CoverApp::update_dots() {
   if (this->dots_.empty()) return;
   
@@ -378,15 +637,20 @@ void CoverApp::update_action_focus() {
   // Reset all buttons to normal state
   if (this->btn_open_) {
     lv_obj_set_style_border_color(this->btn_open_, lv_color_hex(0x03A964), 0);
-    lv_obj_set_style_border_width(this->btn_open_, 2, 0);
+    lv_obj_set_style_border_width(this->btn_open_, this->px(2), 0);
   }
   if (this->btn_stop_) {
     lv_obj_set_style_border_color(this->btn_stop_, lv_color_hex(0xEB8429), 0);
-    lv_obj_set_style_border_width(this->btn_stop_, 2, 0);
+    lv_obj_set_style_border_width(this->btn_stop_, this->px(2), 0);
   }
   if (this->btn_close_) {
     lv_obj_set_style_border_color(this->btn_close_, lv_color_hex(0xFD5C4C), 0);
-    lv_obj_set_style_border_width(this->btn_close_, 2, 0);
+    lv_obj_set_style_border_width(this->btn_close_, this->px(2), 0);
+  }
+  
+  // No action is selected while the encoder drives a setpoint
+  if (this->mode_ != CoverMode::ACTIONS) {
+    return;
   }
   
   // Highlight selected action
@@ -405,88 +669,128 @@ void CoverApp::update_action_focus() {
   
   if (selected_btn) {
     lv_obj_set_style_border_color(selected_btn, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_border_width(selected_btn, 3, 0);
+    lv_obj_set_style_border_width(selected_btn, this->px(3), 0);
   }
 }
 
 void CoverApp::open_cover() {
-  if (this->covers_.empty()) {
-    ESP_LOGW(TAG, "No covers configured");
-    return;
-  }
-  
-  CoverItem &current = this->covers_[this->current_index_];
-  if (current.cover == nullptr) {
-    ESP_LOGW(TAG, "Current cover is null");
-    return;
-  }
-  
-  ESP_LOGI(TAG, "Opening cover: %s", current.name.c_str());
-  auto call = current.cover->make_call();
-  call.set_command_open();
-  call.perform();
+  this->run_action_(this->current_index_, CoverAction::OPEN);
 }
 
 void CoverApp::close_cover() {
-  if (this->covers_.empty()) {
-    ESP_LOGW(TAG, "No covers configured");
-    return;
-  }
-  
-  CoverItem &current = this->covers_[this->current_index_];
-  if (current.cover == nullptr) {
-    ESP_LOGW(TAG, "Current cover is null");
-    return;
-  }
-  
-  ESP_LOGI(TAG, "Closing cover: %s", current.name.c_str());
-  auto call = current.cover->make_call();
-  call.set_command_close();
-  call.perform();
+  this->run_action_(this->current_index_, CoverAction::CLOSE);
 }
 
 void CoverApp::stop_cover() {
-  if (this->covers_.empty()) {
+  this->run_action_(this->current_index_, CoverAction::STOP);
+}
+
+void CoverApp::toggle_cover() {
+  if (this->get_entry_count_() == 0) {
     ESP_LOGW(TAG, "No covers configured");
     return;
   }
   
-  CoverItem &current = this->covers_[this->current_index_];
-  if (current.cover == nullptr) {
-    ESP_LOGW(TAG, "Current cover is null");
-    return;
+  // Toggle logic: if mostly open -> close, if mostly closed -> open
+  float position;
+  const CoverGroup *group = this->get_current_group_();
+  if (group != nullptr) {
+    cover::CoverOperation operation;
+    this->aggregate_group_(*group, &position, &operation);
+  } else {
+    CoverItem &current = this->covers_[this->current_index_];
+    if (current.cover == nullptr) {
+      ESP_LOGW(TAG, "Current cover is null");
+      return;
+    }
+    position = current.cover->position;
   }
   
-  ESP_LOGI(TAG, "Stopping cover: %s", current.name.c_str());
-  auto call = current.cover->make_call();
-  call.set_command_stop();
+  this->run_action_(this->current_index_, position > 0.5f ? CoverAction::CLOSE : CoverAction::OPEN);
+}
+
+static void perform_action(cover::Cover *cover, CoverAction action) {
+  auto call = cover->make_call();
+  switch (action) {
+    case CoverAction::OPEN:
+      call.set_command_open();
+      break;
+    case CoverAction::STOP:
+      call.set_command_stop();
+      break;
+    case CoverAction::CLOSE:
+      call.set_command_close();
+      break;
+  }
   call.perform();
 }
 
-void CoverApp::toggle_cover() {
-  if (this->covers_.empty()) {
+static const char *action_name(CoverAction action) {
+  switch (action) {
+    case CoverAction::OPEN:
+      return "Opening";
+    case CoverAction::STOP:
+      return "Stopping";
+    case CoverAction::CLOSE:
+    default:
+      return "Closing";
+  }
+}
+
+void CoverApp::run_action_(int index, CoverAction action) {
+  // Cover index and action travel packed in the command's argument
+  if (this->defer_to_main_(this, [](void *app, int32_t arg, float) {
+        static_cast<CoverApp *>(app)->run_action_(arg >> 2, static_cast<CoverAction>(arg & 3));
+      }, (index << 2) | static_cast<int32_t>(action)))
+    return;
+  if (this->get_entry_count_() == 0) {
     ESP_LOGW(TAG, "No covers configured");
     return;
   }
   
-  CoverItem &current = this->covers_[this->current_index_];
+  const CoverGroup *group = this->get_group_(index);
+  if (group != nullptr) {
+    this->run_group_action_(*group, action);
+    return;
+  }
+  
+  CoverItem &current = this->covers_[index];
   if (current.cover == nullptr) {
     ESP_LOGW(TAG, "Current cover is null");
     return;
   }
   
-  ESP_LOGI(TAG, "Toggling cover: %s", current.name.c_str());
-  
-  // Toggle logic: if mostly open -> close, if mostly closed -> open
-  if (current.cover->position > 0.5f) {
-    auto call = current.cover->make_call();
-    call.set_command_close();
-    call.perform();
-  } else {
-    auto call = current.cover->make_call();
-    call.set_command_open();
-    call.perform();
+  ESP_LOGI(TAG, "%s cover: %s", action_name(action), current.name);
+  perform_action(current.cover, action);
+}
+
+void CoverApp::run_group_action_(const CoverGroup &group, CoverAction action) {
+  ESP_LOGI(TAG, "%s group: %s (%u covers)", action_name(action), group.name, (unsigned) group.members.size());
+  
+#ifdef USE_DIAL_MENU_COVER_HA
+  // HA covers are collected and sent as one service call
+  std::vector<homeassistant_addon::HomeassistantCover *> ha_covers;
+  ha_covers.reserve(group.members.size());
+#endif
+  
+  for (uint8_t index : group.members) {
+    CoverItem &item = this->covers_[index];
+#ifdef USE_DIAL_MENU_COVER_HA
+    if (item.ha_cover != nullptr) {
+      ha_covers.push_back(item.ha_cover);
+      continue;
+    }
+#endif
+    // Native covers have no group command, drive them one by one
+    perform_action(item.cover, action);
   }
+  
+#ifdef USE_DIAL_MENU_COVER_HA
+  const char *service = action == CoverAction::OPEN   ? "cover.open_cover"
+                        : action == CoverAction::STOP ? "cover.stop_cover"
+                                                      : "cover.close_cover";
+  homeassistant_addon::HomeassistantCover::call_group_service(service, ha_covers);
+#endif
 }
 
 void CoverApp::btn_open_event_cb(lv_event_t *e) {
@@ -516,6 +820,15 @@ void CoverApp::btn_close_event_cb(lv_event_t *e) {
   }
 }
 
+void CoverApp::position_label_event_cb(lv_event_t *e) {
+  lv_obj_t *label = lv_event_get_target(e);
+  CoverApp *app = static_cast<CoverApp *>(lv_obj_get_user_data(label));
+  
+  if (app != nullptr) {
+    app->next_mode();
+  }
+}
+
 }  // namespace dial_menu
 }  // namespace esphome
 
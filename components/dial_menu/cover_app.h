@@ -5,6 +5,13 @@
  * This app displays covers and allows controlling them via touch or encoder.
  * Navigate between covers using the encoder rotation or swipe gestures.
  * Actions: Open, Close, Stop, Toggle
+ *
+ * Position and tilt modes turn the encoder into a setpoint: a ghost marker on
+ * the arc follows the dial, the target is sent once the dial rests.
+ *
+ * Groups (including a virtual "All" entry) act on several covers at once:
+ * Home Assistant covers share a single service call, native covers are
+ * commanded one after the other.
  */
 #pragma once
 
@@ -13,8 +20,13 @@
 #ifdef USE_DIAL_MENU_COVER
 
 #include "dial_menu_controller.h"
+#include "memory_policy.h"
+#include "setpoint_committer.h"
 #include "esphome/components/cover/cover.h"
 #include "esphome/components/font/font.h"
+#ifdef USE_DIAL_MENU_COVER_HA
+#include "esphome/components/homeassistant_addon/cover/homeassistant_cover.h"
+#endif
 #include <vector>
 
 namespace esphome {
@@ -25,10 +37,27 @@ namespace dial_menu {
  */
 struct CoverItem {
   cover::Cover *cover;
-  std::string name;
+  const char *name;
   uint32_t color;
+#ifdef USE_DIAL_MENU_COVER_HA
+  // Set when the cover mirrors a HA entity, so groups can batch the service call
+  homeassistant_addon::HomeassistantCover *ha_cover{nullptr};
+#endif
 };
 
+/**
+ * @brief A named set of covers controlled together
+ */
+struct CoverGroup {
+  const char *name;
+  uint32_t color;
+  ColdVector<uint8_t> members;   // Indices into covers_
+  uint32_t member_mask;          // Same members as a bit mask, for cheap lookups
+};
+
+// Groups store their members as a bit mask
+static constexpr size_t MAX_COVERS = 32;
+
 /**
  * @brief Cover action types for the UI buttons
  */
@@ -38,6 +67,15 @@ enum class CoverAction {
   CLOSE
 };
 
+/**
+ * @brief What the encoder drives
+ */
+enum class CoverMode {
+  ACTIONS,   // Navigate covers / actions
+  POSITION,  // Set the position of the current cover
+  TILT       // Set the tilt of the current cover
+};
+
 /**
  * @brief App that controls multiple ESPHome covers
  * 
@@ -47,15 +85,34 @@ enum class CoverAction {
  * - Three action buttons: Open, Stop, Close
  * - Visual position indicator
  * - Dots indicator showing current cover
+ * - Optional groups shown after the covers, with aggregated position
+ * - Position / tilt modes (tap the percentage): encoder moves a target marker,
+ *   sent when the dial rests
  */
 class CoverApp : public DialApp {
  public:
   // Add a cover to the app (can add multiple)
-  void add_cover(cover::Cover *cover, const std::string &name, uint32_t color);
+  void add_cover(cover::Cover *cover, const char *name, uint32_t color);
+#ifdef USE_DIAL_MENU_COVER_HA
+  void add_homeassistant_cover(homeassistant_addon::HomeassistantCover *cover, const char *name, uint32_t color);
+#endif
+  
+  // Add a group of covers (indices in add_cover order), shown after the covers
+  void add_cover_group(const char *name, uint32_t color, const std::vector<uint8_t> &members);
   
   // Set custom font for labels
   void set_font_14(font::Font *font) { this->font_14_ = font; }
   
+  // Controller runs the position / tilt commit timer
+  void set_controller(DialMenuController *controller) { this->target_committer_.set_owner(controller); }
+  void set_render_task(RenderTask *task) override {
+    DialApp::set_render_task(task);
+    this->target_committer_.set_render_task(task);
+  }
+  
+  // Position / tilt change per encoder click (0-1)
+  void set_position_step(float step) { this->position_step_ = step; }
+  
   // App lifecycle - called by DialMenuController
   void on_enter() override;
   void on_exit() override;
@@ -67,6 +124,11 @@ class CoverApp : public DialApp {
   
   // Create the app's UI (called during setup)
   void create_app_ui() override;
+  void relabel() override { this->update_state(); }
+  uint8_t get_view_index() const override { return this->current_index_; }
+  void restore_view_index(uint8_t index) override {
+    if (index < this->get_entry_count_()) this->current_index_ = index;
+  }
   
   // Update UI to match current cover state
   void update_state();
@@ -93,6 +155,9 @@ class CoverApp : public DialApp {
   void previous_action();
   void execute_action();
   
+  // Cycle actions -> position -> tilt (modes the current cover doesn't support are skipped)
+  void next_mode();
+  
   // Get the app page
   lv_obj_t *get_page() const { return this->page_; }
   
@@ -100,9 +165,42 @@ class CoverApp : public DialApp {
   size_t get_cover_count() const { return this->covers_.size(); }
 
  protected:
-  std::vector<CoverItem> covers_;
+  // Covers followed by groups
+  size_t get_entry_count_() const { return this->covers_.size() + this->groups_.size(); }
+  // Group at an entry index, nullptr when the entry is a single cover
+  const CoverGroup *get_group_(int index) const;
+  // Group shown at current_index_, nullptr when a single cover is shown
+  const CoverGroup *get_current_group_() const { return this->get_group_(this->current_index_); }
+  // Average position and combined operation of the group members
+  void aggregate_group_(const CoverGroup &group, float *position, cover::CoverOperation *operation) const;
+  // Shown values come from a boot snapshot HA has not confirmed yet
+  bool is_stale_(const CoverGroup *group) const;
+  void run_action_(int index, CoverAction action);
+  void run_group_action_(const CoverGroup &group, CoverAction action);
+  
+  // Position / tilt setpoint
+  bool mode_supported_(CoverMode mode) const;
+  void set_mode_(CoverMode mode);
+  float get_live_value_() const;
+  void adjust_target_(int delta);
+  void commit_target_();
+  void send_target_(int index, CoverMode mode, float target);
+  void update_target_marker_();
+  
+  ColdVector<CoverItem> covers_;
+  ColdVector<CoverGroup> groups_;
   int current_index_{0};
+  bool active_{false};  // Page shown, state callbacks refresh the UI
   CoverAction selected_action_{CoverAction::STOP};
+  CoverMode mode_{CoverMode::ACTIONS};
+  float position_step_{0.05f};
+  
+  // Target shown by the ghost marker, sent once the dial rests (latest wins)
+  float target_{0.0f};
+  // Committed on the UI side, for the cover and mode shown when the value was dialled
+  SetpointCommitter target_committer_{
+      [this](float target) { this->send_target_(this->current_index_, this->mode_, target); }};
+  static constexpr uint32_t REST_DELAY_MS = 600;
   
   // Custom font (optional)
   font::Font *font_14_{nullptr};
@@ -112,6 +210,7 @@ class CoverApp : public DialApp {
   lv_obj_t *name_label_{nullptr};
   lv_obj_t *status_label_{nullptr};
   lv_obj_t *position_arc_{nullptr};
+  lv_obj_t *target_arc_{nullptr};  // Ghost marker for the position / tilt target
   lv_obj_t *position_label_{nullptr};
   
   // Action buttons
@@ -127,6 +226,7 @@ class CoverApp : public DialApp {
   static void btn_open_event_cb(lv_event_t *e);
   static void btn_stop_event_cb(lv_event_t *e);
   static void btn_close_event_cb(lv_event_t *e);
+  static void position_label_event_cb(lv_event_t *e);
   
   // Helper to get state text
   const char* get_state_text(cover::CoverOperation op, float position);
@@ -6,6 +6,12 @@
  */
 
 #include "dial_menu_controller.h"
+#include "memory_policy.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <map>
 
 namespace esphome {
@@ -13,10 +19,7 @@ namespace dial_menu {
 
 static const char *const TAG = "dial_menu";
 
-// Store controller reference for static callback
-static DialMenuController *g_controller = nullptr;
-
-// Map icon type strings to LVGL built-in symbols
+// Map icon type strings to LVGL built-in symbols, for icons without a sprite in the atlas
 // These symbols are always available in LVGL
 static const char* get_lvgl_symbol(const std::string &icon_type) {
   // LVGL built-in symbols (from lv_symbol_def.h)
@@ -56,41 +59,282 @@ static const char* get_lvgl_symbol(const std::string &icon_type) {
 }
 
 void DialMenuController::setup() {
+  this->boot_.lvgl_ready = millis();
   ESP_LOGI(TAG, "Setting up Dial Menu Controller");
-  ESP_LOGI(TAG, "  Number of apps: %d", this->apps_.size());
+  ESP_LOGI(TAG, "  Number of apps: %d", (int) this->apps_.size());
   ESP_LOGI(TAG, "  Button size: %d / %d (focused)", this->button_size_, this->button_size_focused_);
   ESP_LOGI(TAG, "  Idle timeout: %d ms", this->idle_timeout_ms_);
   
-  g_controller = this;
+  ESP_LOGI(TAG, "  Diameter: %d px, shadows: %s, refresh: %u ms", (int) this->layout_.diameter,
+           YESNO(this->layout_.shadows), (unsigned) this->layout_.refresh_period_ms);
+  
+  // Refresh period of the profile (also the pace of LVGL animations)
+  lv_disp_t *disp = this->get_disp();
+  lv_timer_t *refresh_timer = RenderPacer::find_refresh_timer(disp);
+  if (refresh_timer != nullptr) {
+    lv_timer_set_period(refresh_timer, this->layout_.refresh_period_ms);
+  }
+  if (disp != nullptr) {
+    lv_coord_t side = std::min(lv_disp_get_hor_res(disp), lv_disp_get_ver_res(disp));
+    if (side != this->layout_.diameter) {
+      ESP_LOGW(TAG, "  The display is %dx%d px, laid out for %d px", (int) lv_disp_get_hor_res(disp),
+               (int) lv_disp_get_ver_res(disp), (int) this->layout_.diameter);
+    }
+  }
+  
+  // Apps build their UI for this display, with labels in the configured language
+  for (auto *app : this->apps_) {
+    app->set_layout(this->layout_);
+    app->set_language(this->language_);
+    app->set_render_task(&this->render_task_);
+  }
   
-  // Create the LVGL UI
+  // Back where the user left off (before the app pages are built)
+  this->restore_navigation_();
+  
+  // Create the launcher
   this->create_lvgl_ui();
+  this->boot_.launcher = millis();
   
-  // Setup idle screen
+  // Setup idle screen (built after the app pages)
   if (this->time_ != nullptr) {
     this->idle_screen_.set_time(this->time_);
+    this->idle_screen_.set_layout(this->layout_);
     // Pass custom font to idle screen for French accents
     if (this->font_18_ != nullptr) {
       this->idle_screen_.set_font_18(this->font_18_->get_lv_font());
     }
-    this->idle_screen_.create_ui();
-    ESP_LOGI(TAG, "Idle screen initialized with time source");
   }
   
   // Initialize activity timer
   this->last_activity_time_ = millis();
   
-  // Select first app by default
+  // Focus the restored app (the first one by default). The group focused the first
+  // button before its event callback was added: styled here, as on return to the launcher
   if (!this->apps_.empty()) {
-    this->selected_index_ = 0;
-    // Focus first button
-    if (this->apps_[0]->get_lvgl_obj() != nullptr) {
-      lv_group_focus_obj(this->apps_[0]->get_lvgl_obj());
+    DialApp *app = this->apps_[this->selected_index_];
+    if (app->get_lvgl_obj() != nullptr) {
+      lv_group_focus_obj(app->get_lvgl_obj());
+      this->update_focus_style(app, true);
+    }
+  }
+  
+  // The launcher is on screen before any app page exists, those are built by loop()
+  this->draw_first_frame_();
+  this->booting_ = true;
+  
+  if (this->loop_stall_sensor_ != nullptr) {
+    this->set_interval("loop_stall", STALL_PUBLISH_INTERVAL_MS, [this]() {
+      this->loop_stall_sensor_->publish_state(this->window_loop_gap_us_ / 1000.0f);
+      this->window_loop_gap_us_ = 0;
+    });
+  }
+  
+  // From here on LVGL belongs to the render task, the lvgl component's loop no longer draws
+  if (this->render_task_enabled_ && this->lvgl_ != nullptr) {
+    this->lvgl_->disable_loop();
+    if (!this->render_task_.start(DialMenuController::render_pass_, this, this->render_core_)) {
+      this->lvgl_->enable_loop();
+    }
+  }
+}
+
+lv_disp_t *DialMenuController::get_disp() const {
+  return this->lvgl_ != nullptr ? this->lvgl_->get_disp() : lv_disp_get_default();
+}
+
+void DialMenuController::draw_first_frame_() {
+  lv_disp_t *disp = this->get_disp();
+  if (disp == nullptr) return;
+  uint32_t start_us = micros();
+  lv_refr_now(disp);
+  this->boot_.first_frame_us = micros() - start_us;
+  this->boot_.first_frame = millis();
+  ESP_LOGI(TAG, "First frame at %u ms (launcher built at %u ms, drawn in %u us)", (unsigned) this->boot_.first_frame,
+           (unsigned) this->boot_.launcher, (unsigned) this->boot_.first_frame_us);
+  
+  // Later refreshes are sliced, at the rate this full frame was drawn
+  this->render_pacer_.add_sample((uint32_t) lv_disp_get_hor_res(disp) * lv_disp_get_ver_res(disp),
+                                 this->boot_.first_frame_us);
+  this->render_pacer_.attach(disp);
+  if (this->first_frame_sensor_ != nullptr) {
+    this->first_frame_sensor_->publish_state(this->boot_.first_frame);
+  }
+}
+
+void DialMenuController::run_boot_step_() {
+  // Next app page
+  while (this->boot_cursor_ < this->apps_.size()) {
+    DialApp *app = this->apps_[this->boot_cursor_++];
+    if (app->needs_ui() && !app->is_ui_created()) {
+      this->create_app_page_(app);
+      return;
+    }
+  }
+  if (this->boot_.pages == 0) {
+    this->boot_.pages = millis();
+  }
+  
+  // Then the idle screen, last
+  if (this->time_ != nullptr && this->idle_screen_.get_page() == nullptr) {
+    DisplayScope scope(this->get_disp());
+    this->idle_screen_.create_ui();
+    ESP_LOGI(TAG, "Idle screen initialized with time source");
+  }
+  this->boot_.idle_screen = millis();
+  this->booting_ = false;
+  this->on_ui_ready_();
+}
+
+void DialMenuController::finish_boot_() {
+  while (this->booting_) {
+    this->run_boot_step_();
+  }
+}
+
+void DialMenuController::on_ui_ready_() {
+  this->log_boot_timeline_();
+  // Memory after the whole UI is built
+  this->report_memory_(MemorySample::take(this->get_disp()));
+  
+  // Sensors and timers belong to the main loop
+  this->render_task_.run_main({[](void *ctx, int32_t, float) {
+    auto *self = static_cast<DialMenuController *>(ctx);
+    if (self->ui_ready_sensor_ != nullptr) {
+      self->ui_ready_sensor_->publish_state(self->boot_.idle_screen);
+    }
+    // Then every minute, sampled on the side that owns LVGL
+    if (self->has_memory_sensors_()) {
+      self->set_interval("memory", MEMORY_PUBLISH_INTERVAL_MS, [self]() {
+        self->render_task_.run_ui({[](void *ctx, int32_t, float) {
+          auto *self = static_cast<DialMenuController *>(ctx);
+          self->report_memory_(MemorySample::take(self->get_disp()));
+        }, self});
+      });
     }
+  }, this});
+}
+
+void DialMenuController::log_boot_timeline_() {
+  const BootTimeline &boot = this->boot_;
+  ESP_LOGCONFIG(TAG, "  Boot: LVGL ready %u ms, launcher %u ms, first frame %u ms (%u us), pages %u ms, idle screen %u ms",
+                (unsigned) boot.lvgl_ready, (unsigned) boot.launcher, (unsigned) boot.first_frame,
+                (unsigned) boot.first_frame_us, (unsigned) boot.pages, (unsigned) boot.idle_screen);
+  for (auto *app : this->apps_) {
+    if (!app->is_ui_created()) continue;
+    ESP_LOGCONFIG(TAG, "    - %s: page built in %u us", app->get_name(), (unsigned) app->get_ui_build_us());
+  }
+}
+
+void DialMenuController::restore_navigation_() {
+  if (this->snapshot_key_ == nullptr || this->snapshot_interval_ms_ == 0) return;
+  this->navigation_pref_ =
+      global_preferences->make_preference<NavigationSnapshot>(fnv1_hash(this->snapshot_key_) ^ NavigationSnapshot::TYPE, true);
+  this->navigation_open_ = true;
+  // Boot counts as a write: the first one comes a full interval later
+  this->last_navigation_write_ = millis();
+  
+  NavigationSnapshot snapshot{};
+  if (!this->navigation_pref_.load(&snapshot)) return;
+  this->saved_navigation_ = snapshot;
+  if (snapshot.selected < this->apps_.size()) {
+    this->selected_index_ = snapshot.selected;
+  }
+  for (size_t i = 0; i < this->apps_.size() && i < NavigationSnapshot::MAX_APPS; i++) {
+    this->apps_[i]->restore_view_index(snapshot.view_index[i]);
   }
+  ESP_LOGD(TAG, "Restored navigation: app %d", this->selected_index_);
+}
+
+NavigationSnapshot DialMenuController::get_navigation_() const {
+  NavigationSnapshot snapshot{};
+  snapshot.selected = this->selected_index_;
+  for (size_t i = 0; i < this->apps_.size() && i < NavigationSnapshot::MAX_APPS; i++) {
+    snapshot.view_index[i] = this->apps_[i]->get_view_index();
+  }
+  return snapshot;
+}
+
+void DialMenuController::save_navigation_() {
+  if (!this->navigation_open_) return;
+  // Preferences and timeouts belong to the main loop
+  if (this->render_task_.in_task()) {
+    this->render_task_.run_main(
+        {[](void *ctx, int32_t, float) { static_cast<DialMenuController *>(ctx)->save_navigation_(); }, this});
+    return;
+  }
+  NavigationSnapshot snapshot = this->get_navigation_();
+  if (memcmp(&snapshot, &this->saved_navigation_, sizeof(snapshot)) == 0) {
+    // Back to what is saved: nothing to write
+    this->cancel_timeout("navigation");
+    this->navigation_write_pending_ = false;
+    return;
+  }
+  // A write is already scheduled: it will pick up the latest state
+  if (this->navigation_write_pending_) return;
+  this->navigation_write_pending_ = true;
+  
+  uint32_t elapsed = millis() - this->last_navigation_write_;
+  uint32_t delay = elapsed >= this->snapshot_interval_ms_ ? 0 : this->snapshot_interval_ms_ - elapsed;
+  this->set_timeout("navigation", delay, [this]() { this->write_navigation_(); });
+}
+
+void DialMenuController::write_navigation_() {
+  this->navigation_write_pending_ = false;
+  NavigationSnapshot snapshot = this->get_navigation_();
+  this->navigation_pref_.save(&snapshot);
+  this->saved_navigation_ = snapshot;
+  this->last_navigation_write_ = millis();
+  ESP_LOGD(TAG, "Saved navigation: app %d", this->selected_index_);
 }
 
 void DialMenuController::loop() {
+  this->track_loop_gap_();
+  
+  // The render task does the UI work, this loop runs what it posted
+  if (this->render_task_.is_running()) {
+    this->render_task_.drain_main();
+    return;
+  }
+  this->ui_pass_();
+}
+
+uint32_t DialMenuController::render_pass_(void *ctx) {
+  static_cast<DialMenuController *>(ctx)->ui_pass_();
+  return lv_timer_handler();
+}
+
+bool DialMenuController::defer_to_ui_(UiCommand::Fn fn, int32_t arg) {
+  if (!this->render_task_.is_running() || this->render_task_.in_task()) return false;
+  this->render_task_.run_ui({fn, this, arg, 0.0f});
+  return true;
+}
+
+void DialMenuController::report_memory_(const MemorySample &sample) {
+  if (!this->has_memory_sensors_()) return;
+  // The sample does not fit a command: it is left under the mutex, a newer one may replace it
+  // before the main loop publishes it, which is as good
+  {
+    LockGuard lock(this->reported_mutex_);
+    this->reported_sample_ = sample;
+  }
+  this->render_task_.run_main({[](void *ctx, int32_t, float) {
+    auto *self = static_cast<DialMenuController *>(ctx);
+    MemorySample sample;
+    {
+      LockGuard lock(self->reported_mutex_);
+      sample = self->reported_sample_;
+    }
+    self->publish_memory_(sample);
+  }, this});
+}
+
+void DialMenuController::ui_pass_() {
+  // App pages are built one per loop after the first frame
+  if (this->booting_) {
+    this->run_boot_step_();
+  }
+  
   // Check for idle timeout
   if (!this->idle_active_ && this->idle_timeout_ms_ > 0) {
     uint32_t now = millis();
@@ -101,31 +345,189 @@ void DialMenuController::loop() {
   
   // Update idle screen if visible
   if (this->idle_active_) {
-    static uint32_t last_update = 0;
     uint32_t now = millis();
-    if (now - last_update >= 1000) {  // Update every second
-      last_update = now;
+    if (now - this->last_idle_update_ >= 1000) {  // Update every second
+      this->last_idle_update_ = now;
       this->idle_screen_.update();
     }
   }
+  
+  this->run_ticks_();
+}
+
+void DialMenuController::track_loop_gap_() {
+  uint32_t now_us = micros();
+  if (this->last_loop_us_ != 0) {
+    uint32_t gap_us = now_us - this->last_loop_us_;
+    if (gap_us > this->max_loop_gap_us_) this->max_loop_gap_us_ = gap_us;
+    if (gap_us > this->window_loop_gap_us_) this->window_loop_gap_us_ = gap_us;
+    if (gap_us >= LOOP_STALL_US) {
+      this->loop_stalls_++;
+      ESP_LOGD(TAG, "Loop stalled for %u ms", (unsigned) (gap_us / 1000));
+    }
+  }
+  this->last_loop_us_ = now_us;
+}
+
+void DialMenuController::log_render_stats_() {
+  const RenderStats &stats = this->render_pacer_.get_stats();
+  ESP_LOGCONFIG(TAG, "  Render budget: %u us per refresh, %u px/ms measured", (unsigned) this->render_pacer_.get_budget(),
+                (unsigned) stats.px_per_ms);
+  ESP_LOGCONFIG(TAG, "  Refreshes: %u, %u sliced, longest %u us", (unsigned) stats.refreshes, (unsigned) stats.sliced,
+                (unsigned) stats.max_refresh_us);
+  ESP_LOGCONFIG(TAG, "  Loop: longest gap %u ms, %u stalls over %u ms", (unsigned) (this->max_loop_gap_us_ / 1000),
+                (unsigned) this->loop_stalls_, (unsigned) (LOOP_STALL_US / 1000));
+  if (this->render_task_.is_running()) {
+    const RenderTaskStats &task = this->render_task_.get_stats();
+    ESP_LOGCONFIG(TAG, "  Render task on core %u: %u passes, longest %u us", this->render_core_, (unsigned) task.passes,
+                  (unsigned) task.max_pass_us);
+    ESP_LOGCONFIG(TAG, "  UI commands: %u in (backlog max %u), %u out, %u / %u waited for a full queue",
+                  (unsigned) task.to_render, (unsigned) task.max_backlog, (unsigned) task.to_main,
+                  (unsigned) task.waits_render, (unsigned) task.waits_main);
+  }
+}
+
+void DialMenuController::run_ticks_() {
+  size_t count = this->apps_.size();
+  if (count == 0) return;
+  
+  uint32_t start_us = micros();
+  uint32_t now = millis();
+  for (size_t n = 0; n < count; n++) {
+    size_t index = (this->tick_cursor_ + n) % count;
+    DialApp *app = this->apps_[index];
+    uint32_t interval = app->get_tick_interval();
+    if (interval == 0) continue;
+    
+    // Apps off screen are skipped, or ticked at a stretched period if they asked for it
+    bool visible = this->app_open_ && !this->idle_active_ && (int) index == this->selected_index_;
+    if (!visible) {
+      if (!app->get_tick_in_background()) continue;
+      interval *= BACKGROUND_TICK_STRETCH;
+    }
+    
+    TickStats &stats = app->get_tick_stats();
+    if ((int32_t)(now - stats.next_due) < 0) continue;
+    
+    if (micros() - start_us >= this->tick_budget_us_) {
+      // Budget spent: this app goes first on the next loop
+      stats.deferred++;
+      this->tick_cursor_ = index;
+      return;
+    }
+    
+    uint32_t tick_start_us = micros();
+    app->on_tick(visible);
+    uint32_t cost_us = micros() - tick_start_us;
+    
+    stats.count++;
+    stats.total_us += cost_us;
+    if (cost_us > stats.max_us) stats.max_us = cost_us;
+    // Late ticks are not replayed, the next one is a full interval away
+    stats.next_due = now + interval;
+  }
+  this->tick_cursor_ = 0;
+}
+
+void DialMenuController::log_tick_stats_() {
+  for (auto *app : this->apps_) {
+    if (app->get_tick_interval() == 0) continue;
+    TickStats &stats = app->get_tick_stats();
+    uint32_t avg_us = stats.count > 0 ? (uint32_t)(stats.total_us / stats.count) : 0;
+    ESP_LOGCONFIG(TAG, "    - %s: every %u ms%s, %u ticks, avg %u us, max %u us, %u deferred", app->get_name(),
+                  app->get_tick_interval(), app->get_tick_in_background() ? " (background)" : "", stats.count,
+                  avg_us, stats.max_us, stats.deferred);
+  }
 }
 
 void DialMenuController::dump_config() {
   ESP_LOGCONFIG(TAG, "Dial Menu Controller:");
-  ESP_LOGCONFIG(TAG, "  Apps: %d", this->apps_.size());
+  ESP_LOGCONFIG(TAG, "  Apps: %d", (int) this->apps_.size());
   for (auto *app : this->apps_) {
     ESP_LOGCONFIG(TAG, "    - %s (pos: %d,%d)", 
-                  app->get_name().c_str(),
+                  app->get_name(),
                   app->get_pos_x(),
                   app->get_pos_y());
   }
+  ESP_LOGCONFIG(TAG, "  Tick budget: %u us per loop", this->tick_budget_us_);
+  this->log_boot_timeline_();
+  this->log_render_stats_();
+  if (this->navigation_open_) {
+    ESP_LOGCONFIG(TAG, "  Navigation snapshot: every %u ms at most", (unsigned) this->snapshot_interval_ms_);
+  }
+  this->log_tick_stats_();
+  MemoryPolicy::dump_config(TAG);
+  // Walks the LVGL objects: done by the render task when it runs
+  this->render_task_.run_ui(
+      {[](void *ctx, int32_t, float) { static_cast<DialMenuController *>(ctx)->log_memory_stats_(); }, this});
+}
+
+bool DialMenuController::has_memory_sensors_() const {
+  return this->heap_free_sensor_ != nullptr || this->heap_largest_block_sensor_ != nullptr ||
+         this->heap_fragmentation_sensor_ != nullptr || this->lvgl_used_sensor_ != nullptr ||
+         this->lvgl_objects_sensor_ != nullptr || this->ui_bytes_sensor_ != nullptr;
+}
+
+void DialMenuController::publish_memory_(const MemorySample &sample) {
+  if (this->heap_free_sensor_ != nullptr) {
+    this->heap_free_sensor_->publish_state(sample.heap_free);
+  }
+  if (this->heap_largest_block_sensor_ != nullptr) {
+    this->heap_largest_block_sensor_->publish_state(sample.internal_largest);
+  }
+  if (this->heap_fragmentation_sensor_ != nullptr) {
+    this->heap_fragmentation_sensor_->publish_state(sample.internal_fragmentation());
+  }
+  if (this->lvgl_used_sensor_ != nullptr) {
+    // Unknown when LVGL allocates from the system heap
+    this->lvgl_used_sensor_->publish_state(sample.lvgl_heap ? (float) sample.lvgl_used : NAN);
+  }
+  if (this->lvgl_objects_sensor_ != nullptr) {
+    this->lvgl_objects_sensor_->publish_state(sample.objects);
+  }
+  if (this->ui_bytes_sensor_ != nullptr) {
+    int32_t total = 0;
+    for (auto *app : this->apps_) {
+      total += app->get_memory_stats().ui_bytes;
+    }
+    this->ui_bytes_sensor_->publish_state(total);
+  }
+}
+
+void DialMenuController::log_memory_stats_() {
+  MemorySample sample = MemorySample::take(this->get_disp());
+  ESP_LOGCONFIG(TAG, "  Heap: %u B free, internal %u B free, largest block %u B, %u%% fragmented",
+                (unsigned) sample.heap_free, (unsigned) sample.internal_free, (unsigned) sample.internal_largest,
+                sample.internal_fragmentation());
+  if (sample.lvgl_heap) {
+    ESP_LOGCONFIG(TAG, "  LVGL heap: %u B used, %u B free, largest block %u B, %u%% fragmented",
+                  (unsigned) sample.lvgl_used, (unsigned) sample.lvgl_free, (unsigned) sample.lvgl_largest,
+                  sample.lvgl_fragmentation);
+  } else {
+    ESP_LOGCONFIG(TAG, "  LVGL heap: system heap (custom allocator)");
+  }
+  ESP_LOGCONFIG(TAG, "  LVGL objects: %u", (unsigned) sample.objects);
+  
+  int32_t total_bytes = 0;
+  int32_t total_objects = 0;
+  for (auto *app : this->apps_) {
+    if (!app->needs_ui()) continue;
+    AppMemoryStats &stats = app->get_memory_stats();
+    total_bytes += stats.ui_bytes;
+    total_objects += stats.ui_objects;
+    ESP_LOGCONFIG(TAG, "    - %s: UI %d B, %d objects, %u opens, last session %+d B (max %+d B)", app->get_name(),
+                  (int) stats.ui_bytes, (int) stats.ui_objects, (unsigned) stats.opens,
+                  (int) stats.last_session_bytes, (int) stats.max_session_bytes);
+  }
+  ESP_LOGCONFIG(TAG, "  App UIs: %d B, %d objects", (int) total_bytes, (int) total_objects);
 }
 
 void DialMenuController::create_lvgl_ui() {
   ESP_LOGI(TAG, "Creating LVGL UI...");
   
-  // Get active screen
-  this->launcher_page_ = lv_scr_act();
+  // The launcher is the display's active screen
+  lv_disp_t *disp = this->get_disp();
+  this->launcher_page_ = lv_disp_get_scr_act(disp);
   
   // Set black background
   lv_obj_set_style_bg_color(this->launcher_page_, lv_color_hex(0x000000), 0);
@@ -134,10 +536,10 @@ void DialMenuController::create_lvgl_ui() {
   this->group_ = lv_group_create();
   lv_group_set_wrap(this->group_, true);
   
-  // Set as default group for encoder
+  // Set as the group of the encoders of this display
   lv_indev_t *indev = nullptr;
   while ((indev = lv_indev_get_next(indev)) != nullptr) {
-    if (lv_indev_get_type(indev) == LV_INDEV_TYPE_ENCODER) {
+    if (lv_indev_get_type(indev) == LV_INDEV_TYPE_ENCODER && indev->driver->disp == disp) {
       lv_indev_set_group(indev, this->group_);
       ESP_LOGI(TAG, "Assigned group to encoder input device");
     }
@@ -151,45 +553,52 @@ void DialMenuController::create_lvgl_ui() {
     this->create_app_button(app);
   }
   
-  // Create app-specific UIs for apps that need them
-  for (auto *app : this->apps_) {
-    if (app->needs_ui()) {
-      app->create_app_ui();
-      ESP_LOGI(TAG, "Created UI for app: %s", app->get_name().c_str());
-    }
-  }
-  
-  ESP_LOGI(TAG, "LVGL UI created successfully");
+  ESP_LOGI(TAG, "Launcher created");
+}
+
+void DialMenuController::create_app_page_(DialApp *app) {
+  DisplayScope scope(this->get_disp());
+  MemorySample before = MemorySample::take(this->get_disp());
+  uint32_t start_us = micros();
+  app->create_app_ui();
+  app->set_ui_created(micros() - start_us);
+  MemorySample after = MemorySample::take(this->get_disp());
+  
+  AppMemoryStats &stats = app->get_memory_stats();
+  stats.ui_bytes = after.bytes_since(before);
+  stats.ui_objects = after.objects_since(before);
+  ESP_LOGI(TAG, "Created UI for app: %s (%u us, %d B, %d objects)", app->get_name(),
+           (unsigned) app->get_ui_build_us(), (int) stats.ui_bytes, (int) stats.ui_objects);
 }
 
 void DialMenuController::create_center_circle() {
   // Decorative center circle
   lv_obj_t *center = lv_obj_create(this->launcher_page_);
-  lv_obj_set_size(center, 76, 76);
+  lv_obj_set_size(center, this->layout_.px(76), this->layout_.px(76));
   lv_obj_align(center, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_style_radius(center, 38, 0);
+  lv_obj_set_style_radius(center, this->layout_.px(38), 0);
   lv_obj_set_style_bg_color(center, lv_color_hex(0x111111), 0);
-  lv_obj_set_style_border_width(center, 1, 0);
+  lv_obj_set_style_border_width(center, this->layout_.px(1), 0);
   lv_obj_set_style_border_color(center, lv_color_hex(0x333333), 0);
   lv_obj_clear_flag(center, LV_OBJ_FLAG_SCROLLABLE);
   
   // App name label - use custom font with French accents if available
   this->app_name_label_ = lv_label_create(center);
-  lv_obj_align(this->app_name_label_, LV_ALIGN_CENTER, 0, -5);
+  lv_obj_align(this->app_name_label_, LV_ALIGN_CENTER, 0, this->layout_.px(-5));
   lv_obj_set_style_text_color(this->app_name_label_, lv_color_hex(0xFFFFFF), 0);
   lv_obj_set_style_text_font(this->app_name_label_, this->get_font_14(), 0);
   if (!this->apps_.empty()) {
-    lv_label_set_text(this->app_name_label_, this->apps_[0]->get_name().c_str());
+    lv_label_set_text(this->app_name_label_, this->apps_[0]->get_name());
   } else {
     lv_label_set_text(this->app_name_label_, "");
   }
   
   // Hint label
   this->hint_label_ = lv_label_create(center);
-  lv_obj_align(this->hint_label_, LV_ALIGN_CENTER, 0, 16);
+  lv_obj_align(this->hint_label_, LV_ALIGN_CENTER, 0, this->layout_.px(16));
   lv_obj_set_style_text_color(this->hint_label_, lv_color_hex(0x555555), 0);
   lv_obj_set_style_text_font(this->hint_label_, this->get_font_14(), 0);
-  lv_label_set_text(this->hint_label_, "Press to open");
+  lv_label_set_text(this->hint_label_, tr(StringId::LAUNCHER_HINT, this->language_));
 }
 
 void DialMenuController::create_app_button(DialApp *app) {
@@ -207,48 +616,60 @@ void DialMenuController::create_app_button(DialApp *app) {
   // Style
   lv_obj_set_style_radius(btn, this->button_size_ / 2, 0);
   lv_obj_set_style_bg_color(btn, lv_color_hex(app->get_color()), 0);
-  lv_obj_set_style_border_width(btn, 2, 0);
+  lv_obj_set_style_border_width(btn, this->layout_.px(2), 0);
   lv_obj_set_style_border_color(btn, lv_color_hex(0x444444), 0);
-  lv_obj_set_style_shadow_width(btn, 8, 0);
+  lv_obj_set_style_shadow_width(btn, this->layout_.shadow(8), 0);
   lv_obj_set_style_shadow_color(btn, lv_color_hex(app->get_color()), 0);
   lv_obj_set_style_shadow_opa(btn, LV_OPA_40, 0);
   
   // Add to group for encoder navigation
   lv_group_add_obj(this->group_, btn);
   
-  // Add icon label using LVGL built-in symbols (must use built-in font for FontAwesome icons)
-  lv_obj_t *icon_label = lv_label_create(btn);
-  lv_obj_set_style_text_color(icon_label, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_text_font(icon_label, &lv_font_montserrat_14, 0);  // Built-in font has FontAwesome symbols
-  lv_obj_center(icon_label);
-  
-  // Use LVGL symbol based on icon type, or first letter as fallback
-  const char* icon = app->get_icon().c_str();
-  const char* symbol = get_lvgl_symbol(icon);
-  if (symbol && symbol[0] != '\0') {
-    lv_label_set_text(icon_label, symbol);
-    ESP_LOGD(TAG, "Created icon for button '%s'", app->get_name().c_str());
-  } else if (!app->get_name().empty()) {
-    // Fallback to first letter
-    char first_letter[2] = {app->get_name()[0], '\0'};
-    lv_label_set_text(icon_label, first_letter);
-    ESP_LOGD(TAG, "Created letter '%s' for button '%s'", first_letter, app->get_name().c_str());
-  }
-  
-  // Add event callbacks
-  lv_obj_add_event_cb(btn, button_event_cb, LV_EVENT_FOCUSED, nullptr);
-  lv_obj_add_event_cb(btn, button_event_cb, LV_EVENT_DEFOCUSED, nullptr);
-  lv_obj_add_event_cb(btn, button_event_cb, LV_EVENT_CLICKED, nullptr);
+  // Icon sprite from the atlas: an A8 image tinted white, a single blit per draw
+  const lv_img_dsc_t *sprite = app->get_icon_sprite(false);
+  if (sprite != nullptr) {
+    lv_obj_t *icon_img = lv_img_create(btn);
+    lv_obj_set_style_img_recolor(icon_img, lv_color_hex(0xFFFFFF), 0);
+    lv_obj_set_style_img_recolor_opa(icon_img, LV_OPA_COVER, 0);
+    lv_img_set_src(icon_img, sprite);
+    lv_obj_center(icon_img);
+    ESP_LOGD(TAG, "Created sprite icon for button '%s'", app->get_name());
+  } else {
+    // No sprite: icon label using LVGL built-in symbols (must use built-in font for FontAwesome icons)
+    lv_obj_t *icon_label = lv_label_create(btn);
+    lv_obj_set_style_text_color(icon_label, lv_color_hex(0xFFFFFF), 0);
+    lv_obj_set_style_text_font(icon_label, &lv_font_montserrat_14, 0);  // Built-in font has FontAwesome symbols
+    lv_obj_center(icon_label);
+    
+    // Use LVGL symbol based on icon type, or first letter as fallback
+    const char* icon = app->get_icon().c_str();
+    const char* symbol = get_lvgl_symbol(icon);
+    if (symbol && symbol[0] != '\0') {
+      lv_label_set_text(icon_label, symbol);
+      ESP_LOGD(TAG, "Created icon for button '%s'", app->get_name());
+    } else if (app->get_name()[0] != '\0') {
+      // Fallback to first letter
+      char first_letter[2] = {app->get_name()[0], '\0'};
+      lv_label_set_text(icon_label, first_letter);
+      ESP_LOGD(TAG, "Created letter '%s' for button '%s'", first_letter, app->get_name());
+    }
+  }
+  
+  // Add event callbacks (the button holds the app, the event the controller owning it)
+  lv_obj_add_event_cb(btn, button_event_cb, LV_EVENT_FOCUSED, this);
+  lv_obj_add_event_cb(btn, button_event_cb, LV_EVENT_DEFOCUSED, this);
+  lv_obj_add_event_cb(btn, button_event_cb, LV_EVENT_CLICKED, this);
   
   ESP_LOGD(TAG, "Created button for '%s' at (%d, %d)", 
-           app->get_name().c_str(), app->get_pos_x(), app->get_pos_y());
+           app->get_name(), app->get_pos_x(), app->get_pos_y());
 }
 
 void DialMenuController::button_event_cb(lv_event_t *e) {
-  if (g_controller == nullptr) return;
+  DialMenuController *controller = static_cast<DialMenuController *>(lv_event_get_user_data(e));
+  if (controller == nullptr) return;
   
   // Ignore encoder events when an app is open
-  if (g_controller->app_open_) return;
+  if (controller->app_open_) return;
   
   lv_event_code_t code = lv_event_get_code(e);
   lv_obj_t *btn = lv_event_get_target(e);
@@ -258,14 +679,14 @@ void DialMenuController::button_event_cb(lv_event_t *e) {
   
   switch (code) {
     case LV_EVENT_FOCUSED:
-      g_controller->on_app_focused(app->get_index());
-      g_controller->update_focus_style(app, true);
+      controller->on_app_focused(app->get_index());
+      controller->update_focus_style(app, true);
       break;
     case LV_EVENT_DEFOCUSED:
-      g_controller->update_focus_style(app, false);
+      controller->update_focus_style(app, false);
       break;
     case LV_EVENT_CLICKED:
-      g_controller->on_app_clicked(app->get_index());
+      controller->on_app_clicked(app->get_index());
       break;
     default:
       break;
@@ -279,26 +700,42 @@ void DialMenuController::update_focus_style(DialApp *app, bool focused) {
   if (focused) {
     // Focused style: larger, white border, stronger shadow
     lv_obj_set_size(btn, this->button_size_focused_, this->button_size_focused_);
-    lv_obj_set_style_border_width(btn, 3, 0);
+    lv_obj_set_style_border_width(btn, this->layout_.px(3), 0);
     lv_obj_set_style_border_color(btn, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_shadow_width(btn, 20, 0);
+    lv_obj_set_style_shadow_width(btn, this->layout_.shadow(20), 0);
     lv_obj_set_style_shadow_opa(btn, LV_OPA_100, 0);
+    this->update_icon_sprite_(app, true);
     
     // Update app name label
     if (this->app_name_label_ != nullptr) {
-      lv_label_set_text(this->app_name_label_, app->get_name().c_str());
+      lv_label_set_text(this->app_name_label_, app->get_name());
     }
   } else {
     // Default style
     lv_obj_set_size(btn, this->button_size_, this->button_size_);
-    lv_obj_set_style_border_width(btn, 2, 0);
+    lv_obj_set_style_border_width(btn, this->layout_.px(2), 0);
     lv_obj_set_style_border_color(btn, lv_color_hex(0x444444), 0);
-    lv_obj_set_style_shadow_width(btn, 8, 0);
+    lv_obj_set_style_shadow_width(btn, this->layout_.shadow(8), 0);
     lv_obj_set_style_shadow_opa(btn, LV_OPA_40, 0);
+    this->update_icon_sprite_(app, false);
+  }
+}
+
+void DialMenuController::update_icon_sprite_(DialApp *app, bool focused) {
+  // The icon is the button's only child, sized for the button it sits in
+  const lv_img_dsc_t *sprite = app->get_icon_sprite(focused);
+  lv_obj_t *icon = lv_obj_get_child(app->get_lvgl_obj(), 0);
+  if (sprite == nullptr || icon == nullptr || !lv_obj_check_type(icon, &lv_img_class)) return;
+  if (lv_img_get_src(icon) != sprite) {
+    lv_img_set_src(icon, sprite);
   }
 }
 
 void DialMenuController::select_app(int index) {
+  // From the main loop while the render task runs: replayed on the render task
+  if (this->defer_to_ui_(
+          [](void *ctx, int32_t arg, float) { static_cast<DialMenuController *>(ctx)->select_app(arg); }, index))
+    return;
   if (this->apps_.empty()) return;
   
   // Wrap around
@@ -306,8 +743,9 @@ void DialMenuController::select_app(int index) {
   index = index % this->apps_.size();
   
   if (index != this->selected_index_) {
-    ESP_LOGD(TAG, "Selected app %d: %s", index, this->apps_[index]->get_name().c_str());
+    ESP_LOGD(TAG, "Selected app %d: %s", index, this->apps_[index]->get_name());
     this->selected_index_ = index;
+    this->save_navigation_();
   }
   this->reset_idle_timer();
 }
@@ -329,27 +767,66 @@ DialApp *DialMenuController::get_selected_app() const {
 }
 
 void DialMenuController::open_selected_app() {
+  if (this->defer_to_ui_([](void *ctx, int32_t, float) { static_cast<DialMenuController *>(ctx)->open_selected_app(); }))
+    return;
   if (this->app_open_) return;
   
   DialApp *app = this->get_selected_app();
   if (app != nullptr) {
     // Only open apps that have a UI - fake apps should not be "opened"
     if (!app->needs_ui()) {
-      ESP_LOGD(TAG, "App '%s' has no UI, ignoring click", app->get_name().c_str());
+      ESP_LOGD(TAG, "App '%s' has no UI, ignoring click", app->get_name());
       return;
     }
-    ESP_LOGI(TAG, "Opening app: %s", app->get_name().c_str());
+    // Opened before loop() got to it: its page is built now
+    if (!app->is_ui_created()) {
+      this->create_app_page_(app);
+    }
+    ESP_LOGI(TAG, "Opening app: %s", app->get_name());
+    this->open_sample_ = MemorySample::take(this->get_disp());
+    app->get_memory_stats().opens++;
+    this->report_memory_(this->open_sample_);
     this->app_open_ = true;
+    app->relabel_if_dirty();
     app->on_enter();
   }
 }
 
+void DialMenuController::set_language(Language language) {
+  if (this->defer_to_ui_(
+          [](void *ctx, int32_t arg, float) { static_cast<DialMenuController *>(ctx)->set_language(static_cast<Language>(arg)); }, static_cast<int32_t>(language)))
+    return;
+  this->language_ = language;
+  this->idle_screen_.set_language(language);
+  
+  // Before setup() the language is simply passed on when the UI is built
+  if (this->launcher_page_ == nullptr) return;
+  
+  ESP_LOGI(TAG, "Switching language to %u", (unsigned) language);
+  lv_label_set_text(this->hint_label_, tr(StringId::LAUNCHER_HINT, language));
+  for (size_t i = 0; i < this->apps_.size(); i++) {
+    DialApp *app = this->apps_[i];
+    app->set_language(language);
+    if (!app->needs_ui()) continue;
+    if (this->app_open_ && (int) i == this->selected_index_) {
+      app->relabel();
+    } else {
+      app->mark_labels_dirty();
+    }
+  }
+  if (this->idle_active_) {
+    this->idle_screen_.update();
+  }
+}
+
 void DialMenuController::close_current_app() {
+  if (this->defer_to_ui_([](void *ctx, int32_t, float) { static_cast<DialMenuController *>(ctx)->close_current_app(); }))
+    return;
   if (!this->app_open_) return;
   
   DialApp *app = this->get_selected_app();
   if (app != nullptr) {
-    ESP_LOGI(TAG, "Closing app: %s", app->get_name().c_str());
+    ESP_LOGI(TAG, "Closing app: %s", app->get_name());
     app->on_exit();
   }
   this->app_open_ = false;
@@ -365,6 +842,16 @@ void DialMenuController::close_current_app() {
       this->update_focus_style(app, true);
     }
   }
+  
+  // What the session kept (caches filled, objects left behind)
+  if (app != nullptr) {
+    MemorySample sample = MemorySample::take(this->get_disp());
+    AppMemoryStats &stats = app->get_memory_stats();
+    stats.last_session_bytes = sample.bytes_since(this->open_sample_);
+    if (stats.last_session_bytes > stats.max_session_bytes) stats.max_session_bytes = stats.last_session_bytes;
+    ESP_LOGD(TAG, "Session of %s kept %+d B", app->get_name(), (int) stats.last_session_bytes);
+    this->report_memory_(sample);
+  }
 }
 
 void DialMenuController::on_app_focused(int index) {
@@ -389,6 +876,8 @@ void DialMenuController::on_app_clicked(int index) {
 }
 
 void DialMenuController::on_button_click() {
+  if (this->defer_to_ui_([](void *ctx, int32_t, float) { static_cast<DialMenuController *>(ctx)->on_button_click(); }))
+    return;
   ESP_LOGI(TAG, "Button click detected");
   this->reset_idle_timer();
   
@@ -410,6 +899,7 @@ void DialMenuController::on_button_click() {
     DialApp *app = this->get_selected_app();
     if (app != nullptr) {
       app->on_button_press();
+      this->save_navigation_();
     }
   } else {
     // In launcher, open the selected app
@@ -418,6 +908,8 @@ void DialMenuController::on_button_click() {
 }
 
 void DialMenuController::on_long_press() {
+  if (this->defer_to_ui_([](void *ctx, int32_t, float) { static_cast<DialMenuController *>(ctx)->on_long_press(); }))
+    return;
   ESP_LOGI(TAG, "Long press detected");
   this->reset_idle_timer();
   
@@ -436,6 +928,8 @@ void DialMenuController::on_long_press() {
 }
 
 void DialMenuController::on_encoder_activity() {
+  if (this->defer_to_ui_([](void *ctx, int32_t, float) { static_cast<DialMenuController *>(ctx)->on_encoder_activity(); }))
+    return;
   this->reset_idle_timer();
   
   // If idle screen is active, wake up
@@ -445,6 +939,9 @@ void DialMenuController::on_encoder_activity() {
 }
 
 void DialMenuController::on_encoder_rotate(int delta) {
+  if (this->defer_to_ui_(
+          [](void *ctx, int32_t arg, float) { static_cast<DialMenuController *>(ctx)->on_encoder_rotate(arg); }, delta))
+    return;
   this->reset_idle_timer();
   
   // If idle screen is active, wake up and don't process further
@@ -458,6 +955,7 @@ void DialMenuController::on_encoder_rotate(int delta) {
     DialApp *app = this->get_selected_app();
     if (app != nullptr) {
       app->on_encoder_rotate(delta);
+      this->save_navigation_();
     }
   }
   // If on launcher, navigation is handled by LVGL group automatically
@@ -468,11 +966,14 @@ void DialMenuController::reset_idle_timer() {
 }
 
 void DialMenuController::show_idle_screen() {
+  if (this->defer_to_ui_([](void *ctx, int32_t, float) { static_cast<DialMenuController *>(ctx)->show_idle_screen(); }))
+    return;
   if (this->idle_active_) {
     return;
   }
   
   ESP_LOGI(TAG, "Entering idle mode");
+  this->finish_boot_();
   
   // Close any open app first
   if (this->app_open_) {
@@ -484,10 +985,13 @@ void DialMenuController::show_idle_screen() {
   }
   
   this->idle_active_ = true;
+  DisplayScope scope(this->get_disp());
   this->idle_screen_.show();
 }
 
 void DialMenuController::wake_up() {
+  if (this->defer_to_ui_([](void *ctx, int32_t, float) { static_cast<DialMenuController *>(ctx)->wake_up(); }))
+    return;
   if (!this->idle_active_) {
     return;
   }
@@ -503,12 +1007,5 @@ void DialMenuController::wake_up() {
   }
 }
 
-// Global function to close the current app - callable from any app
-void close_current_app_global() {
-  if (g_controller != nullptr) {
-    g_controller->close_current_app();
-  }
-}
-
 }  // namespace dial_menu
 }  // namespace esphome
@@ -8,11 +8,19 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
 #include "esphome/components/lvgl/lvgl_esphome.h"
 #include "esphome/components/time/real_time_clock.h"
 #include "esphome/components/font/font.h"
+#include "esphome/components/sensor/sensor.h"
 #include "idle_screen.h"
+#include "layout.h"
+#include "localization.h"
+#include "memory_telemetry.h"
+#include "render_pacer.h"
+#include "render_task.h"
 // Note: App-specific headers (switch_app.h, cover_app.h, etc.) should be included
 // in the .cpp files that need them, not here, to avoid circular dependencies.
 #include <vector>
@@ -21,13 +29,84 @@
 namespace esphome {
 namespace dial_menu {
 
+/**
+ * @brief Makes disp LVGL's default display for a scope
+ *
+ * Screens created with lv_obj_create(nullptr) go to the default display: the
+ * controller builds its pages inside this scope, so with several dials each
+ * one's pages land on its own display.
+ */
+class DisplayScope {
+ public:
+  explicit DisplayScope(lv_disp_t *disp) : previous_(lv_disp_get_default()) {
+    if (disp != nullptr) lv_disp_set_default(disp);
+  }
+  ~DisplayScope() {
+    if (this->previous_ != nullptr) lv_disp_set_default(this->previous_);
+  }
+  DisplayScope(const DisplayScope &) = delete;
+  DisplayScope &operator=(const DisplayScope &) = delete;
+
+ protected:
+  lv_disp_t *previous_;
+};
+
+/**
+ * @brief Tick bookkeeping of one app, kept by the controller
+ */
+struct TickStats {
+  uint32_t next_due{0};   // millis() of the next tick
+  uint32_t count{0};      // Ticks run
+  uint32_t deferred{0};   // Ticks postponed because the loop budget was spent
+  uint64_t total_us{0};   // Time spent in on_tick()
+  uint32_t max_us{0};
+};
+
+/**
+ * @brief Memory attributed to one app, kept by the controller
+ */
+struct AppMemoryStats {
+  int32_t ui_bytes{0};         // Taken by create_app_ui()
+  int32_t ui_objects{0};       // LVGL objects created by create_app_ui()
+  uint32_t opens{0};
+  int32_t last_session_bytes{0};  // Still taken after the last open / close (should stay near 0)
+  int32_t max_session_bytes{0};
+};
+
+/**
+ * @brief Boot stages of the UI, in ms since boot (0 = not reached yet)
+ *
+ * LVGL and the display are set up before the controller, lvgl_ready is when
+ * the controller's setup() starts. The launcher is flushed right after it is
+ * built, the app pages and the idle screen follow one per loop().
+ */
+struct BootTimeline {
+  uint32_t lvgl_ready{0};
+  uint32_t launcher{0};        // Launcher widgets built
+  uint32_t first_frame{0};     // Launcher flushed to the display
+  uint32_t first_frame_us{0};  // Time taken by that first refresh
+  uint32_t pages{0};           // Last app page built
+  uint32_t idle_screen{0};     // Idle screen built, the UI is complete
+};
+
+/**
+ * @brief Where the user was: selected app and the item each app shows
+ */
+struct NavigationSnapshot {
+  static constexpr uint32_t TYPE = 0x4E415631;  // "NAV1"
+  static constexpr size_t MAX_APPS = 16;
+  uint8_t selected;
+  uint8_t view_index[MAX_APPS];
+} __attribute__((packed));
+
 /**
  * @brief Represents a single app in the dial menu
  */
 class DialApp {
  public:
-  void set_name(const std::string &name) { this->name_ = name; }
-  const std::string &get_name() const { return this->name_; }
+  // Names are string literals from the YAML config (not copied)
+  void set_name(const char *name) { this->name_ = name; }
+  const char *get_name() const { return this->name_; }
   
   void set_index(int index) { this->index_ = index; }
   int get_index() const { return this->index_; }
@@ -38,6 +117,21 @@ class DialApp {
   void set_icon(const std::string &icon) { this->icon_ = icon; }
   const std::string &get_icon() const { return this->icon_; }
   
+  // Icon sprite (A8, in the flash atlas generated by codegen) for the normal or focused button size
+  void set_icon_sprite(bool focused, const uint8_t *data, uint16_t width, uint16_t height) {
+    lv_img_dsc_t &sprite = this->icon_sprites_[focused ? 1 : 0];
+    sprite.header.cf = LV_IMG_CF_ALPHA_8BIT;
+    sprite.header.w = width;
+    sprite.header.h = height;
+    sprite.data_size = (uint32_t) width * height;
+    sprite.data = data;
+  }
+  // nullptr if the icon has no sprite (the button then shows an LVGL symbol)
+  const lv_img_dsc_t *get_icon_sprite(bool focused) const {
+    const lv_img_dsc_t &sprite = this->icon_sprites_[focused ? 1 : 0];
+    return sprite.data != nullptr ? &sprite : nullptr;
+  }
+  
   void set_position(int x, int y) { this->pos_x_ = x; this->pos_y_ = y; }
   int get_pos_x() const { return this->pos_x_; }
   int get_pos_y() const { return this->pos_y_; }
@@ -55,17 +149,97 @@ class DialApp {
   // Does this app need its own UI? Override to return true in app types like SwitchApp
   virtual bool needs_ui() const { return false; }
   
-  // Create the app-specific UI - called during setup for apps that need it
+  // Create the app-specific UI - called after boot (one app per loop) or on first open
   virtual void create_app_ui() {}
+  bool is_ui_created() const { return this->ui_created_; }
+  // Set by the controller once create_app_ui() returned
+  void set_ui_created(uint32_t build_us) {
+    this->ui_created_ = true;
+    this->ui_build_us_ = build_us;
+  }
+  uint32_t get_ui_build_us() const { return this->ui_build_us_; }
+  
+  // Periodic work, run by the controller every tick interval.
+  // visible is false when the app ticks in the background (see set_tick_in_background)
+  virtual void on_tick(bool visible) {}
+  // Tick period while the app is on screen, 0 = never ticked
+  void set_tick_interval(uint32_t interval_ms) { this->tick_interval_ms_ = interval_ms; }
+  uint32_t get_tick_interval() const { return this->tick_interval_ms_; }
+  // Keep ticking (at a stretched period) while the app is not on screen
+  void set_tick_in_background(bool background) { this->tick_in_background_ = background; }
+  bool get_tick_in_background() const { return this->tick_in_background_; }
+  TickStats &get_tick_stats() { return this->tick_stats_; }
+  AppMemoryStats &get_memory_stats() { return this->memory_stats_; }
+  
+  // Display geometry and rendering profile, pushed by the controller before create_app_ui()
+  void set_layout(const Layout &layout) { this->layout_ = layout; }
+  const Layout &get_layout() const { return this->layout_; }
+  // Length designed for the 240 px reference display, scaled to this one
+  int32_t px(int32_t reference) const { return this->layout_.px(reference); }
+  int32_t shadow(int32_t reference) const { return this->layout_.shadow(reference); }
+  
+  // UI language, pushed by the controller
+  void set_language(Language language) { this->language_ = language; }
+  Language get_language() const { return this->language_; }
+  const char *tr(StringId id) const { return dial_menu::tr(id, this->language_); }
+  // Item shown by apps that page through several (switches, covers), kept across reboots
+  virtual uint8_t get_view_index() const { return 0; }
+  // Called before create_app_ui(), the index may be out of range if the config changed
+  virtual void restore_view_index(uint8_t index) {}
+  
+  // Re-set every localized label (app is on screen, or about to be)
+  virtual void relabel() {}
+  // Language changed while the app was off screen: relabel it when it opens
+  void mark_labels_dirty() { this->labels_dirty_ = true; }
+  void relabel_if_dirty() {
+    if (!this->labels_dirty_) return;
+    this->labels_dirty_ = false;
+    this->relabel();
+  }
+  // Render task of the controller, nullptr or not running: everything is on the main loop
+  virtual void set_render_task(RenderTask *task) { this->render_task_ = task; }
 
  protected:
-  std::string name_;
+  // Entity callbacks arrive on the main loop: fn(ctx, arg) runs where LVGL lives
+  void run_ui_(void *ctx, UiCommand::Fn fn, int32_t arg = 0) {
+    UiCommand command{fn, ctx, arg, 0.0f};
+    if (this->render_task_ != nullptr) {
+      this->render_task_->run_ui(command);
+    } else {
+      command.run();
+    }
+  }
+  // Entity commands are sent from the main loop: from the render task fn is posted there
+  // and true returned, the caller then stops; false means carry on inline
+  bool defer_to_main_(void *ctx, UiCommand::Fn fn, int32_t arg = 0, float value = 0.0f) {
+    if (this->render_task_ == nullptr || !this->render_task_->in_task()) return false;
+    this->render_task_->run_main({fn, ctx, arg, value});
+    return true;
+  }
+  
+  // Values restored at boot that HA has not confirmed yet are drawn dimmed
+  static void style_stale_(lv_obj_t *obj, bool stale) {
+    if (obj != nullptr) lv_obj_set_style_opa(obj, stale ? LV_OPA_50 : LV_OPA_COVER, 0);
+  }
+  
+  const char *name_{""};
   std::string icon_;
+  lv_img_dsc_t icon_sprites_[2]{};  // Normal, focused
   uint32_t color_{0xFFFFFF};
   int index_{0};
   int pos_x_{0};
   int pos_y_{0};
   lv_obj_t *lvgl_obj_{nullptr};
+  uint32_t tick_interval_ms_{0};
+  bool tick_in_background_{false};
+  TickStats tick_stats_;
+  AppMemoryStats memory_stats_;
+  bool ui_created_{false};
+  uint32_t ui_build_us_{0};
+  Layout layout_;
+  Language language_{Language::EN};
+  bool labels_dirty_{false};
+  RenderTask *render_task_{nullptr};
 };
 
 /**
@@ -87,18 +261,49 @@ class DialMenuController : public Component {
   void set_button_size(int size) { this->button_size_ = size; }
   void set_button_size_focused(int size) { this->button_size_focused_ = size; }
   void set_idle_timeout(uint32_t timeout_ms) { this->idle_timeout_ms_ = timeout_ms; }
+  // Display diameter in pixels; app layouts are scaled from the 240 px reference
+  void set_diameter(int32_t diameter) { this->layout_.diameter = diameter; }
+  // Performance profile (resolved by codegen)
+  void set_shadows(bool shadows) { this->layout_.shadows = shadows; }
+  void set_refresh_period(uint32_t period_ms) { this->layout_.refresh_period_ms = period_ms; }
+  const Layout &get_layout() const { return this->layout_; }
+  // Time on_tick() calls may take per loop() before the remaining ones are deferred
+  void set_tick_budget(uint32_t budget_us) { this->tick_budget_us_ = budget_us; }
   void set_time(time::RealTimeClock *time) { this->time_ = time; }
   void set_font_14(font::Font *font) { this->font_14_ = font; }
   void set_font_18(font::Font *font) { this->font_18_ = font; }
-  void set_language(const std::string &lang) {
-    this->language_ = lang;
-    if (lang == "fr") {
-      this->idle_screen_.set_language(Language::FR);
-    } else {
-      this->idle_screen_.set_language(Language::EN);
-    }
+  // Memory diagnostic sensors, published after setup, on app open / close and every minute
+  void set_heap_free_sensor(sensor::Sensor *sensor) { this->heap_free_sensor_ = sensor; }
+  void set_heap_largest_block_sensor(sensor::Sensor *sensor) { this->heap_largest_block_sensor_ = sensor; }
+  void set_heap_fragmentation_sensor(sensor::Sensor *sensor) { this->heap_fragmentation_sensor_ = sensor; }
+  void set_lvgl_used_sensor(sensor::Sensor *sensor) { this->lvgl_used_sensor_ = sensor; }
+  void set_lvgl_objects_sensor(sensor::Sensor *sensor) { this->lvgl_objects_sensor_ = sensor; }
+  void set_ui_bytes_sensor(sensor::Sensor *sensor) { this->ui_bytes_sensor_ = sensor; }
+  // Time one LVGL refresh may take before the rest of the frame waits for the next one (0 = no limit)
+  void set_render_budget(uint32_t budget_us) { this->render_pacer_.set_budget(budget_us); }
+  const RenderStats &get_render_stats() const { return this->render_pacer_.get_stats(); }
+  // The lvgl component whose display the dial is drawn on
+  void set_lvgl(lvgl::LvglComponent *lvgl) { this->lvgl_ = lvgl; }
+  // LVGL and the UI in their own task pinned to core, the lvgl component's loop stops drawing
+  void set_render_task(uint8_t core) {
+    this->render_task_enabled_ = true;
+    this->render_core_ = core;
   }
-  bool is_french() const { return this->language_ == "fr"; }
+  lv_disp_t *get_disp() const;
+  // The render task when enabled, nullptr when LVGL runs on the main loop
+  RenderTask *get_render_task() { return this->render_task_enabled_ ? &this->render_task_ : nullptr; }
+  // Longest gap between two loop() passes, published every minute
+  void set_loop_stall_sensor(sensor::Sensor *sensor) { this->loop_stall_sensor_ = sensor; }
+  // Boot timing diagnostic sensors (ms since boot), published when the stage is reached
+  void set_first_frame_sensor(sensor::Sensor *sensor) { this->first_frame_sensor_ = sensor; }
+  void set_ui_ready_sensor(sensor::Sensor *sensor) { this->ui_ready_sensor_ = sensor; }
+  const BootTimeline &get_boot_timeline() const { return this->boot_; }
+  // Navigation state kept across reboots, written at most once per interval (0 = not persisted)
+  void set_snapshot_key(const char *key) { this->snapshot_key_ = key; }
+  void set_snapshot_interval(uint32_t interval_ms) { this->snapshot_interval_ms_ = interval_ms; }
+  // Can be called at runtime: only what is on screen is relabeled right away
+  void set_language(Language language);
+  Language get_language() const { return this->language_; }
   
   // Get LVGL font (use custom if set, otherwise fallback to built-in)
   const lv_font_t* get_font_14() const { 
@@ -137,15 +342,56 @@ class DialMenuController : public Component {
   void on_app_clicked(int index);
   
  protected:
-  // Create all LVGL widgets
+  // Create the launcher widgets
   void create_lvgl_ui();
+  // Build one app page, timed and with its memory attributed to the app
+  void create_app_page_(DialApp *app);
+  // Draw the launcher now, before the app pages are built
+  void draw_first_frame_();
+  // One boot step per loop(): the next app page, then the idle screen
+  void run_boot_step_();
+  // Build whatever is left at once (the idle screen is needed now)
+  void finish_boot_();
+  void on_ui_ready_();
+  void log_boot_timeline_();
+  
+  // UI work of a loop() pass: boot steps, idle screen, app ticks
+  void ui_pass_();
+  // Render task body: UI work, then LVGL's timers (input, animations, drawing)
+  static uint32_t render_pass_(void *ctx);
+  // From the main loop while the render task runs: post fn(this, arg) to it and return true
+  bool defer_to_ui_(UiCommand::Fn fn, int32_t arg = 0);
+  // Sample taken on the UI side, published by the main loop
+  void report_memory_(const MemorySample &sample);
+  
+  // Gap since the previous loop() pass
+  void track_loop_gap_();
+  void log_render_stats_();
   void create_center_circle();
   void create_app_button(DialApp *app);
   void update_focus_style(DialApp *app, bool focused);
+  // Swap the icon sprite for the button size
+  void update_icon_sprite_(DialApp *app, bool focused);
   
   // LVGL event callback
   static void button_event_cb(lv_event_t *e);
   
+  // Run the app ticks that are due, within the loop budget
+  void run_ticks_();
+  void log_tick_stats_();
+  
+  // Memory telemetry
+  bool has_memory_sensors_() const;
+  void publish_memory_(const MemorySample &sample);
+  void log_memory_stats_();
+  
+  // Navigation snapshot
+  void restore_navigation_();
+  NavigationSnapshot get_navigation_() const;
+  // Called after any navigation input, schedules a coalesced write
+  void save_navigation_();
+  void write_navigation_();
+  
   std::vector<DialApp *> apps_;
   std::string group_name_{"dial_menu_group"};
   int selected_index_{0};
@@ -153,10 +399,12 @@ class DialMenuController : public Component {
   int button_size_{50};
   int button_size_focused_{58};
   
+  Layout layout_;
+  
   // Custom fonts (optional, nullptr = use built-in)
   font::Font *font_14_{nullptr};
   font::Font *font_18_{nullptr};
-  std::string language_{"en"};
+  Language language_{Language::EN};
   
   // LVGL objects
   lv_obj_t *launcher_page_{nullptr};
@@ -169,19 +417,62 @@ class DialMenuController : public Component {
   time::RealTimeClock *time_{nullptr};
   uint32_t idle_timeout_ms_{30000};  // Default 30 seconds
   uint32_t last_activity_time_{0};
+  uint32_t last_idle_update_{0};
   bool idle_active_{false};
   int last_encoder_value_{0};
   
   // Flag to ignore the click event after a long press
   bool ignore_next_click_{false};
+  
+  // Tick scheduler
+  uint32_t tick_budget_us_{2000};
+  size_t tick_cursor_{0};  // Round robin start, so a deferred app runs first next loop
+  // Apps ticking in the background run this many times slower
+  static constexpr uint32_t BACKGROUND_TICK_STRETCH = 4;
+  
+  // Memory telemetry
+  MemorySample open_sample_;  // Taken when the current app was opened
+  sensor::Sensor *heap_free_sensor_{nullptr};
+  sensor::Sensor *heap_largest_block_sensor_{nullptr};
+  sensor::Sensor *heap_fragmentation_sensor_{nullptr};
+  sensor::Sensor *lvgl_used_sensor_{nullptr};
+  sensor::Sensor *lvgl_objects_sensor_{nullptr};
+  sensor::Sensor *ui_bytes_sensor_{nullptr};
+  static constexpr uint32_t MEMORY_PUBLISH_INTERVAL_MS = 60000;
+  
+  // Boot
+  BootTimeline boot_;
+  bool booting_{false};     // App pages or the idle screen are still to be built
+  size_t boot_cursor_{0};   // Next app whose page is built
+  sensor::Sensor *first_frame_sensor_{nullptr};
+  sensor::Sensor *ui_ready_sensor_{nullptr};
+  
+  // Rendering and loop stalls
+  RenderPacer render_pacer_;
+  RenderTask render_task_;
+  lvgl::LvglComponent *lvgl_{nullptr};
+  bool render_task_enabled_{false};
+  uint8_t render_core_{1};
+  Mutex reported_mutex_;
+  MemorySample reported_sample_;  // Handed from the UI side to the main loop, under reported_mutex_
+  uint32_t last_loop_us_{0};
+  uint32_t max_loop_gap_us_{0};
+  uint32_t window_loop_gap_us_{0};  // Longest gap since the sensor was last published
+  uint32_t loop_stalls_{0};
+  sensor::Sensor *loop_stall_sensor_{nullptr};
+  // A gap longer than this counts as a stall
+  static constexpr uint32_t LOOP_STALL_US = 50000;
+  static constexpr uint32_t STALL_PUBLISH_INTERVAL_MS = 60000;
+  
+  // Navigation snapshot
+  const char *snapshot_key_{nullptr};
+  uint32_t snapshot_interval_ms_{0};
+  ESPPreferenceObject navigation_pref_;
+  bool navigation_open_{false};
+  bool navigation_write_pending_{false};
+  NavigationSnapshot saved_navigation_{};
+  uint32_t last_navigation_write_{0};
 };
 
 }  // namespace dial_menu
 }  // namespace esphome
-
-// Global function to close the current app - callable from any app
-namespace esphome {
-namespace dial_menu {
-void close_current_app_global();
-}  // namespace dial_menu
-}  // namespace esphome
@@ -4,34 +4,21 @@
  */
 
 #include "idle_screen.h"
+#include "esphome/core/log.h"
 
 namespace esphome {
 namespace dial_menu {
 
 static const char *const TAG = "idle_screen";
 
-// English day and month names
-static const char *const DAYS_EN[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
-static const char *const MONTHS_EN[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
-
-// French day and month names
-static const char *const DAYS_FR[] = {"Dimanche", "Lundi", "Mardi", "Mercredi", "Jeudi", "Vendredi", "Samedi"};
-static const char *const MONTHS_FR[] = {"Jan", "Fév", "Mars", "Avr", "Mai", "Juin", "Juil", "Août", "Sep", "Oct", "Nov", "Déc"};
-
 const char *IdleScreen::get_day_name(int day_of_week) {
   if (day_of_week < 1 || day_of_week > 7) return "";
-  if (this->language_ == Language::FR) {
-    return DAYS_FR[day_of_week - 1];
-  }
-  return DAYS_EN[day_of_week - 1];
+  return tr(day_string(day_of_week), this->language_);
 }
 
 const char *IdleScreen::get_month_name(int month) {
   if (month < 1 || month > 12) return "";
-  if (this->language_ == Language::FR) {
-    return MONTHS_FR[month - 1];
-  }
-  return MONTHS_EN[month - 1];
+  return tr(month_string(month), this->language_);
 }
 
 void IdleScreen::create_ui() {
@@ -43,40 +30,40 @@ void IdleScreen::create_ui() {
   
   // Day of week at top
   this->day_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->day_label_, LV_ALIGN_TOP_MID, 0, 40);
+  lv_obj_align(this->day_label_, LV_ALIGN_TOP_MID, 0, this->layout_.px(40));
   lv_obj_set_style_text_color(this->day_label_, lv_color_hex(0xAAAAAA), 0);
   // Use custom font if available (for French accents), otherwise fallback to LVGL default
   lv_obj_set_style_text_font(this->day_label_, this->custom_font_18_ ? this->custom_font_18_ : &lv_font_montserrat_18, 0);
-  lv_label_set_text(this->day_label_, "Monday");
+  lv_label_set_text(this->day_label_, "");
   
   // Large time display - hours
   this->time_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->time_label_, LV_ALIGN_CENTER, -25, -20);
+  lv_obj_align(this->time_label_, LV_ALIGN_CENTER, this->layout_.px(-25), this->layout_.px(-20));
   lv_obj_set_style_text_color(this->time_label_, lv_color_hex(0xFFFFFF), 0);
   lv_obj_set_style_text_font(this->time_label_, &lv_font_montserrat_48, 0);
   lv_label_set_text(this->time_label_, "12");
   
   // Minutes below hours
   this->minute_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->minute_label_, LV_ALIGN_CENTER, -25, 35);
+  lv_obj_align(this->minute_label_, LV_ALIGN_CENTER, this->layout_.px(-25), this->layout_.px(35));
   lv_obj_set_style_text_color(this->minute_label_, lv_color_hex(0xFFFFFF), 0);
   lv_obj_set_style_text_font(this->minute_label_, &lv_font_montserrat_48, 0);
   lv_label_set_text(this->minute_label_, "34");
   
   // Date on the right side (day number)
   this->date_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->date_label_, LV_ALIGN_CENTER, 60, -15);
+  lv_obj_align(this->date_label_, LV_ALIGN_CENTER, this->layout_.px(60), this->layout_.px(-15));
   lv_obj_set_style_text_color(this->date_label_, lv_color_hex(0xCCCCCC), 0);
   lv_obj_set_style_text_font(this->date_label_, &lv_font_montserrat_28, 0);
   lv_label_set_text(this->date_label_, "13");
   
   // Month below day number
   this->month_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->month_label_, LV_ALIGN_CENTER, 60, 15);
+  lv_obj_align(this->month_label_, LV_ALIGN_CENTER, this->layout_.px(60), this->layout_.px(15));
   lv_obj_set_style_text_color(this->month_label_, lv_color_hex(0xAAAAAA), 0);
   // Use custom font if available (for French accents), otherwise fallback to LVGL default
   lv_obj_set_style_text_font(this->month_label_, this->custom_font_18_ ? this->custom_font_18_ : &lv_font_montserrat_18, 0);
-  lv_label_set_text(this->month_label_, "June");
+  lv_label_set_text(this->month_label_, "");
   
   ESP_LOGI(TAG, "Idle screen UI created");
 }
@@ -13,6 +13,8 @@
 #include "esphome/core/component.h"
 #include "esphome/components/time/real_time_clock.h"
 #include "esphome/components/lvgl/lvgl_esphome.h"
+#include "layout.h"
+#include "localization.h"
 
 namespace esphome {
 namespace dial_menu {
@@ -26,15 +28,15 @@ namespace dial_menu {
  * - Afternoon (12:00-18:00): Light blue/cyan
  * - Evening (18:00-22:00): Deep blue/purple
  */
-// Language enum
-enum class Language { EN, FR };
-
 class IdleScreen {
  public:
   // Set the time source
   void set_time(time::RealTimeClock *time) { this->time_ = time; }
   
-  // Set the display language
+  // Display geometry (before create_ui())
+  void set_layout(const Layout &layout) { this->layout_ = layout; }
+  
+  // Set the display language (takes effect on the next update())
   void set_language(Language lang) { this->language_ = lang; }
   
   // Set custom font for French characters (18pt for day/month labels)
@@ -64,6 +66,7 @@ class IdleScreen {
   time::RealTimeClock *time_{nullptr};
   bool visible_{false};
   Language language_{Language::EN};
+  Layout layout_;
   const lv_font_t *custom_font_18_{nullptr};  // Custom font with French characters
   
   // Get localized day/month names
@@ -0,0 +1,40 @@
+/**
+ * @file layout.h
+ * @brief Display geometry and rendering profile of a dial menu
+ *
+ * Layout constants in the apps are written for the 240 px reference display
+ * (M5Stack Dial, GC9A01A) and scaled with px() to the configured diameter, so
+ * the same apps fit 360-466 px round panels. The diameter and the profile are
+ * resolved by codegen from the YAML (`diameter`, `performance_profile`).
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace dial_menu {
+
+struct Layout {
+  // Diameter the layout constants are designed for
+  static constexpr int32_t REFERENCE_DIAMETER = 240;
+
+  int32_t diameter{REFERENCE_DIAMETER};
+  // Rendering profile
+  bool shadows{true};               // Drop shadows, expensive on large panels
+  uint32_t refresh_period_ms{30};   // LVGL refresh period, which also paces animations
+
+  // Scale a length from the reference display (rounded, a non-zero length stays non-zero)
+  int32_t px(int32_t reference) const {
+    if (reference == 0) return 0;
+    int32_t scaled = reference * this->diameter;
+    int32_t half = REFERENCE_DIAMETER / 2;
+    int32_t value = (scaled >= 0 ? scaled + half : scaled - half) / REFERENCE_DIAMETER;
+    if (value == 0) return reference > 0 ? 1 : -1;
+    return value;
+  }
+  // Shadow width, 0 when the profile disables shadows
+  int32_t shadow(int32_t reference) const { return this->shadows ? this->px(reference) : 0; }
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
@@ -0,0 +1,274 @@
+/**
+ * @file light_app.cpp
+ * @brief Implementation of the Light App with live (streamed) brightness control
+ */
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DIAL_MENU_LIGHT
+
+#include "light_app.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace dial_menu {
+
+static const char *const TAG = "light_app";
+
+void LightApp::on_enter() {
+  ESP_LOGI(TAG, "Entering Light App: %s", this->name_);
+  this->active_ = true;
+  this->mode_ = LightMode::BRIGHTNESS;
+  this->adjusting_ = false;
+
+  if (this->page_ != nullptr) {
+    lv_scr_load(this->page_);
+    this->update_state();
+  }
+}
+
+void LightApp::on_exit() {
+  ESP_LOGI(TAG, "Exiting Light App: %s", this->name_);
+  // Make sure the last value reaches HA
+  if (this->adjusting_) {
+    this->commit_();
+  }
+  this->active_ = false;
+}
+
+void LightApp::on_button_press() {
+  ESP_LOGD(TAG, "Button pressed in Light App");
+  if (this->light_ != nullptr && this->light_->supports_color_temp()) {
+    this->next_mode();
+  } else {
+    this->toggle();
+  }
+}
+
+void LightApp::on_encoder_rotate(int delta) {
+  ESP_LOGD(TAG, "Encoder rotated: %d", delta);
+  this->adjust_(delta);
+}
+
+void LightApp::toggle() {
+  if (this->light_ == nullptr) return;
+  if (this->defer_to_main_(this, [](void *app, int32_t, float) { static_cast<LightApp *>(app)->toggle(); }))
+    return;
+  ESP_LOGI(TAG, "Toggling light: %s", this->light_->get_entity_id());
+  this->light_->toggle();
+}
+
+void LightApp::next_mode() {
+  if (this->adjusting_) {
+    this->commit_();
+  }
+  if (this->mode_ == LightMode::BRIGHTNESS && this->light_ != nullptr && this->light_->supports_color_temp()) {
+    this->mode_ = LightMode::COLOR_TEMP;
+  } else {
+    this->mode_ = LightMode::BRIGHTNESS;
+  }
+  ESP_LOGD(TAG, "Mode: %s", this->mode_ == LightMode::BRIGHTNESS ? "brightness" : "color_temp");
+  this->update_state();
+}
+
+float LightApp::get_light_value_() const {
+  if (this->light_ == nullptr) return 0.0f;
+  if (this->mode_ == LightMode::COLOR_TEMP) {
+    return this->light_->get_color_temp_kelvin();
+  }
+  return this->light_->is_on() ? this->light_->get_brightness() : 0.0f;
+}
+
+void LightApp::adjust_(int delta) {
+  if (this->light_ == nullptr || delta == 0) return;
+
+  // Start from the light's state unless the user is already turning the dial
+  if (!this->adjusting_ || millis() - this->last_input_time_ > INPUT_HOLD_MS) {
+    this->target_ = this->get_light_value_();
+  }
+  this->adjusting_ = true;
+  this->last_input_time_ = millis();
+
+  if (this->mode_ == LightMode::COLOR_TEMP) {
+    this->target_ = clamp(this->target_ + delta * this->color_temp_step_,
+                          this->light_->get_min_color_temp_kelvin(), this->light_->get_max_color_temp_kelvin());
+  } else {
+    this->target_ = clamp(this->target_ + delta * this->brightness_step_, 0.0f, 1.0f);
+  }
+  this->send_(this->mode_, this->target_, true);
+
+  // Immediate visual feedback, the light catches up at the stream rate
+  this->update_value_display_(this->target_);
+}
+
+void LightApp::commit_() {
+  if (this->light_ == nullptr) return;
+  this->send_(this->mode_, this->target_, false);
+  this->adjusting_ = false;
+}
+
+void LightApp::send_(LightMode mode, float value, bool stream) {
+  // Mode and stream flag travel packed in the command's argument
+  if (this->defer_to_main_(this, [](void *app, int32_t arg, float value) {
+        static_cast<LightApp *>(app)->send_(static_cast<LightMode>(arg >> 1), value, (arg & 1) != 0);
+      }, (static_cast<int32_t>(mode) << 1) | (stream ? 1 : 0), value))
+    return;
+  if (mode == LightMode::COLOR_TEMP) {
+    if (stream) {
+      this->light_->stream_color_temp_kelvin(value);
+    } else {
+      this->light_->set_color_temp_kelvin(value);
+    }
+  } else if (stream) {
+    this->light_->stream_brightness(value);
+  } else {
+    this->light_->set_brightness(value);
+  }
+}
+
+void LightApp::on_tick(bool visible) {
+  if (this->adjusting_ && millis() - this->last_input_time_ > INPUT_HOLD_MS) {
+    this->update_state();
+  }
+}
+
+void LightApp::create_app_ui() {
+  ESP_LOGI(TAG, "Creating UI for Light App: %s", this->name_);
+
+  this->set_tick_interval(TICK_INTERVAL_MS);
+  
+  // Create a new screen/page for this app
+  this->page_ = lv_obj_create(nullptr);
+  lv_obj_set_style_bg_color(this->page_, lv_color_hex(0x000000), 0);
+
+  const lv_font_t *font_14 = this->font_14_ ? this->font_14_->get_lv_font() : &lv_font_montserrat_14;
+
+  // Light name at top
+  this->name_label_ = lv_label_create(this->page_);
+  lv_obj_align(this->name_label_, LV_ALIGN_TOP_MID, 0, this->px(25));
+  lv_obj_set_style_text_color(this->name_label_, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_text_font(this->name_label_, font_14, 0);
+  lv_label_set_text(this->name_label_, this->name_);
+
+  // Value arc
+  this->value_arc_ = lv_arc_create(this->page_);
+  lv_obj_set_size(this->value_arc_, this->px(180), this->px(180));
+  lv_obj_align(this->value_arc_, LV_ALIGN_CENTER, 0, this->px(5));
+  lv_arc_set_rotation(this->value_arc_, 135);
+  lv_arc_set_bg_angles(this->value_arc_, 0, 270);
+  lv_arc_set_range(this->value_arc_, 0, 100);
+  lv_arc_set_value(this->value_arc_, 0);
+  lv_obj_remove_style(this->value_arc_, NULL, LV_PART_KNOB);
+  lv_obj_clear_flag(this->value_arc_, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_style_arc_width(this->value_arc_, this->px(12), LV_PART_MAIN);
+  lv_obj_set_style_arc_width(this->value_arc_, this->px(12), LV_PART_INDICATOR);
+  lv_obj_set_style_arc_color(this->value_arc_, lv_color_hex(0x333333), LV_PART_MAIN);
+  lv_obj_set_style_arc_color(this->value_arc_, lv_color_hex(this->color_), LV_PART_INDICATOR);
+
+  // Power button in the center, shows the value
+  this->power_btn_ = lv_btn_create(this->page_);
+  lv_obj_set_size(this->power_btn_, this->px(100), this->px(100));
+  lv_obj_align(this->power_btn_, LV_ALIGN_CENTER, 0, this->px(5));
+  lv_obj_set_style_radius(this->power_btn_, this->px(50), 0);
+  lv_obj_set_style_bg_color(this->power_btn_, lv_color_hex(0x222222), 0);
+  lv_obj_set_style_border_width(this->power_btn_, this->px(2), 0);
+  lv_obj_set_style_border_color(this->power_btn_, lv_color_hex(0x555555), 0);
+  lv_obj_set_user_data(this->power_btn_, this);
+  lv_obj_add_event_cb(this->power_btn_, power_btn_event_cb, LV_EVENT_CLICKED, nullptr);
+
+  this->value_label_ = lv_label_create(this->power_btn_);
+  lv_obj_center(this->value_label_);
+  lv_obj_set_style_text_color(this->value_label_, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_text_font(this->value_label_, &lv_font_montserrat_28, 0);
+  lv_label_set_text(this->value_label_, "--");
+
+  // Mode label (what the encoder adjusts)
+  this->mode_label_ = lv_label_create(this->page_);
+  lv_obj_align(this->mode_label_, LV_ALIGN_BOTTOM_MID, 0, this->px(-30));
+  lv_obj_set_style_text_color(this->mode_label_, lv_color_hex(0x888888), 0);
+  lv_obj_set_style_text_font(this->mode_label_, font_14, 0);
+  lv_label_set_text(this->mode_label_, "");
+
+  // Register state callback
+  if (this->light_ != nullptr) {
+    this->light_->add_on_state_callback([this]() {
+      this->run_ui_(this, [](void *ctx, int32_t, float) {
+        auto *app = static_cast<LightApp *>(ctx);
+        if (app->active_) {
+          app->update_state();
+        }
+      });
+    });
+  }
+
+  this->update_state();
+  ESP_LOGI(TAG, "Light App UI created");
+}
+
+void LightApp::update_state() {
+  if (this->light_ == nullptr || this->page_ == nullptr) return;
+
+  // While the user turns the dial, keep showing the local target
+  bool holding = this->adjusting_ && millis() - this->last_input_time_ <= INPUT_HOLD_MS;
+  float value = holding ? this->target_ : this->get_light_value_();
+  if (!holding) {
+    this->adjusting_ = false;
+  }
+
+  if (this->mode_label_ != nullptr) {
+    if (this->mode_ == LightMode::COLOR_TEMP) {
+      lv_label_set_text(this->mode_label_, this->tr(StringId::LIGHT_COLOR_TEMP));
+    } else {
+      lv_label_set_text(this->mode_label_, this->tr(StringId::LIGHT_BRIGHTNESS));
+    }
+  }
+
+  if (this->power_btn_ != nullptr) {
+    bool on = this->light_->is_on();
+    lv_obj_set_style_border_color(this->power_btn_, lv_color_hex(on ? this->color_ : 0x555555), 0);
+  }
+
+  this->update_value_display_(value);
+  style_stale_(this->value_arc_, this->light_->is_stale());
+  style_stale_(this->value_label_, this->light_->is_stale());
+}
+
+void LightApp::update_value_display_(float value) {
+  if (this->value_arc_ == nullptr || this->value_label_ == nullptr) return;
+
+  char buf[16];
+  if (this->mode_ == LightMode::COLOR_TEMP) {
+    int min_k = static_cast<int>(this->light_->get_min_color_temp_kelvin());
+    int max_k = static_cast<int>(this->light_->get_max_color_temp_kelvin());
+    lv_arc_set_range(this->value_arc_, min_k, max_k);
+    lv_arc_set_value(this->value_arc_, static_cast<int>(value));
+    lv_obj_set_style_arc_color(this->value_arc_, lv_color_hex(0xFFB300), LV_PART_INDICATOR);
+    snprintf(buf, sizeof(buf), "%dK", static_cast<int>(value));
+  } else {
+    int percent = static_cast<int>(value * 100.0f + 0.5f);
+    lv_arc_set_range(this->value_arc_, 0, 100);
+    lv_arc_set_value(this->value_arc_, percent);
+    lv_obj_set_style_arc_color(this->value_arc_, lv_color_hex(this->color_), LV_PART_INDICATOR);
+    if (percent == 0) {
+      snprintf(buf, sizeof(buf), "%s", LV_SYMBOL_POWER);
+    } else {
+      snprintf(buf, sizeof(buf), "%d%%", percent);
+    }
+  }
+  lv_label_set_text(this->value_label_, buf);
+}
+
+void LightApp::power_btn_event_cb(lv_event_t *e) {
+  lv_obj_t *btn = lv_event_get_target(e);
+  LightApp *app = static_cast<LightApp *>(lv_obj_get_user_data(btn));
+
+  if (app != nullptr) {
+    app->toggle();
+  }
+}
+
+}  // namespace dial_menu
+}  // namespace esphome
+
+#endif  // USE_DIAL_MENU_LIGHT
@@ -0,0 +1,105 @@
+/**
+ * @file light_app.h
+ * @brief Light App - Controls a Home Assistant light with the encoder
+ *
+ * Rotating the encoder streams brightness (or colour temperature) to the light
+ * while the dial moves, so the lamp follows the dial live.
+ */
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DIAL_MENU_LIGHT
+
+#include "dial_menu_controller.h"
+#include "esphome/components/font/font.h"
+#include "esphome/components/homeassistant_addon/homeassistant_light.h"
+
+namespace esphome {
+namespace dial_menu {
+
+/**
+ * @brief Which light property the encoder adjusts
+ */
+enum class LightMode {
+  BRIGHTNESS,
+  COLOR_TEMP
+};
+
+/**
+ * @brief App that controls a single Home Assistant light
+ *
+ * Features:
+ * - Rotate encoder to adjust brightness (streamed live, rate limited)
+ * - Press button to switch to colour temperature (if supported)
+ * - Touch the center to toggle the light
+ * - Arc showing the current value
+ */
+class LightApp : public DialApp {
+ public:
+  void set_light(homeassistant_addon::HomeassistantLight *light) { this->light_ = light; }
+  void set_brightness_step(float step) { this->brightness_step_ = step; }
+  void set_color_temp_step(float step) { this->color_temp_step_ = step; }
+  void set_font_14(font::Font *font) { this->font_14_ = font; }
+
+  // App lifecycle - called by DialMenuController
+  void on_enter() override;
+  void on_exit() override;
+  void on_button_press() override;
+  void on_encoder_rotate(int delta) override;
+  // Falls back to the entity's value once the input hold expires
+  void on_tick(bool visible) override;
+
+  // This app needs its own UI page
+  bool needs_ui() const override { return true; }
+
+  // Create the app's UI (called during setup)
+  void create_app_ui() override;
+  void relabel() override { this->update_state(); }
+
+  // Update UI to match current light state
+  void update_state();
+
+  // Light control
+  void toggle();
+  void next_mode();
+
+ protected:
+  // Value shown and adjusted in the current mode
+  float get_light_value_() const;
+  void adjust_(int delta);
+  void commit_();
+  // Stream (dial turning) or set (committed) the value of a mode, from the main loop
+  void send_(LightMode mode, float value, bool stream);
+  void update_value_display_(float value);
+
+  homeassistant_addon::HomeassistantLight *light_{nullptr};
+  float brightness_step_{0.05f};
+  float color_temp_step_{100.0f};
+  font::Font *font_14_{nullptr};
+
+  LightMode mode_{LightMode::BRIGHTNESS};
+  bool active_{false};
+
+  // Local target while the encoder moves (HA state lags behind the stream)
+  float target_{0.0f};
+  bool adjusting_{false};
+  uint32_t last_input_time_{0};
+  static constexpr uint32_t INPUT_HOLD_MS = 1000;
+  static constexpr uint32_t TICK_INTERVAL_MS = 250;
+
+  // LVGL objects for this app's UI
+  lv_obj_t *page_{nullptr};
+  lv_obj_t *name_label_{nullptr};
+  lv_obj_t *value_arc_{nullptr};
+  lv_obj_t *value_label_{nullptr};
+  lv_obj_t *mode_label_{nullptr};
+  lv_obj_t *power_btn_{nullptr};
+
+  static void power_btn_event_cb(lv_event_t *e);
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
+
+#endif  // USE_DIAL_MENU_LIGHT
@@ -0,0 +1,18 @@
+/**
+ * @file localization.cpp
+ * @brief The string table generated from DIAL_MENU_STRINGS
+ */
+
+#include "localization.h"
+
+namespace esphome {
+namespace dial_menu {
+
+const char *const STRING_TABLE[static_cast<size_t>(StringId::COUNT)][static_cast<size_t>(Language::COUNT)] = {
+#define DIAL_MENU_STRING_ROW(id, en, fr) {en, fr},
+    DIAL_MENU_STRINGS(DIAL_MENU_STRING_ROW)
+#undef DIAL_MENU_STRING_ROW
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
@@ -0,0 +1,102 @@
+/**
+ * @file localization.h
+ * @brief UI strings of the dial menu, one column per language
+ *
+ * Every text the component renders itself is listed once in DIAL_MENU_STRINGS.
+ * The list expands into the StringId enum and into a constant table kept in
+ * flash, so a lookup is a plain array index: no string compare, no allocation.
+ * The Python codegen reads the same list to know which glyphs the fonts need.
+ *
+ * To add a language, add it to Language (before COUNT), add a column to every
+ * entry below and to LANGUAGES in __init__.py.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace dial_menu {
+
+enum class Language : uint8_t { EN, FR, COUNT };
+
+// clang-format off
+// X(id, english, french)
+#define DIAL_MENU_STRINGS(X) \
+  X(LAUNCHER_HINT,          "Press to open",   "Appuyer pour ouvrir") \
+  X(COVER_OPENING,          "Opening...",      "Ouverture...") \
+  X(COVER_CLOSING,          "Closing...",      "Fermeture...") \
+  X(COVER_OPEN,             "Open",            "Ouvert") \
+  X(COVER_CLOSED,           "Closed",          "Fermé") \
+  X(COVER_PARTIAL,          "Partial",         "Partiel") \
+  X(COVER_POSITION,         "Position",        "Position") \
+  X(COVER_TILT,             "Tilt",            "Inclinaison") \
+  X(CLIMATE_CURRENT,        "Current",         "Actuel") \
+  X(CLIMATE_HEATING,        "Heating...",      "Chauffage...") \
+  X(CLIMATE_COOLING,        "Cooling...",      "Refroidissement...") \
+  X(CLIMATE_IDLE,           "Idle",            "En attente") \
+  X(CLIMATE_DRYING,         "Drying...",       "Séchage...") \
+  X(CLIMATE_FAN,            "Fan...",          "Ventilation...") \
+  X(CLIMATE_STOPPED,        "Off",             "Arrêté") \
+  X(CLIMATE_MODE_HEAT,      "Heat",            "Chauff.") \
+  X(CLIMATE_MODE_COOL,      "Cool",            "Froid") \
+  X(CLIMATE_MODE_AUTO,      "Auto",            "Auto") \
+  X(CLIMATE_MODE_DRY,       "Dry",             "Sec") \
+  X(CLIMATE_MODE_FAN,       "Fan",             "Vent.") \
+  X(CLIMATE_MODE_OFF,       "OFF",             "OFF") \
+  X(LIGHT_BRIGHTNESS,       "Brightness",      "Luminosité") \
+  X(LIGHT_COLOR_TEMP,       "Color temp",      "Température") \
+  X(MEDIA_PLAYING,          "Playing",         "Lecture") \
+  X(MEDIA_PAUSED,           "Paused",          "Pause") \
+  X(MEDIA_IDLE,             "Idle",            "Inactif") \
+  X(MEDIA_OFF,              "Off",             "Éteint") \
+  X(MEDIA_ON,               "On",              "Allumé") \
+  X(MEDIA_STANDBY,          "Standby",         "Veille") \
+  X(MEDIA_BUFFERING,        "Buffering...",    "Chargement...") \
+  X(MEDIA_UNKNOWN,          "Unknown",         "Inconnu") \
+  X(MEDIA_MUTED,            "Muted",           "Muet") \
+  X(DAY_SUNDAY,             "Sunday",          "Dimanche") \
+  X(DAY_MONDAY,             "Monday",          "Lundi") \
+  X(DAY_TUESDAY,            "Tuesday",         "Mardi") \
+  X(DAY_WEDNESDAY,          "Wednesday",       "Mercredi") \
+  X(DAY_THURSDAY,           "Thursday",        "Jeudi") \
+  X(DAY_FRIDAY,             "Friday",          "Vendredi") \
+  X(DAY_SATURDAY,           "Saturday",        "Samedi") \
+  X(MONTH_JAN,              "Jan",             "Jan") \
+  X(MONTH_FEB,              "Feb",             "Fév") \
+  X(MONTH_MAR,              "Mar",             "Mars") \
+  X(MONTH_APR,              "Apr",             "Avr") \
+  X(MONTH_MAY,              "May",             "Mai") \
+  X(MONTH_JUN,              "Jun",             "Juin") \
+  X(MONTH_JUL,              "Jul",             "Juil") \
+  X(MONTH_AUG,              "Aug",             "Août") \
+  X(MONTH_SEP,              "Sep",             "Sep") \
+  X(MONTH_OCT,              "Oct",             "Oct") \
+  X(MONTH_NOV,              "Nov",             "Nov") \
+  X(MONTH_DEC,              "Dec",             "Déc")
+// clang-format on
+
+enum class StringId : uint16_t {
+#define DIAL_MENU_STRING_ID(id, en, fr) id,
+  DIAL_MENU_STRINGS(DIAL_MENU_STRING_ID)
+#undef DIAL_MENU_STRING_ID
+  COUNT
+};
+
+// Rows in StringId order, columns in Language order
+extern const char *const STRING_TABLE[static_cast<size_t>(StringId::COUNT)][static_cast<size_t>(Language::COUNT)];
+
+inline const char *tr(StringId id, Language language) {
+  return STRING_TABLE[static_cast<size_t>(id)][static_cast<size_t>(language)];
+}
+
+// Days (1 = Sunday) and months (1 = January) as used by ESPTime
+inline StringId day_string(int day_of_week) {
+  return static_cast<StringId>(static_cast<int>(StringId::DAY_SUNDAY) + day_of_week - 1);
+}
+inline StringId month_string(int month) {
+  return static_cast<StringId>(static_cast<int>(StringId::MONTH_JAN) + month - 1);
+}
+
+}  // namespace dial_menu
+}  // namespace esphome
@@ -21,23 +21,28 @@ static const char *const TAG = "media_player_app";
 #define SYMBOL_MUTE "\xEF\x80\xA6"       // 
 
 void MediaPlayerApp::create_app_ui() {
-  ESP_LOGD(TAG, "Creating MediaPlayerApp UI for '%s'", this->name_.c_str());
+  ESP_LOGD(TAG, "Creating MediaPlayerApp UI for '%s'", this->name_);
+
+  this->volume_committer_.set_debounce(VOLUME_DEBOUNCE_MS);
+  this->volume_committer_.set_max_latency(VOLUME_MAX_LATENCY_MS);
+  this->volume_committer_.set_min_interval(VOLUME_MIN_INTERVAL_MS);
 
   // Create a separate page for this app
   this->page_ = lv_obj_create(nullptr);
   lv_obj_set_style_bg_color(this->page_, lv_color_hex(0x000000), 0);
 
-  // Main container on the page
+  // Main container on the page, as large as the display
+  int32_t diameter = this->get_layout().diameter;
   this->container_ = lv_obj_create(this->page_);
   lv_obj_remove_style_all(this->container_);
-  lv_obj_set_size(this->container_, 240, 240);
+  lv_obj_set_size(this->container_, diameter, diameter);
   lv_obj_center(this->container_);
   lv_obj_set_style_bg_color(this->container_, lv_color_hex(0x000000), 0);
   lv_obj_set_style_bg_opa(this->container_, LV_OPA_COVER, 0);
 
   // Volume arc (background)
   this->volume_arc_ = lv_arc_create(this->container_);
-  lv_obj_set_size(this->volume_arc_, 230, 230);
+  lv_obj_set_size(this->volume_arc_, diameter - this->px(10), diameter - this->px(10));
   lv_obj_center(this->volume_arc_);
   lv_arc_set_rotation(this->volume_arc_, 135);
   lv_arc_set_bg_angles(this->volume_arc_, 0, 270);
@@ -48,53 +53,83 @@ void MediaPlayerApp::create_app_ui() {
 
   // Arc styling
   lv_obj_set_style_arc_color(this->volume_arc_, lv_color_hex(0x333333), LV_PART_MAIN);
-  lv_obj_set_style_arc_width(this->volume_arc_, 8, LV_PART_MAIN);
+  lv_obj_set_style_arc_width(this->volume_arc_, this->px(8), LV_PART_MAIN);
   lv_obj_set_style_arc_color(this->volume_arc_, lv_color_hex(this->color_), LV_PART_INDICATOR);
-  lv_obj_set_style_arc_width(this->volume_arc_, 8, LV_PART_INDICATOR);
+  lv_obj_set_style_arc_width(this->volume_arc_, this->px(8), LV_PART_INDICATOR);
+
+#ifdef USE_DIAL_MENU_ALBUM_ART
+  // Album art - dimmed circle behind the media info, hidden until art is available
+  if (this->album_art_image_ != nullptr) {
+    this->art_img_ = lv_img_create(this->container_);
+    lv_obj_set_size(this->art_img_, ALBUM_ART_SIZE, ALBUM_ART_SIZE);
+    lv_obj_align(this->art_img_, LV_ALIGN_CENTER, 0, this->px(-15));
+    lv_obj_set_style_radius(this->art_img_, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_clip_corner(this->art_img_, true, 0);
+    lv_obj_set_style_img_opa(this->art_img_, LV_OPA_40, 0);
+    lv_obj_add_flag(this->art_img_, LV_OBJ_FLAG_HIDDEN);
+
+    this->album_art_image_->add_on_finished_callback([this](bool cached) {
+      this->run_ui_(this, [](void *app, int32_t, float) {
+        static_cast<MediaPlayerApp *>(app)->on_album_art_downloaded_();
+      });
+    });
+    this->album_art_image_->add_on_error_callback([this]() {
+      this->run_ui_(this, [](void *ctx, int32_t, float) {
+        auto *app = static_cast<MediaPlayerApp *>(ctx);
+        ESP_LOGW(TAG, "Album art download failed: %s", app->requested_art_url_.c_str());
+        app->album_art_cache_.mark_failed(app->requested_art_url_, millis());
+        app->requested_art_url_.clear();
+        // The track may have changed meanwhile; the failed URL waits for its backoff
+        app->update_album_art_();
+      });
+    });
+    this->set_tick_interval(ART_RETRY_TICK_MS);
+  }
+#endif
 
   // State/source label (top)
   this->state_label_ = lv_label_create(this->container_);
   lv_obj_set_style_text_font(this->state_label_, &lv_font_montserrat_14, 0);
   lv_obj_set_style_text_color(this->state_label_, lv_color_hex(0x888888), 0);
-  lv_obj_align(this->state_label_, LV_ALIGN_TOP_MID, 0, 35);
+  lv_obj_align(this->state_label_, LV_ALIGN_TOP_MID, 0, this->px(35));
   lv_label_set_text(this->state_label_, "");
 
   // Media title (center-top)
   this->title_label_ = lv_label_create(this->container_);
   lv_obj_set_style_text_font(this->title_label_, &lv_font_montserrat_18, 0);
   lv_obj_set_style_text_color(this->title_label_, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_width(this->title_label_, 180);
+  lv_obj_set_width(this->title_label_, this->px(180));
   lv_label_set_long_mode(this->title_label_, LV_LABEL_LONG_SCROLL_CIRCULAR);
   lv_obj_set_style_text_align(this->title_label_, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_align(this->title_label_, LV_ALIGN_CENTER, 0, -35);
+  lv_obj_align(this->title_label_, LV_ALIGN_CENTER, 0, this->px(-35));
   lv_label_set_text(this->title_label_, "");
 
   // Media artist (center)
   this->artist_label_ = lv_label_create(this->container_);
   lv_obj_set_style_text_font(this->artist_label_, &lv_font_montserrat_14, 0);
   lv_obj_set_style_text_color(this->artist_label_, lv_color_hex(0xAAAAAA), 0);
-  lv_obj_set_width(this->artist_label_, 160);
+  lv_obj_set_width(this->artist_label_, this->px(160));
   lv_label_set_long_mode(this->artist_label_, LV_LABEL_LONG_SCROLL_CIRCULAR);
   lv_obj_set_style_text_align(this->artist_label_, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_align(this->artist_label_, LV_ALIGN_CENTER, 0, -10);
+  lv_obj_align(this->artist_label_, LV_ALIGN_CENTER, 0, this->px(-10));
   lv_label_set_text(this->artist_label_, "");
 
   // Volume label (center-bottom)
   this->volume_label_ = lv_label_create(this->container_);
   lv_obj_set_style_text_font(this->volume_label_, &lv_font_montserrat_14, 0);
   lv_obj_set_style_text_color(this->volume_label_, lv_color_hex(this->color_), 0);
-  lv_obj_align(this->volume_label_, LV_ALIGN_CENTER, 0, 15);
+  lv_obj_align(this->volume_label_, LV_ALIGN_CENTER, 0, this->px(15));
   lv_label_set_text(this->volume_label_, "");
 
   // Control buttons container
   lv_obj_t *btn_container = lv_obj_create(this->container_);
   lv_obj_remove_style_all(btn_container);
-  lv_obj_set_size(btn_container, 180, 50);
-  lv_obj_align(btn_container, LV_ALIGN_CENTER, 0, 55);
+  lv_obj_set_size(btn_container, this->px(180), this->px(50));
+  lv_obj_align(btn_container, LV_ALIGN_CENTER, 0, this->px(55));
 
   // Previous button (left)
   this->btn_prev_ = lv_btn_create(btn_container);
-  lv_obj_set_size(this->btn_prev_, 50, 50);
+  lv_obj_set_size(this->btn_prev_, this->px(50), this->px(50));
   lv_obj_align(this->btn_prev_, LV_ALIGN_LEFT_MID, 0, 0);
   lv_obj_set_style_radius(this->btn_prev_, LV_RADIUS_CIRCLE, 0);
   lv_obj_set_style_bg_color(this->btn_prev_, lv_color_hex(0x333333), 0);
@@ -105,7 +140,7 @@ void MediaPlayerApp::create_app_ui() {
 
   // Play/Pause button (center)
   this->btn_play_ = lv_btn_create(btn_container);
-  lv_obj_set_size(this->btn_play_, 50, 50);
+  lv_obj_set_size(this->btn_play_, this->px(50), this->px(50));
   lv_obj_align(this->btn_play_, LV_ALIGN_CENTER, 0, 0);
   lv_obj_set_style_radius(this->btn_play_, LV_RADIUS_CIRCLE, 0);
   lv_obj_set_style_bg_color(this->btn_play_, lv_color_hex(this->color_), 0);
@@ -116,7 +151,7 @@ void MediaPlayerApp::create_app_ui() {
 
   // Next button (right)
   this->btn_next_ = lv_btn_create(btn_container);
-  lv_obj_set_size(this->btn_next_, 50, 50);
+  lv_obj_set_size(this->btn_next_, this->px(50), this->px(50));
   lv_obj_align(this->btn_next_, LV_ALIGN_RIGHT_MID, 0, 0);
   lv_obj_set_style_radius(this->btn_next_, LV_RADIUS_CIRCLE, 0);
   lv_obj_set_style_bg_color(this->btn_next_, lv_color_hex(0x333333), 0);
@@ -127,32 +162,87 @@ void MediaPlayerApp::create_app_ui() {
 
   // Set initial button selection visual
   this->selected_button_ = 1;  // Play/pause selected by default
-  lv_obj_set_style_outline_width(this->btn_play_, 2, 0);
+  lv_obj_set_style_outline_width(this->btn_play_, this->px(2), 0);
   lv_obj_set_style_outline_color(this->btn_play_, lv_color_hex(0xFFFFFF), 0);
   lv_obj_set_style_outline_pad(this->btn_play_, 3, 0);
+
+  // Register as a consumer of the media player (not visible until entered)
+  if (this->media_player_ != nullptr) {
+    this->interest_handle_ = this->media_player_->register_consumer(homeassistant_addon::Interest::NONE,
+                                                                    [this]() { this->post_view_(); });
+  }
+}
+
+void MediaPlayerApp::View::copy_from(const View &other) {
+  this->state = other.state;
+  this->volume = other.volume;
+  this->muted = other.muted;
+  this->stale = other.stale;
+  this->title.assign(other.title.ref());
+  this->artist.assign(other.artist.ref());
+  this->source.assign(other.source.ref());
+  this->picture.assign(other.picture.ref());
+}
+
+void MediaPlayerApp::post_view_() {
+  {
+    LockGuard lock(this->view_mutex_);
+    View &view = this->posted_view_;
+    view.state = this->media_player_->get_state();
+    view.volume = this->media_player_->get_volume();
+    view.muted = this->media_player_->is_muted();
+    view.stale = this->media_player_->is_stale();
+    view.title.assign(this->media_player_->get_media_title().ref());
+    view.artist.assign(this->media_player_->get_media_artist().ref());
+    view.source.assign(this->media_player_->get_source().ref());
+    view.picture.assign(this->media_player_->get_entity_picture().ref());
+  }
+  this->run_ui_(this, [](void *ctx, int32_t, float) {
+    auto *app = static_cast<MediaPlayerApp *>(ctx);
+    if (app->visible_) {
+      app->update_ui_();
+    }
+  });
 }
 
 void MediaPlayerApp::on_exit() {
-  ESP_LOGI(TAG, "Exiting MediaPlayerApp: %s", this->name_.c_str());
+  ESP_LOGI(TAG, "Exiting MediaPlayerApp: %s", this->name_);
+  this->volume_committer_.flush();
   // Don't delete UI - it's persistent on the page
+  this->visible_ = false;
+  this->set_interest_(homeassistant_addon::Interest::NONE);
+}
+
+void MediaPlayerApp::set_interest_(homeassistant_addon::Interest interest) {
+  if (this->media_player_ == nullptr) return;
+  if (this->defer_to_main_(this, [](void *app, int32_t interest, float) {
+        static_cast<MediaPlayerApp *>(app)->set_interest_(static_cast<homeassistant_addon::Interest>(interest));
+      }, static_cast<int32_t>(interest)))
+    return;
+  this->media_player_->set_interest(this->interest_handle_, interest);
+  // Nothing may have changed while hidden, the view is refreshed anyway
+  if (interest == homeassistant_addon::Interest::VISIBLE) this->post_view_();
+}
+
+void MediaPlayerApp::send_volume_(float volume) {
+  if (this->defer_to_main_(this, [](void *app, int32_t, float volume) {
+        static_cast<MediaPlayerApp *>(app)->send_volume_(volume);
+      }, 0, volume))
+    return;
+  this->media_player_->set_volume(volume);
 }
 
 void MediaPlayerApp::on_enter() {
-  ESP_LOGI(TAG, "Entering MediaPlayerApp: %s", this->name_.c_str());
+  ESP_LOGI(TAG, "Entering MediaPlayerApp: %s", this->name_);
   
   // Load the app page
   if (this->page_ != nullptr) {
     lv_scr_load(this->page_);
   }
   
-  // Register state callback (only once)
-  static bool callback_registered = false;
-  if (this->media_player_ != nullptr && !callback_registered) {
-    this->media_player_->add_on_state_callback([this]() {
-      this->update_ui_();
-    });
-    callback_registered = true;
-  }
+  // Metadata deferred while hidden is parsed now
+  this->visible_ = true;
+  this->set_interest_(homeassistant_addon::Interest::VISIBLE);
 
   // Update UI
   this->update_ui_();
@@ -163,38 +253,37 @@ void MediaPlayerApp::update_ui_() {
     return;
   }
 
-  // Check for pending volume change
-  if (this->pending_volume_ >= 0 && (millis() - this->last_volume_change_) >= VOLUME_DEBOUNCE_MS) {
-    ESP_LOGD(TAG, "Sending debounced volume: %.2f", this->pending_volume_);
-    this->media_player_->set_volume(this->pending_volume_);
-    this->pending_volume_ = -1.0f;
+  {
+    LockGuard lock(this->view_mutex_);
+    this->view_.copy_from(this->posted_view_);
   }
-
   this->update_state_display_();
   this->update_media_info_();
   this->update_volume_arc_();
+#ifdef USE_DIAL_MENU_ALBUM_ART
+  this->update_album_art_();
+#endif
 }
 
 void MediaPlayerApp::update_state_display_() {
   if (this->state_label_ == nullptr || this->media_player_ == nullptr) return;
 
-  std::string state_text = this->get_state_text_();
-  
-  // Add source if available
-  const std::string &source = this->media_player_->get_source();
+  // Add source if available (a long source name is cut, the label clips anyway)
+  const char *state_text = this->get_state_text_();
+  const auto &source = this->view_.source;
   if (!source.empty()) {
-    if (!state_text.empty()) {
-      state_text += " • ";
-    }
-    state_text += source;
+    char buf[96];
+    snprintf(buf, sizeof(buf), "%s • %s", state_text, source.c_str());
+    lv_label_set_text(this->state_label_, buf);
+  } else {
+    lv_label_set_text(this->state_label_, state_text);
   }
-
-  lv_label_set_text(this->state_label_, state_text.c_str());
+  style_stale_(this->state_label_, this->view_.stale);
+  style_stale_(this->volume_arc_, this->view_.stale);
 
   // Update play/pause button icon
   if (this->btn_play_label_ != nullptr) {
-    auto state = this->media_player_->get_state();
-    if (state == homeassistant_addon::MediaPlayerState::PLAYING) {
+    if (this->view_.state == homeassistant_addon::MediaPlayerState::PLAYING) {
       lv_label_set_text(this->btn_play_label_, SYMBOL_PAUSE);
     } else {
       lv_label_set_text(this->btn_play_label_, SYMBOL_PLAY);
@@ -206,16 +295,16 @@ void MediaPlayerApp::update_media_info_() {
   if (this->media_player_ == nullptr) return;
 
   if (this->title_label_ != nullptr) {
-    const std::string &title = this->media_player_->get_media_title();
+    const auto &title = this->view_.title;
     if (title.empty()) {
-      lv_label_set_text(this->title_label_, this->name_.c_str());
+      lv_label_set_text(this->title_label_, this->name_);
     } else {
       lv_label_set_text(this->title_label_, title.c_str());
     }
   }
 
   if (this->artist_label_ != nullptr) {
-    const std::string &artist = this->media_player_->get_media_artist();
+    const auto &artist = this->view_.artist;
     lv_label_set_text(this->artist_label_, artist.c_str());
   }
 }
@@ -223,18 +312,21 @@ void MediaPlayerApp::update_media_info_() {
 void MediaPlayerApp::update_volume_arc_() {
   if (this->volume_arc_ == nullptr || this->media_player_ == nullptr) return;
 
-  float volume = this->media_player_->get_volume();
+  // Keep showing the local value until it has been sent
+  float volume = this->volume_committer_.has_pending() ? this->volume_committer_.get_pending()
+                                                        : this->view_.volume;
   int vol_percent = static_cast<int>(volume * 100);
 
   lv_arc_set_value(this->volume_arc_, vol_percent);
 
   if (this->volume_label_ != nullptr) {
-    bool muted = this->media_player_->is_muted();
+    bool muted = this->view_.muted;
+    char buf[32];
     if (muted) {
-      lv_label_set_text(this->volume_label_, SYMBOL_MUTE " Muet");
+      snprintf(buf, sizeof(buf), SYMBOL_MUTE " %s", this->tr(StringId::MEDIA_MUTED));
+      lv_label_set_text(this->volume_label_, buf);
       lv_obj_set_style_text_color(this->volume_label_, lv_color_hex(0x888888), 0);
     } else {
-      char buf[16];
       snprintf(buf, sizeof(buf), SYMBOL_VOLUME_UP " %d%%", vol_percent);
       lv_label_set_text(this->volume_label_, buf);
       lv_obj_set_style_text_color(this->volume_label_, lv_color_hex(this->color_), 0);
@@ -242,40 +334,107 @@ void MediaPlayerApp::update_volume_arc_() {
   }
 }
 
-std::string MediaPlayerApp::get_state_text_() {
-  if (this->media_player_ == nullptr) return "";
+#ifdef USE_DIAL_MENU_ALBUM_ART
+void MediaPlayerApp::update_album_art_() {
+  if (this->art_img_ == nullptr || this->media_player_ == nullptr) return;
+
+  const auto &picture = this->view_.picture;
+  std::string url = picture.empty() ? std::string() : this->album_art_base_url_ + picture.c_str();
+  if (url == this->shown_art_url_) return;
+
+  if (url.empty()) {
+    lv_obj_add_flag(this->art_img_, LV_OBJ_FLAG_HIDDEN);
+    this->shown_art_url_.clear();
+    return;
+  }
+
+  // Failed lately: no art until its backoff has passed (on_tick() tries again)
+  if (!this->album_art_cache_.can_download(url, millis())) {
+    lv_obj_add_flag(this->art_img_, LV_OBJ_FLAG_HIDDEN);
+    this->shown_art_url_.clear();
+    return;
+  }
 
-  bool is_french = true;
-  if (this->controller_ != nullptr) {
-    is_french = this->controller_->is_french();
+  // Cache hit: show immediately, no download needed
+  const lv_img_dsc_t *cached = this->album_art_cache_.find(url);
+  if (cached != nullptr) {
+    ESP_LOGD(TAG, "Album art cache hit");
+    lv_img_set_src(this->art_img_, cached);
+    lv_obj_clear_flag(this->art_img_, LV_OBJ_FLAG_HIDDEN);
+    this->shown_art_url_ = url;
+    return;
+  }
+
+  // Cache miss: hide the old art and start a download (one at a time)
+  lv_obj_add_flag(this->art_img_, LV_OBJ_FLAG_HIDDEN);
+  this->shown_art_url_.clear();
+  if (this->requested_art_url_.empty()) {
+    ESP_LOGD(TAG, "Downloading album art: %s", url.c_str());
+    this->requested_art_url_ = url;
+    this->start_album_art_download_();
   }
+}
+
+void MediaPlayerApp::on_tick(bool visible) {
+  // Only while the art is missing and nothing is being downloaded
+  if (!visible || !this->shown_art_url_.empty() || !this->requested_art_url_.empty()) return;
+  this->update_album_art_();
+}
+
+void MediaPlayerApp::start_album_art_download_() {
+  // requested_art_url_ is left alone until the download finishes or fails
+  if (this->defer_to_main_(this, [](void *app, int32_t, float) {
+        static_cast<MediaPlayerApp *>(app)->start_album_art_download_();
+      }))
+    return;
+  this->album_art_image_->set_url(this->requested_art_url_);
+  this->album_art_image_->update();
+}
+
+void MediaPlayerApp::on_album_art_downloaded_() {
+  if (this->requested_art_url_.empty()) return;
+
+  // Keep the decoded frame, then free the download buffers of the online image
+  const lv_img_dsc_t *stored =
+      this->album_art_cache_.store(this->requested_art_url_, this->album_art_image_->get_lv_img_dsc());
+  this->album_art_image_->release();
+  this->requested_art_url_.clear();
 
-  auto state = this->media_player_->get_state();
-  switch (state) {
+  if (stored == nullptr) return;
+  // The track may have changed while downloading - this picks the right art or starts the next download
+  this->update_album_art_();
+}
+#endif
+
+const char *MediaPlayerApp::get_state_text_() {
+  if (this->media_player_ == nullptr) return "";
+
+  switch (this->view_.state) {
     case homeassistant_addon::MediaPlayerState::PLAYING:
-      return is_french ? "Lecture" : "Playing";
+      return this->tr(StringId::MEDIA_PLAYING);
     case homeassistant_addon::MediaPlayerState::PAUSED:
-      return is_french ? "Pause" : "Paused";
+      return this->tr(StringId::MEDIA_PAUSED);
     case homeassistant_addon::MediaPlayerState::IDLE:
-      return is_french ? "Inactif" : "Idle";
+      return this->tr(StringId::MEDIA_IDLE);
     case homeassistant_addon::MediaPlayerState::OFF:
-      return is_french ? "Éteint" : "Off";
+      return this->tr(StringId::MEDIA_OFF);
     case homeassistant_addon::MediaPlayerState::ON:
-      return is_french ? "Allumé" : "On";
+      return this->tr(StringId::MEDIA_ON);
     case homeassistant_addon::MediaPlayerState::STANDBY:
-      return is_french ? "Veille" : "Standby";
+      return this->tr(StringId::MEDIA_STANDBY);
     case homeassistant_addon::MediaPlayerState::BUFFERING:
-      return is_french ? "Chargement..." : "Buffering...";
+      return this->tr(StringId::MEDIA_BUFFERING);
     default:
-      return is_french ? "Inconnu" : "Unknown";
+      return this->tr(StringId::MEDIA_UNKNOWN);
   }
 }
 
 void MediaPlayerApp::on_encoder_rotate(int direction) {
   if (this->media_player_ == nullptr) return;
 
-  // Adjust volume with encoder
-  float current_volume = this->media_player_->get_volume();
+  // Adjust volume with encoder, from the value still pending if the dial is turning
+  float current_volume = this->volume_committer_.has_pending() ? this->volume_committer_.get_pending()
+                                                                : this->view_.volume;
   float step = this->volume_step_;  // Use local volume step
   float new_volume = current_volume + (direction * step);
 
@@ -285,8 +444,7 @@ void MediaPlayerApp::on_encoder_rotate(int direction) {
   ESP_LOGD(TAG, "Volume change: %.2f -> %.2f (pending)", current_volume, new_volume);
 
   // Debounced volume update
-  this->pending_volume_ = new_volume;
-  this->last_volume_change_ = millis();
+  this->volume_committer_.update(new_volume);
 
   // Update arc immediately for visual feedback
   if (this->volume_arc_ != nullptr) {
@@ -299,11 +457,12 @@ void MediaPlayerApp::on_encoder_rotate(int direction) {
   }
 }
 
-void MediaPlayerApp::on_button_press() {
-  if (this->media_player_ == nullptr) return;
-
-  // Perform action based on selected button
-  switch (this->selected_button_) {
+void MediaPlayerApp::press_button_(int button) {
+  if (this->defer_to_main_(this, [](void *app, int32_t button, float) {
+        static_cast<MediaPlayerApp *>(app)->press_button_(button);
+      }, button))
+    return;
+  switch (button) {
     case 0:  // Previous
       ESP_LOGD(TAG, "Previous track");
       this->media_player_->previous_track();
@@ -317,6 +476,13 @@ void MediaPlayerApp::on_button_press() {
       this->media_player_->next_track();
       break;
   }
+}
+
+void MediaPlayerApp::on_button_press() {
+  if (this->media_player_ == nullptr) return;
+
+  // Perform action based on selected button
+  this->press_button_(this->selected_button_);
 
   // Cycle to next button
   int old_selection = this->selected_button_;
@@ -332,7 +498,7 @@ void MediaPlayerApp::on_button_press() {
   
   // Set new selection outline
   if (buttons[this->selected_button_] != nullptr) {
-    lv_obj_set_style_outline_width(buttons[this->selected_button_], 2, 0);
+    lv_obj_set_style_outline_width(buttons[this->selected_button_], this->px(2), 0);
     lv_obj_set_style_outline_color(buttons[this->selected_button_], lv_color_hex(0xFFFFFF), 0);
     lv_obj_set_style_outline_pad(buttons[this->selected_button_], 3, 0);
   }
@@ -5,8 +5,14 @@
 #ifdef USE_DIAL_MENU_MEDIA_PLAYER
 
 #include "dial_menu_controller.h"
+#include "setpoint_committer.h"
+#include "esphome/core/helpers.h"
 #include "esphome/components/font/font.h"
 #include "esphome/components/homeassistant_addon/homeassistant_media_player.h"
+#ifdef USE_DIAL_MENU_ALBUM_ART
+#include "esphome/components/online_image/online_image.h"
+#include "album_art.h"
+#endif
 #include <string>
 
 namespace esphome {
@@ -20,16 +26,30 @@ namespace dial_menu {
  * - Play/Pause/Previous/Next controls
  * - Media info display (title, artist)
  * - Mute toggle
+ * - Album art (optional, fetched from HA and cached in PSRAM)
  */
 class MediaPlayerApp : public DialApp {
  public:
-  void set_controller(DialMenuController *controller) { this->controller_ = controller; }
+  void set_controller(DialMenuController *controller) { this->volume_committer_.set_owner(controller); }
+  void set_render_task(RenderTask *task) override {
+    DialApp::set_render_task(task);
+    this->volume_committer_.set_render_task(task);
+  }
   void set_media_player(homeassistant_addon::HomeassistantMediaPlayer *media_player) {
     this->media_player_ = media_player;
   }
   void set_volume_step(float step) { this->volume_step_ = step; }
   void set_font_14(font::Font *font) { this->font_14_ = font; }
   void set_font_18(font::Font *font) { this->font_18_ = font; }
+#ifdef USE_DIAL_MENU_ALBUM_ART
+  // Album art: online_image used to download/decode, HA base URL and number of cached images
+  void set_album_art_image(online_image::OnlineImage *image) { this->album_art_image_ = image; }
+  void set_album_art_base_url(const std::string &url) { this->album_art_base_url_ = url; }
+  void set_album_art_cache_size(size_t size) { this->album_art_cache_.set_capacity(size); }
+  const AlbumArtCache &get_album_art_cache() const { return this->album_art_cache_; }
+  // Retries a failed album art download once its backoff has passed
+  void on_tick(bool visible) override;
+#endif
 
   // App lifecycle - called by DialMenuController
   void on_enter() override;
@@ -42,21 +62,60 @@ class MediaPlayerApp : public DialApp {
   
   // Create the app-specific UI
   void create_app_ui() override;
+  void relabel() override {
+    this->update_state_display_();
+    this->update_volume_arc_();
+  }
 
  protected:
   void update_ui_();
   void update_state_display_();
   void update_media_info_();
   void update_volume_arc_();
-  std::string get_state_text_();
+#ifdef USE_DIAL_MENU_ALBUM_ART
+  void update_album_art_();
+  void on_album_art_downloaded_();
+#endif
+  const char *get_state_text_();
   const char *get_state_icon_();
+  // Main loop: copy what the UI shows from the media player, then have the UI redrawn
+  void post_view_();
+  // Entity commands, sent from the main loop
+  void set_interest_(homeassistant_addon::Interest interest);
+  void send_volume_(float volume);
+  void press_button_(int button);
+#ifdef USE_DIAL_MENU_ALBUM_ART
+  void start_album_art_download_();
+#endif
 
   homeassistant_addon::HomeassistantMediaPlayer *media_player_{nullptr};
-  DialMenuController *controller_{nullptr};
   float volume_step_{0.05f};
   font::Font *font_14_{nullptr};
   font::Font *font_18_{nullptr};
 
+  // Consumer handle on the media player, UI only updated while visible
+  size_t interest_handle_{0};
+  bool visible_{false};
+
+  // What the UI shows of the media player. The render task must not read the
+  // mirror's strings while the main loop rewrites them: post_view_() copies
+  // them into posted_view_ under view_mutex_, update_ui_() takes that copy.
+  struct View {
+    homeassistant_addon::MediaPlayerState state{homeassistant_addon::MediaPlayerState::UNKNOWN};
+    float volume{0.0f};
+    bool muted{false};
+    bool stale{false};
+    homeassistant_addon::InlineString<HOMEASSISTANT_ADDON_MEDIA_TITLE_LENGTH> title;
+    homeassistant_addon::InlineString<HOMEASSISTANT_ADDON_MEDIA_ARTIST_LENGTH> artist;
+    homeassistant_addon::InlineString<HOMEASSISTANT_ADDON_MEDIA_SOURCE_LENGTH> source;
+    homeassistant_addon::InlineString<HOMEASSISTANT_ADDON_MEDIA_PICTURE_LENGTH> picture;
+
+    void copy_from(const View &other);
+  };
+  Mutex view_mutex_;
+  View posted_view_;  // Main loop side, guarded by view_mutex_
+  View view_;         // UI side
+
   // UI elements
   lv_obj_t *page_{nullptr};
   lv_obj_t *container_{nullptr};
@@ -65,6 +124,7 @@ class MediaPlayerApp : public DialApp {
   lv_obj_t *artist_label_{nullptr};
   lv_obj_t *state_label_{nullptr};
   lv_obj_t *volume_label_{nullptr};
+  lv_obj_t *art_img_{nullptr};
 
   // Control buttons
   lv_obj_t *btn_prev_{nullptr};
@@ -77,10 +137,22 @@ class MediaPlayerApp : public DialApp {
   // Current button selection (0=prev, 1=play/pause, 2=next)
   int selected_button_{1};
 
-  // Volume debounce
-  float pending_volume_{-1.0f};
-  uint32_t last_volume_change_{0};
+  // Volume set with the encoder, sent by the committer (debounced, with a deadline)
+  SetpointCommitter volume_committer_{[this](float volume) { this->send_volume_(volume); }};
   static constexpr uint32_t VOLUME_DEBOUNCE_MS = 500;
+  static constexpr uint32_t VOLUME_MAX_LATENCY_MS = 1000;
+  static constexpr uint32_t VOLUME_MIN_INTERVAL_MS = 300;
+
+#ifdef USE_DIAL_MENU_ALBUM_ART
+  // Album art
+  online_image::OnlineImage *album_art_image_{nullptr};
+  std::string album_art_base_url_;
+  AlbumArtCache album_art_cache_;
+  std::string shown_art_url_;     // URL of the art currently displayed
+  std::string requested_art_url_; // URL of the download in flight (empty if none)
+  static constexpr int ALBUM_ART_SIZE = 120;
+  static constexpr uint32_t ART_RETRY_TICK_MS = 1000;
+#endif
 };
 
 }  // namespace dial_menu
@@ -0,0 +1,146 @@
+/**
+ * @file memory_policy.cpp
+ * @brief heap_caps backed pools on ESP32, simulated arenas elsewhere
+ */
+
+#include "memory_policy.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_ESP32
+#include <esp_heap_caps.h>
+#include <soc/soc.h>
+#endif
+#include <cstdlib>
+
+namespace esphome {
+namespace dial_menu {
+
+static const char *const TAG = "dial_menu.memory";
+
+static PoolCounters counters[static_cast<size_t>(MemoryPool::COUNT)];
+
+static PoolCounters &counters_of(MemoryPool pool) { return counters[static_cast<size_t>(pool)]; }
+
+static MemoryPool other_pool(MemoryPool pool) {
+  return pool == MemoryPool::INTERNAL ? MemoryPool::EXTERNAL : MemoryPool::INTERNAL;
+}
+
+#ifdef USE_ESP32
+
+static void *pool_alloc(MemoryPool pool, size_t size) {
+  uint32_t caps = pool == MemoryPool::EXTERNAL ? MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+                                               : MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+  return heap_caps_malloc(size, caps);
+}
+
+static MemoryPool pool_of(const void *ptr) {
+#if defined(SOC_EXTRAM_DATA_LOW) && defined(SOC_EXTRAM_DATA_HIGH)
+  auto address = reinterpret_cast<uintptr_t>(ptr);
+  if (address >= SOC_EXTRAM_DATA_LOW && address < SOC_EXTRAM_DATA_HIGH) return MemoryPool::EXTERNAL;
+#endif
+  return MemoryPool::INTERNAL;
+}
+
+static void pool_free(void *ptr) { heap_caps_free(ptr); }
+
+size_t MemoryPolicy::get_free(MemoryPool pool) {
+  return heap_caps_get_free_size(pool == MemoryPool::EXTERNAL ? MALLOC_CAP_SPIRAM : MALLOC_CAP_INTERNAL);
+}
+
+#else  // Host: one arena per pool, each block prefixed with its pool
+
+struct Arena {
+  size_t capacity;
+  size_t used;
+};
+// Defaults close to an ESP32-S3 with 8 MB PSRAM
+static Arena arenas[static_cast<size_t>(MemoryPool::COUNT)] = {{320 * 1024, 0}, {8 * 1024 * 1024, 0}};
+
+struct alignas(alignof(std::max_align_t)) BlockHeader {
+  MemoryPool pool;
+  size_t size;
+};
+
+static void *pool_alloc(MemoryPool pool, size_t size) {
+  Arena &arena = arenas[static_cast<size_t>(pool)];
+  if (arena.used > arena.capacity || size > arena.capacity - arena.used) return nullptr;
+  auto *header = static_cast<BlockHeader *>(std::malloc(sizeof(BlockHeader) + size));
+  if (header == nullptr) return nullptr;
+  header->pool = pool;
+  header->size = size;
+  arena.used += size;
+  return header + 1;
+}
+
+static MemoryPool pool_of(const void *ptr) { return (static_cast<const BlockHeader *>(ptr) - 1)->pool; }
+
+static void pool_free(void *ptr) {
+  auto *header = static_cast<BlockHeader *>(ptr) - 1;
+  arenas[static_cast<size_t>(header->pool)].used -= header->size;
+  std::free(header);
+}
+
+size_t MemoryPolicy::get_free(MemoryPool pool) {
+  const Arena &arena = arenas[static_cast<size_t>(pool)];
+  return arena.used < arena.capacity ? arena.capacity - arena.used : 0;
+}
+
+void MemoryPolicy::set_arena_capacity(MemoryPool pool, size_t capacity) {
+  arenas[static_cast<size_t>(pool)].capacity = capacity;
+}
+
+#endif  // USE_ESP32
+
+void *MemoryPolicy::allocate(Placement placement, size_t size) {
+  if (size == 0) return nullptr;
+  MemoryPool preferred = preferred_pool(placement);
+  MemoryPool pool = preferred;
+  void *ptr = pool_alloc(pool, size);
+  if (ptr == nullptr) {
+    pool = other_pool(preferred);
+    ptr = pool_alloc(pool, size);
+    if (ptr == nullptr) {
+      counters_of(preferred).failures++;
+      return nullptr;
+    }
+    counters_of(pool).fallbacks++;
+  }
+
+  PoolCounters &c = counters_of(pool);
+  c.in_use += size;
+  c.allocations++;
+  if (c.in_use > c.peak) c.peak = c.in_use;
+  return ptr;
+}
+
+void MemoryPolicy::deallocate(void *ptr, size_t size) {
+  if (ptr == nullptr) return;
+  counters_of(pool_of(ptr)).in_use -= size;
+  pool_free(ptr);
+}
+
+void MemoryPolicy::out_of_memory(Placement placement, size_t size) {
+  ESP_LOGE(TAG, "Out of memory: %u B for %s data, no pool can serve it", (unsigned) size,
+           placement == Placement::COLD ? "cold" : "hot");
+  MemoryPolicy::dump_config(TAG);
+  abort();
+}
+
+const PoolCounters &MemoryPolicy::get_counters(MemoryPool pool) { return counters_of(pool); }
+
+const char *MemoryPolicy::pool_name(MemoryPool pool) {
+  return pool == MemoryPool::EXTERNAL ? "PSRAM" : "internal";
+}
+
+void MemoryPolicy::dump_config(const char *tag) {
+  for (size_t i = 0; i < static_cast<size_t>(MemoryPool::COUNT); i++) {
+    auto pool = static_cast<MemoryPool>(i);
+    const PoolCounters &c = counters_of(pool);
+    ESP_LOGCONFIG(tag, "  Memory %s: %u B in use (peak %u), %u allocations, %u fallbacks, %u failures, %u B free",
+                  pool_name(pool), (unsigned) c.in_use, (unsigned) c.peak, (unsigned) c.allocations,
+                  (unsigned) c.fallbacks, (unsigned) c.failures, (unsigned) get_free(pool));
+  }
+}
+
+}  // namespace dial_menu
+}  // namespace esphome
@@ -0,0 +1,95 @@
+/**
+ * @file memory_policy.h
+ * @brief Placement of dial_menu's own allocations in internal SRAM or PSRAM
+ *
+ * Data is tagged with how it's used rather than where it should go:
+ * - HOT: touched on every frame or encoder step, kept in internal SRAM
+ * - COLD: long-lived and rarely touched (configuration tables, caches,
+ *   snapshots), placed in PSRAM when the board has it
+ * A request the preferred pool can't serve falls back to the other one; a
+ * container whose request neither pool can serve stops the device, as a
+ * failed operator new does without exceptions. Each pool counts its bytes in
+ * use, peak, allocations and fallbacks, reported by the controller's
+ * dump_config.
+ *
+ * LVGL widgets come from LVGL's heap and the draw buffers from the lvgl
+ * component; neither goes through this policy.
+ *
+ * Off-target (host build) the two pools are simulated with separate arenas of
+ * fixed capacity, so exhaustion and fallbacks behave like on the device.
+ */
+#pragma once
+
+#include "esphome/core/defines.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace dial_menu {
+
+enum class MemoryPool : uint8_t { INTERNAL, EXTERNAL, COUNT };
+enum class Placement : uint8_t { HOT, COLD };
+
+struct PoolCounters {
+  size_t in_use{0};
+  size_t peak{0};
+  uint32_t allocations{0};
+  uint32_t fallbacks{0};  // Allocations served here because the preferred pool couldn't
+  uint32_t failures{0};   // Allocations preferring this pool that no pool could serve
+};
+
+class MemoryPolicy {
+ public:
+  // nullptr when neither pool has room
+  static void *allocate(Placement placement, size_t size);
+  static void deallocate(void *ptr, size_t size);
+  // A container's storage could not be allocated: logs the pools and aborts
+  [[noreturn]] static void out_of_memory(Placement placement, size_t size);
+
+  static MemoryPool preferred_pool(Placement placement) {
+    return placement == Placement::COLD ? MemoryPool::EXTERNAL : MemoryPool::INTERNAL;
+  }
+  static const PoolCounters &get_counters(MemoryPool pool);
+  // Bytes still available in the pool (whole heap region, not just dial_menu's share)
+  static size_t get_free(MemoryPool pool);
+  static const char *pool_name(MemoryPool pool);
+
+  // Log one line per pool
+  static void dump_config(const char *tag);
+
+#ifndef USE_ESP32
+  // Capacity of a simulated arena; 0 simulates a board without that pool
+  static void set_arena_capacity(MemoryPool pool, size_t capacity);
+#endif
+};
+
+// Standard allocator placing a container's storage according to the policy
+template<typename T, Placement P> class PoolAllocator {
+ public:
+  using value_type = T;
+  template<typename U> struct rebind {
+    using other = PoolAllocator<U, P>;
+  };
+
+  PoolAllocator() = default;
+  template<typename U> PoolAllocator(const PoolAllocator<U, P> &) {}
+
+  // Never nullptr: containers don't check, so a request no pool can serve aborts
+  T *allocate(size_t n) {
+    if (n > SIZE_MAX / sizeof(T)) MemoryPolicy::out_of_memory(P, SIZE_MAX);
+    void *ptr = MemoryPolicy::allocate(P, n * sizeof(T));
+    if (ptr == nullptr && n > 0) MemoryPolicy::out_of_memory(P, n * sizeof(T));
+    return static_cast<T *>(ptr);
+  }
+  void deallocate(T *ptr, size_t n) { MemoryPolicy::deallocate(ptr, n * sizeof(T)); }
+
+  template<typename U> bool operator==(const PoolAllocator<U, P> &) const { return true; }
+  template<typename U> bool operator!=(const PoolAllocator<U, P> &) const { return false; }
+};
+
+// Configuration tables: filled once at setup, read when an app opens
+template<typename T> using ColdVector = std::vector<T, PoolAllocator<T, Placement::COLD>>;
+
+}  // namespace dial_menu
+}  // namespace esphome
@@ -0,0 +1,59 @@
+/**
+ * @file memory_telemetry.cpp
+ * @brief Sampling of the LVGL and ESP heaps
+ */
+
+#include "memory_telemetry.h"
+#include "memory_policy.h"
+
+#ifdef USE_ESP32
+#include <esp_heap_caps.h>
+#endif
+
+namespace esphome {
+namespace dial_menu {
+
+static uint32_t count_objects(lv_obj_t *obj) {
+  uint32_t count = 1;
+  uint32_t children = lv_obj_get_child_cnt(obj);
+  for (uint32_t i = 0; i < children; i++) {
+    count += count_objects(lv_obj_get_child(obj, i));
+  }
+  return count;
+}
+
+MemorySample MemorySample::take(lv_disp_t *disp) {
+  MemorySample sample;
+
+#ifdef USE_ESP32
+  sample.heap_free = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  sample.internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  sample.internal_largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+  // Host build: the simulated pools of the memory policy stand for the heap
+  sample.internal_free = MemoryPolicy::get_free(MemoryPool::INTERNAL);
+  sample.internal_largest = sample.internal_free;
+  sample.heap_free = sample.internal_free + MemoryPolicy::get_free(MemoryPool::EXTERNAL);
+#endif
+
+  lv_mem_monitor_t monitor;
+  lv_mem_monitor(&monitor);
+  if (monitor.total_size > 0) {
+    sample.lvgl_heap = true;
+    sample.lvgl_used = monitor.total_size - monitor.free_size;
+    sample.lvgl_free = monitor.free_size;
+    sample.lvgl_largest = monitor.free_biggest_size;
+    sample.lvgl_fragmentation = monitor.frag_pct;
+  }
+
+  if (disp == nullptr) disp = lv_disp_get_default();
+  if (disp != nullptr) {
+    for (uint32_t i = 0; i < disp->screen_cnt; i++) {
+      sample.objects += count_objects(disp->screens[i]);
+    }
+  }
+  return sample;
+}
+
+}  // namespace dial_menu
+}  // namespace esphome
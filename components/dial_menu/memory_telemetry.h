@@ -0,0 +1,50 @@
+/**
+ * @file memory_telemetry.h
+ * @brief Heap samples taken around app UI creation, app opens and closes
+ *
+ * A sample reads LVGL's heap monitor, the ESP heap and the number of LVGL
+ * objects on the display's screens. The difference between two samples is
+ * what happened in between, which the controller attributes to an app.
+ *
+ * ESPHome usually builds LVGL with a custom allocator on top of the system
+ * heap; lv_mem_monitor() then reports nothing, and LVGL's allocations show up
+ * in the system heap figures instead.
+ */
+#pragma once
+
+#include "esphome/components/lvgl/lvgl_esphome.h"
+#include <cstdint>
+
+namespace esphome {
+namespace dial_menu {
+
+struct MemorySample {
+  uint32_t heap_free{0};          // System heap, internal RAM and PSRAM
+  uint32_t internal_free{0};      // Internal RAM only
+  uint32_t internal_largest{0};   // Largest free block of internal RAM
+  bool lvgl_heap{false};          // LVGL has its own heap (the lvgl_* fields are valid)
+  uint32_t lvgl_used{0};
+  uint32_t lvgl_free{0};
+  uint32_t lvgl_largest{0};
+  uint8_t lvgl_fragmentation{0};  // Percent, as computed by LVGL
+  uint32_t objects{0};            // LVGL objects on all screens of the display
+
+  // Heaps now, objects of disp (the default display if null)
+  static MemorySample take(lv_disp_t *disp);
+
+  // Percent of the free internal RAM outside the largest block
+  uint8_t internal_fragmentation() const {
+    if (this->internal_free == 0) return 0;
+    return 100 - (uint8_t) ((uint64_t) this->internal_largest * 100 / this->internal_free);
+  }
+  // Bytes taken since an earlier sample, in both heaps (negative if more was freed)
+  int32_t bytes_since(const MemorySample &before) const {
+    return (int32_t) (this->lvgl_used - before.lvgl_used) + (int32_t) (before.heap_free - this->heap_free);
+  }
+  int32_t objects_since(const MemorySample &before) const {
+    return (int32_t) (this->objects - before.objects);
+  }
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
@@ -0,0 +1,189 @@
+/**
+ * @file number_app.cpp
+ * @brief Implementation of the Number App with live (streamed) value control
+ */
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DIAL_MENU_NUMBER
+
+#include "number_app.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace dial_menu {
+
+static const char *const TAG = "number_app";
+
+// The arc works on integers, values are mapped onto this many steps
+static const int ARC_RESOLUTION = 1000;
+
+void NumberApp::on_enter() {
+  ESP_LOGI(TAG, "Entering Number App: %s", this->name_);
+  this->active_ = true;
+  this->adjusting_ = false;
+
+  if (this->page_ != nullptr) {
+    lv_scr_load(this->page_);
+    this->update_state();
+  }
+}
+
+void NumberApp::on_exit() {
+  ESP_LOGI(TAG, "Exiting Number App: %s", this->name_);
+  if (this->adjusting_ && this->number_ != nullptr) {
+    this->send_(this->target_, false);
+    this->adjusting_ = false;
+  }
+  this->active_ = false;
+}
+
+void NumberApp::on_button_press() {
+  ESP_LOGD(TAG, "Button pressed in Number App");
+  if (this->adjusting_ && this->number_ != nullptr) {
+    this->send_(this->target_, false);
+    this->adjusting_ = false;
+  }
+}
+
+void NumberApp::send_(float value, bool stream) {
+  if (this->defer_to_main_(this, [](void *app, int32_t stream, float value) {
+        static_cast<NumberApp *>(app)->send_(value, stream != 0);
+      }, stream ? 1 : 0, value))
+    return;
+  if (stream) {
+    this->number_->stream_value(value);
+  } else {
+    this->number_->set_value(value);
+  }
+}
+
+void NumberApp::on_encoder_rotate(int delta) {
+  ESP_LOGD(TAG, "Encoder rotated: %d", delta);
+  if (this->number_ == nullptr || delta == 0) return;
+
+  if (!this->adjusting_ || millis() - this->last_input_time_ > INPUT_HOLD_MS) {
+    this->target_ = this->number_->get_value();
+  }
+  this->adjusting_ = true;
+  this->last_input_time_ = millis();
+
+  float step = this->step_ > 0.0f ? this->step_ : this->number_->get_step();
+  this->target_ = clamp(this->target_ + delta * step, this->number_->get_min_value(), this->number_->get_max_value());
+  this->send_(this->target_, true);
+
+  // Immediate visual feedback
+  this->update_value_display_(this->target_);
+}
+
+void NumberApp::on_tick(bool visible) {
+  if (this->adjusting_ && millis() - this->last_input_time_ > INPUT_HOLD_MS) {
+    this->update_state();
+  }
+}
+
+void NumberApp::create_app_ui() {
+  ESP_LOGI(TAG, "Creating UI for Number App: %s", this->name_);
+
+  this->set_tick_interval(TICK_INTERVAL_MS);
+  
+  // Create a new screen/page for this app
+  this->page_ = lv_obj_create(nullptr);
+  lv_obj_set_style_bg_color(this->page_, lv_color_hex(0x000000), 0);
+
+  const lv_font_t *font_14 = this->font_14_ ? this->font_14_->get_lv_font() : &lv_font_montserrat_14;
+
+  // Name at top
+  this->name_label_ = lv_label_create(this->page_);
+  lv_obj_align(this->name_label_, LV_ALIGN_TOP_MID, 0, this->px(25));
+  lv_obj_set_style_text_color(this->name_label_, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_text_font(this->name_label_, font_14, 0);
+  lv_label_set_text(this->name_label_, this->name_);
+
+  // Value arc
+  this->value_arc_ = lv_arc_create(this->page_);
+  lv_obj_set_size(this->value_arc_, this->px(180), this->px(180));
+  lv_obj_align(this->value_arc_, LV_ALIGN_CENTER, 0, this->px(5));
+  lv_arc_set_rotation(this->value_arc_, 135);
+  lv_arc_set_bg_angles(this->value_arc_, 0, 270);
+  lv_arc_set_range(this->value_arc_, 0, ARC_RESOLUTION);
+  lv_arc_set_value(this->value_arc_, 0);
+  lv_obj_remove_style(this->value_arc_, NULL, LV_PART_KNOB);
+  lv_obj_clear_flag(this->value_arc_, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_style_arc_width(this->value_arc_, this->px(12), LV_PART_MAIN);
+  lv_obj_set_style_arc_width(this->value_arc_, this->px(12), LV_PART_INDICATOR);
+  lv_obj_set_style_arc_color(this->value_arc_, lv_color_hex(0x333333), LV_PART_MAIN);
+  lv_obj_set_style_arc_color(this->value_arc_, lv_color_hex(this->color_), LV_PART_INDICATOR);
+
+  // Value (large, center)
+  this->value_label_ = lv_label_create(this->page_);
+  lv_obj_align(this->value_label_, LV_ALIGN_CENTER, 0, this->px(-5));
+  lv_obj_set_style_text_color(this->value_label_, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_text_font(this->value_label_, &lv_font_montserrat_28, 0);
+  lv_label_set_text(this->value_label_, "--");
+
+  // Range (min - max)
+  this->range_label_ = lv_label_create(this->page_);
+  lv_obj_align(this->range_label_, LV_ALIGN_CENTER, 0, this->px(30));
+  lv_obj_set_style_text_color(this->range_label_, lv_color_hex(0x888888), 0);
+  lv_obj_set_style_text_font(this->range_label_, font_14, 0);
+  lv_label_set_text(this->range_label_, "");
+
+  // Register state callback
+  if (this->number_ != nullptr) {
+    this->number_->add_on_state_callback([this]() {
+      this->run_ui_(this, [](void *ctx, int32_t, float) {
+        auto *app = static_cast<NumberApp *>(ctx);
+        if (app->active_) {
+          app->update_state();
+        }
+      });
+    });
+  }
+
+  this->update_state();
+  ESP_LOGI(TAG, "Number App UI created");
+}
+
+void NumberApp::update_state() {
+  if (this->number_ == nullptr || this->page_ == nullptr) return;
+
+  // While the user turns the dial, keep showing the local target
+  bool holding = this->adjusting_ && millis() - this->last_input_time_ <= INPUT_HOLD_MS;
+  if (!holding) {
+    this->adjusting_ = false;
+  }
+
+  if (this->range_label_ != nullptr) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%g - %g", this->number_->get_min_value(), this->number_->get_max_value());
+    lv_label_set_text(this->range_label_, buf);
+  }
+
+  if (holding) {
+    this->update_value_display_(this->target_);
+  } else if (this->number_->has_state()) {
+    this->update_value_display_(this->number_->get_value());
+  }
+  style_stale_(this->value_arc_, this->number_->is_stale());
+  style_stale_(this->value_label_, this->number_->is_stale());
+}
+
+void NumberApp::update_value_display_(float value) {
+  if (this->value_arc_ == nullptr || this->value_label_ == nullptr) return;
+
+  float min_value = this->number_->get_min_value();
+  float range = this->number_->get_max_value() - min_value;
+  int arc_value = range > 0.0f ? static_cast<int>((value - min_value) / range * ARC_RESOLUTION) : 0;
+  lv_arc_set_value(this->value_arc_, arc_value);
+
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%g%s", value, this->unit_.c_str());
+  lv_label_set_text(this->value_label_, buf);
+}
+
+}  // namespace dial_menu
+}  // namespace esphome
+
+#endif  // USE_DIAL_MENU_NUMBER
@@ -0,0 +1,80 @@
+/**
+ * @file number_app.h
+ * @brief Number App - Adjusts a Home Assistant input_number/number with the encoder
+ */
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DIAL_MENU_NUMBER
+
+#include "dial_menu_controller.h"
+#include "esphome/components/font/font.h"
+#include "esphome/components/homeassistant_addon/homeassistant_number.h"
+
+namespace esphome {
+namespace dial_menu {
+
+/**
+ * @brief App that controls a single Home Assistant number entity
+ *
+ * Features:
+ * - Rotate encoder to change the value (streamed live, rate limited)
+ * - Press button to send the final value immediately
+ * - Arc showing the value within the entity's min/max range
+ */
+class NumberApp : public DialApp {
+ public:
+  void set_number(homeassistant_addon::HomeassistantNumber *number) { this->number_ = number; }
+  // Step per encoder click, 0 = use the entity's step attribute
+  void set_step(float step) { this->step_ = step; }
+  void set_unit(const std::string &unit) { this->unit_ = unit; }
+  void set_font_14(font::Font *font) { this->font_14_ = font; }
+
+  // App lifecycle - called by DialMenuController
+  void on_enter() override;
+  void on_exit() override;
+  void on_button_press() override;
+  void on_encoder_rotate(int delta) override;
+  // Falls back to the entity's value once the input hold expires
+  void on_tick(bool visible) override;
+
+  // This app needs its own UI page
+  bool needs_ui() const override { return true; }
+
+  // Create the app's UI (called during setup)
+  void create_app_ui() override;
+
+  // Update UI to match current number state
+  void update_state();
+
+ protected:
+  void update_value_display_(float value);
+  // Stream (dial turning) or set (committed) the value, from the main loop
+  void send_(float value, bool stream);
+
+  homeassistant_addon::HomeassistantNumber *number_{nullptr};
+  float step_{0.0f};
+  std::string unit_;
+  font::Font *font_14_{nullptr};
+  bool active_{false};
+
+  // Local target while the encoder moves
+  float target_{0.0f};
+  bool adjusting_{false};
+  uint32_t last_input_time_{0};
+  static constexpr uint32_t INPUT_HOLD_MS = 1000;
+  static constexpr uint32_t TICK_INTERVAL_MS = 250;
+
+  // LVGL objects for this app's UI
+  lv_obj_t *page_{nullptr};
+  lv_obj_t *name_label_{nullptr};
+  lv_obj_t *value_arc_{nullptr};
+  lv_obj_t *value_label_{nullptr};
+  lv_obj_t *range_label_{nullptr};
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
+
+#endif  // USE_DIAL_MENU_NUMBER
@@ -0,0 +1,129 @@
+/**
+ * @file render_pacer.cpp
+ * @brief Time-sliced refreshes on top of LVGL's refresh timer
+ */
+
+#include "render_pacer.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+
+namespace esphome {
+namespace dial_menu {
+
+static const char *const TAG = "dial_menu.render";
+
+std::vector<RenderPacer *> RenderPacer::attached_;
+
+lv_timer_t *RenderPacer::find_refresh_timer(lv_disp_t *disp) {
+  if (disp == nullptr) return nullptr;
+  for (lv_timer_t *timer = lv_timer_get_next(nullptr); timer != nullptr; timer = lv_timer_get_next(timer)) {
+    if (timer->user_data == disp) return timer;
+  }
+  return nullptr;
+}
+
+void RenderPacer::attach(lv_disp_t *disp) {
+  lv_timer_t *timer = RenderPacer::find_refresh_timer(disp);
+  if (timer == nullptr || this->disp_ != nullptr || RenderPacer::find_(disp) != nullptr) return;
+  this->disp_ = disp;
+  this->lvgl_refresh_cb_ = timer->timer_cb;
+  lv_timer_set_cb(timer, RenderPacer::refresh_cb_);
+  RenderPacer::attached_.push_back(this);
+  ESP_LOGD(TAG, "Refreshes paced to %u us", (unsigned) this->budget_us_);
+}
+
+RenderPacer *RenderPacer::find_(lv_disp_t *disp) {
+  for (RenderPacer *pacer : RenderPacer::attached_) {
+    if (pacer->disp_ == disp) return pacer;
+  }
+  return nullptr;
+}
+
+void RenderPacer::add_sample(uint32_t pixels, uint32_t elapsed_us) {
+  if (elapsed_us == 0) return;
+  uint32_t rate = (uint32_t) ((uint64_t) pixels * 1000 / elapsed_us);
+  // Smoothed, a refresh slowed down by an interrupt burst doesn't halve the slices
+  this->stats_.px_per_ms = this->stats_.px_per_ms == 0 ? rate : (this->stats_.px_per_ms * 3 + rate) / 4;
+}
+
+void RenderPacer::refresh_cb_(lv_timer_t *timer) {
+  RenderPacer::find_(static_cast<lv_disp_t *>(timer->user_data))->refresh_(timer);
+}
+
+uint32_t RenderPacer::budget_px_() const {
+  if (this->budget_us_ == 0 || this->stats_.px_per_ms == 0) return 0;
+  const lv_disp_drv_t *driver = this->disp_->driver;
+  if (driver->full_refresh || driver->direct_mode) return 0;
+  uint32_t screen_px = (uint32_t) driver->hor_res * driver->ver_res;
+  uint32_t budget = (uint32_t) ((uint64_t) this->stats_.px_per_ms * this->budget_us_ / 1000);
+  return std::max(budget, screen_px / MAX_SLICES);
+}
+
+uint32_t RenderPacer::trim_(uint32_t budget_px) {
+  lv_disp_t *disp = this->disp_;
+  uint32_t kept_px = 0;
+  uint16_t kept = 0;
+  this->deferred_count_ = 0;
+  for (uint16_t i = 0; i < disp->inv_p; i++) {
+    if (disp->inv_area_joined[i]) continue;
+    lv_area_t area = disp->inv_areas[i];
+    if (budget_px > 0 && kept_px >= budget_px) {
+      this->deferred_[this->deferred_count_++] = area;
+      continue;
+    }
+    uint32_t size = lv_area_get_size(&area);
+    if (budget_px > 0 && kept_px + size > budget_px) {
+      // The top rows that fit are drawn now, the band below waits
+      lv_coord_t width = lv_area_get_width(&area);
+      lv_coord_t rows = std::max<lv_coord_t>(1, (budget_px - kept_px) / width);
+      if (rows < lv_area_get_height(&area)) {
+        lv_area_t rest = area;
+        rest.y1 = area.y1 + rows;
+        area.y2 = rest.y1 - 1;
+        if (disp->driver->rounder_cb != nullptr) {
+          disp->driver->rounder_cb(disp->driver, &area);
+        }
+        this->deferred_[this->deferred_count_++] = rest;
+        size = lv_area_get_size(&area);
+      }
+    }
+    disp->inv_areas[kept] = area;
+    disp->inv_area_joined[kept] = 0;
+    kept++;
+    kept_px += size;
+  }
+  disp->inv_p = kept;
+  return kept_px;
+}
+
+void RenderPacer::refresh_(lv_timer_t *timer) {
+  uint32_t pixels = this->trim_(this->budget_px_());
+
+  uint32_t start_us = micros();
+  this->lvgl_refresh_cb_(timer);
+  uint32_t elapsed_us = micros() - start_us;
+
+  if (pixels > 0) {
+    RenderStats &stats = this->stats_;
+    stats.refreshes++;
+    if (elapsed_us > stats.max_refresh_us) stats.max_refresh_us = elapsed_us;
+    // Small refreshes are mostly overhead, they would understate the rate
+    const lv_disp_drv_t *driver = this->disp_->driver;
+    if (pixels >= (uint32_t) driver->hor_res * driver->ver_res / MAX_SLICES) {
+      this->add_sample(pixels, elapsed_us);
+    }
+  }
+
+  // What was held back is drawn by the next refresh
+  if (this->deferred_count_ > 0) {
+    this->stats_.sliced++;
+    for (uint16_t i = 0; i < this->deferred_count_; i++) {
+      _lv_inv_area(this->disp_, &this->deferred_[i]);
+    }
+    this->deferred_count_ = 0;
+  }
+}
+
+}  // namespace dial_menu
+}  // namespace esphome
@@ -0,0 +1,73 @@
+/**
+ * @file render_pacer.h
+ * @brief Spreads large LVGL redraws over several refresh periods
+ *
+ * LVGL renders everything invalidated since the previous refresh at once: a
+ * screen load redraws the whole display inside a single pass of ESPHome's
+ * loop, and API packets and encoder events wait behind it. The pacer wraps
+ * the display's refresh timer so that one refresh renders at most what fits
+ * in the time budget, at the render rate measured on earlier refreshes. The
+ * rest is invalidated again, in bands from the top, and drawn on the next
+ * refresh periods while the loop runs in between.
+ *
+ * Displays in full refresh or direct mode redraw whole frames and are only
+ * measured, never sliced.
+ */
+#pragma once
+
+#include "esphome/components/lvgl/lvgl_esphome.h"
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace dial_menu {
+
+struct RenderStats {
+  uint32_t refreshes{0};      // Refreshes that drew something
+  uint32_t sliced{0};         // Refreshes that left part of the frame for the next one
+  uint32_t max_refresh_us{0};
+  uint32_t px_per_ms{0};      // Measured render rate, 0 until the first large refresh
+};
+
+class RenderPacer {
+ public:
+  // Time one refresh may take, 0 = refreshes are measured but not sliced
+  void set_budget(uint32_t budget_us) { this->budget_us_ = budget_us; }
+  uint32_t get_budget() const { return this->budget_us_; }
+
+  // Take over the refresh timer of the display (once its first frame is drawn)
+  void attach(lv_disp_t *disp);
+  // LVGL's refresh timer of disp, found through the public timer list: it is
+  // the timer created with the display as its user data. nullptr if none
+  static lv_timer_t *find_refresh_timer(lv_disp_t *disp);
+  // A refresh of `pixels` took `elapsed_us`: updates the render rate
+  void add_sample(uint32_t pixels, uint32_t elapsed_us);
+  const RenderStats &get_stats() const { return this->stats_; }
+
+ protected:
+  static void refresh_cb_(lv_timer_t *timer);
+  // The pacer attached to disp, nullptr if none
+  static RenderPacer *find_(lv_disp_t *disp);
+  void refresh_(lv_timer_t *timer);
+  // Pixels one refresh may draw, 0 = no limit
+  uint32_t budget_px_() const;
+  // Keep at most budget_px of the invalid areas, the rest goes to deferred_; returns the pixels kept
+  uint32_t trim_(uint32_t budget_px);
+
+  // Smallest slice, so a frame never takes more than this many refreshes
+  static constexpr uint32_t MAX_SLICES = 8;
+  // One pacer per display. The timer's user data stays the display: lv_refr_now() and
+  // LVGL's own refresh read it, so the pacer is looked up here
+  static std::vector<RenderPacer *> attached_;
+
+  lv_disp_t *disp_{nullptr};
+  lv_timer_cb_t lvgl_refresh_cb_{nullptr};
+  uint32_t budget_us_{0};
+  // A split area adds one to what LVGL had
+  lv_area_t deferred_[LV_INV_BUF_SIZE + 1];
+  uint16_t deferred_count_{0};
+  RenderStats stats_;
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
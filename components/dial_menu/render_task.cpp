@@ -0,0 +1,186 @@
+/**
+ * @file render_task.cpp
+ * @brief FreeRTOS (ESP32) or std::thread (host) render loop
+ */
+
+#include "render_task.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+
+#ifndef USE_ESP32
+#include <chrono>
+#endif
+
+namespace esphome {
+namespace dial_menu {
+
+static const char *const TAG = "dial_menu.render";
+
+void RenderTask::run_ui(const UiCommand &command) {
+  if (!this->is_running() || this->in_task()) {
+    command.run();
+    return;
+  }
+  if (!this->to_render_.push(command)) {
+    this->stats_.waits_render++;
+    do {
+      // The task may itself be waiting for room in to_main_
+      this->drain_main();
+      this->wake_();
+      RenderTask::yield_();
+    } while (!this->to_render_.push(command));
+  }
+  this->stats_.to_render++;
+  this->wake_();
+}
+
+void RenderTask::run_main(const UiCommand &command) {
+  if (!this->in_task()) {
+    command.run();
+    return;
+  }
+  if (!this->to_main_.push(command)) {
+    this->stats_.waits_main++;
+    do {
+      RenderTask::yield_();
+    } while (!this->to_main_.push(command));
+  }
+  this->stats_.to_main++;
+}
+
+void RenderTask::drain_main() {
+  UiCommand command;
+  while (this->to_main_.pop(&command)) {
+    command.run();
+  }
+}
+
+void RenderTask::loop_() {
+  UiCommand command;
+  uint32_t backlog = 0;
+  uint32_t start_us = micros();
+  while (this->to_render_.pop(&command)) {
+    command.run();
+    backlog++;
+  }
+  uint32_t next_ms = this->pass_(this->pass_ctx_);
+  uint32_t elapsed_us = micros() - start_us;
+
+  RenderTaskStats &stats = this->stats_;
+  stats.passes++;
+  if (backlog > stats.max_backlog) stats.max_backlog = backlog;
+  if (elapsed_us > stats.max_pass_us) stats.max_pass_us = elapsed_us;
+
+  this->sleep_(std::max<uint32_t>(1, std::min(next_ms, MAX_SLEEP_MS)));
+}
+
+#ifdef USE_ESP32
+
+bool RenderTask::start(PassFn pass, void *ctx, uint8_t core) {
+  if (this->is_running()) return true;
+  this->pass_ = pass;
+  this->pass_ctx_ = ctx;
+  // From here on the main loop must not touch LVGL: commands are queued
+  this->running_.store(true, std::memory_order_release);
+  // Same priority as the main loop, the two only meet through the queues
+  BaseType_t result = xTaskCreatePinnedToCore(RenderTask::task_entry_, "dial_render", STACK_SIZE, this,
+                                              uxTaskPriorityGet(nullptr), nullptr, core);
+  if (result != pdPASS) {
+    this->running_.store(false, std::memory_order_release);
+    ESP_LOGE(TAG, "Could not start the render task");
+    return false;
+  }
+  ESP_LOGI(TAG, "Render task started on core %u", core);
+  return true;
+}
+
+bool RenderTask::in_task() const {
+  TaskHandle_t handle = this->handle_.load(std::memory_order_acquire);
+  return handle != nullptr && xTaskGetCurrentTaskHandle() == handle;
+}
+
+void RenderTask::task_entry_(void *arg) {
+  auto *task = static_cast<RenderTask *>(arg);
+  // Set by the task itself, so in_task() holds from its very first pass
+  task->handle_.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+  while (true) {
+    task->loop_();
+  }
+}
+
+void RenderTask::wake_() {
+  // Not started yet: the first pass picks the command up anyway
+  TaskHandle_t handle = this->handle_.load(std::memory_order_acquire);
+  if (handle != nullptr) xTaskNotifyGive(handle);
+}
+
+void RenderTask::sleep_(uint32_t ms) { ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms)); }
+
+void RenderTask::yield_() { vTaskDelay(1); }
+
+#else  // Host: a thread stands in for the FreeRTOS task
+
+bool RenderTask::start(PassFn pass, void *ctx, uint8_t core) {
+  if (this->is_running()) return true;
+  this->pass_ = pass;
+  this->pass_ctx_ = ctx;
+  this->stopping_.store(false);
+  this->stopped_.store(false);
+  // From here on the main loop must not touch LVGL: commands are queued
+  this->running_.store(true, std::memory_order_release);
+  this->thread_ = std::thread(RenderTask::task_entry_, this);
+  ESP_LOGI(TAG, "Render task started (thread)");
+  return true;
+}
+
+void RenderTask::stop() {
+  if (!this->thread_.joinable()) return;
+  this->stopping_.store(true);
+  // The thread may be waiting for room in to_main_ before it sees stopping_
+  while (!this->stopped_.load()) {
+    this->drain_main();
+    this->wake_();
+    RenderTask::yield_();
+  }
+  this->thread_.join();
+  this->task_id_.store(std::thread::id(), std::memory_order_release);
+  this->running_.store(false, std::memory_order_release);
+  // Left over from the last pass
+  this->drain_main();
+}
+
+bool RenderTask::in_task() const {
+  return std::this_thread::get_id() == this->task_id_.load(std::memory_order_acquire);
+}
+
+void RenderTask::task_entry_(void *arg) {
+  auto *task = static_cast<RenderTask *>(arg);
+  task->task_id_.store(std::this_thread::get_id(), std::memory_order_release);
+  while (!task->stopping_.load()) {
+    task->loop_();
+  }
+  task->stopped_.store(true);
+}
+
+void RenderTask::wake_() {
+  {
+    std::lock_guard<std::mutex> lock(this->wake_mutex_);
+    this->woken_ = true;
+  }
+  this->wake_cv_.notify_one();
+}
+
+void RenderTask::sleep_(uint32_t ms) {
+  // The mutex only guards the wake flag, commands never wait on it
+  std::unique_lock<std::mutex> lock(this->wake_mutex_);
+  this->wake_cv_.wait_for(lock, std::chrono::milliseconds(ms), [this]() { return this->woken_; });
+  this->woken_ = false;
+}
+
+void RenderTask::yield_() { std::this_thread::sleep_for(std::chrono::microseconds(100)); }
+
+#endif  // USE_ESP32
+
+}  // namespace dial_menu
+}  // namespace esphome
@@ -0,0 +1,129 @@
+/**
+ * @file render_task.h
+ * @brief Optional LVGL render task, and the queues between it and the main loop
+ *
+ * With the task running, LVGL belongs to it: input devices, timers, drawing
+ * and flushing, plus the controller's UI work (boot steps, idle screen, app
+ * ticks). The main loop keeps ESPHome, the API and the entities. The two
+ * sides only talk through a pair of lock-free single producer / single
+ * consumer queues of UiCommand:
+ * - main loop -> render task: inputs and entity state changes, via run_ui()
+ * - render task -> main loop: entity commands and sensor publishes, via
+ *   run_main(), drained by the controller's loop()
+ * Both calls run the command inline when already on the right side, so the
+ * same code works with or without the task. A command is never dropped: a
+ * full queue makes the poster wait, and the main loop drains its own queue
+ * while it waits so the two sides cannot block each other.
+ *
+ * On ESP32 the task is a FreeRTOS task pinned to a core; elsewhere (host
+ * builds) it is a std::thread.
+ */
+#pragma once
+
+#include "spsc_queue.h"
+#include "esphome/core/defines.h"
+#include <atomic>
+#include <cstdint>
+
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace esphome {
+namespace dial_menu {
+
+/**
+ * @brief A call to run on the other side: fn(ctx, arg, value)
+ *
+ * Trivially copyable so it can sit in a queue slot: fn is a plain function
+ * (a captureless lambda), the object it acts on is ctx.
+ */
+struct UiCommand {
+  using Fn = void (*)(void *ctx, int32_t arg, float value);
+  Fn fn{nullptr};
+  void *ctx{nullptr};
+  int32_t arg{0};
+  float value{0.0f};
+
+  void run() const { this->fn(this->ctx, this->arg, this->value); }
+};
+
+struct RenderTaskStats {
+  // Each counter has a single writer: the posting side
+  uint32_t to_render{0};    // Commands posted by the main loop
+  uint32_t to_main{0};      // Commands posted by the render task
+  uint32_t waits_render{0};  // Posts that found the queue full and waited, main loop -> render task
+  uint32_t waits_main{0};    // Same, render task -> main loop
+  uint32_t max_backlog{0};  // Most commands found waiting by one render pass
+  uint32_t passes{0};
+  uint32_t max_pass_us{0};  // Longest pass, commands and LVGL included
+};
+
+class RenderTask {
+ public:
+  // One pass of the render loop; returns the ms until something is due
+  using PassFn = uint32_t (*)(void *ctx);
+
+  static constexpr size_t QUEUE_SIZE = 64;
+  using Queue = SpscQueue<UiCommand, QUEUE_SIZE>;
+
+  // Start the task; core is where it is pinned on ESP32
+  bool start(PassFn pass, void *ctx, uint8_t core);
+#ifndef USE_ESP32
+  // Host builds: stop and join the thread
+  void stop();
+  ~RenderTask() { this->stop(); }
+#endif
+  bool is_running() const { return this->running_.load(std::memory_order_acquire); }
+  // The calling thread is the render task
+  bool in_task() const;
+
+  // Run on the side that owns LVGL: inline from the render task or while no task runs.
+  // Waits while the queue is full, running the render task's commands meanwhile.
+  void run_ui(const UiCommand &command);
+  // Run on the main loop: inline unless called from the render task. Waits while the queue is full.
+  void run_main(const UiCommand &command);
+  // Main loop: run what the render task posted
+  void drain_main();
+
+  const RenderTaskStats &get_stats() const { return this->stats_; }
+
+ protected:
+  void loop_();
+  // Wake the task early (a command was posted) / sleep until woken or timed out
+  void wake_();
+  void sleep_(uint32_t ms);
+  // Give the other side a moment to make room in a full queue
+  static void yield_();
+  static void task_entry_(void *arg);
+
+  // Longest sleep between passes, inputs are polled by LVGL's timers
+  static constexpr uint32_t MAX_SLEEP_MS = 10;
+  static constexpr uint32_t STACK_SIZE = 8192;
+
+  PassFn pass_{nullptr};
+  void *pass_ctx_{nullptr};
+  Queue to_render_;
+  Queue to_main_;
+  std::atomic<bool> running_{false};
+  RenderTaskStats stats_;
+#ifdef USE_ESP32
+  std::atomic<TaskHandle_t> handle_{nullptr};
+#else
+  std::thread thread_;
+  std::atomic<std::thread::id> task_id_{};
+  std::mutex wake_mutex_;
+  std::condition_variable wake_cv_;
+  bool woken_{false};
+  std::atomic<bool> stopping_{false};
+  std::atomic<bool> stopped_{false};  // The thread left its loop
+#endif
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
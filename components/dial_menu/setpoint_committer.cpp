@@ -0,0 +1,137 @@
+/**
+ * @file setpoint_committer.cpp
+ * @brief Implementation of the debounce / max-latency / rate-limit commit engine
+ */
+
+#include "setpoint_committer.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace esphome {
+namespace dial_menu {
+
+static const char *const TAG = "setpoint_committer";
+
+SetpointCommitter::SetpointCommitter(std::function<void(float)> &&sender) : sender_(std::move(sender)) {
+  // Several committers share the controller as owner, the timeout name tells them apart:
+  // named after the committer itself, which neither moves nor is copied
+  char name[32];
+  snprintf(name, sizeof(name), "setpoint_%p", (void *) this);
+  this->name_ = name;
+}
+
+void SetpointCommitter::update(float value) {
+  uint32_t now = millis();
+  if (!this->has_pending_) {
+    this->first_change_time_ = now;
+  }
+  this->pending_value_ = value;
+  this->has_pending_ = true;
+  this->last_change_time_ = now;
+  this->arm_(now);
+}
+
+void SetpointCommitter::flush() {
+  if (!this->has_pending_) return;
+  this->disarm_();
+  this->commit_(millis());
+}
+
+void SetpointCommitter::cancel() {
+  this->disarm_();
+  this->has_pending_ = false;
+}
+
+void SetpointCommitter::disarm_() {
+  if (this->armed_ && this->owner_ != nullptr) {
+    this->unschedule_();
+  }
+  this->armed_ = false;
+}
+
+void SetpointCommitter::schedule_(uint32_t delay_ms) {
+  if (this->render_task_ == nullptr) {
+    App.scheduler.set_timeout(this->owner_, this->name_, delay_ms, [this]() { this->on_timeout_(); });
+    return;
+  }
+  // Queued commands keep their order, a cancel posted before stays before
+  this->render_task_->run_main({[](void *ctx, int32_t delay_ms, float) {
+    auto *self = static_cast<SetpointCommitter *>(ctx);
+    App.scheduler.set_timeout(self->owner_, self->name_, delay_ms, [self]() {
+      self->render_task_->run_ui(
+          {[](void *ctx, int32_t, float) { static_cast<SetpointCommitter *>(ctx)->on_timeout_(); }, self});
+    });
+  }, this, (int32_t) delay_ms});
+}
+
+void SetpointCommitter::unschedule_() {
+  if (this->render_task_ == nullptr) {
+    App.scheduler.cancel_timeout(this->owner_, this->name_);
+    return;
+  }
+  this->render_task_->run_main({[](void *ctx, int32_t, float) {
+    auto *self = static_cast<SetpointCommitter *>(ctx);
+    App.scheduler.cancel_timeout(self->owner_, self->name_);
+  }, this});
+}
+
+uint32_t SetpointCommitter::due_time_() const {
+  // Durations relative to now are compared, so millis() wrapping is harmless
+  uint32_t now = millis();
+  uint32_t wait = this->debounce_ms_ - std::min(now - this->last_change_time_, this->debounce_ms_);
+  if (this->max_latency_ms_ > 0) {
+    uint32_t deadline = this->max_latency_ms_ - std::min(now - this->first_change_time_, this->max_latency_ms_);
+    wait = std::min(wait, deadline);
+  }
+  if (this->committed_once_ && this->min_interval_ms_ > 0) {
+    uint32_t spacing = this->min_interval_ms_ - std::min(now - this->last_commit_time_, this->min_interval_ms_);
+    wait = std::max(wait, spacing);
+  }
+  return now + wait;
+}
+
+void SetpointCommitter::arm_(uint32_t now) {
+  if (this->owner_ == nullptr) {
+    // Not wired to a scheduler: behave like an immediate setter
+    this->commit_(now);
+    return;
+  }
+
+  uint32_t due = this->due_time_();
+  // An armed timeout firing earlier re-arms itself for the remainder on expiry
+  if (this->armed_ && (int32_t)(due - this->armed_time_) >= 0) {
+    return;
+  }
+  this->armed_ = true;
+  this->armed_time_ = due;
+  this->schedule_(due - now);
+}
+
+void SetpointCommitter::on_timeout_() {
+  this->armed_ = false;
+  if (!this->has_pending_) return;
+
+  uint32_t now = millis();
+  if ((int32_t)(this->due_time_() - now) > 0) {
+    // Input kept coming since the timeout was armed
+    this->arm_(now);
+    return;
+  }
+  this->commit_(now);
+}
+
+void SetpointCommitter::commit_(uint32_t now) {
+  this->has_pending_ = false;
+  this->last_commit_time_ = now;
+  this->committed_once_ = true;
+  ESP_LOGV(TAG, "%s: committing %.3f after %u ms", this->name_.c_str(), this->pending_value_,
+           (unsigned) (now - this->first_change_time_));
+  this->sender_(this->pending_value_);
+}
+
+}  // namespace dial_menu
+}  // namespace esphome
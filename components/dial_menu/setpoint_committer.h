@@ -0,0 +1,85 @@
+/**
+ * @file setpoint_committer.h
+ * @brief Commits a value adjusted with the encoder, on a guaranteed deadline
+ *
+ * Apps keep a local setpoint while the dial turns and only send it once. When
+ * that happens is decided by three policies:
+ * - debounce: the value is committed once the input has been quiet this long
+ * - max latency: a change is never held longer than this, even if the dial keeps turning
+ * - min interval: two commits are at least this far apart (rate limit)
+ *
+ * The commit runs from the ESPHome scheduler, so it doesn't depend on any UI
+ * refresh or state callback happening afterwards. With the render task the
+ * committer lives on it like the rest of the UI: only the scheduler calls go
+ * to the main loop, and the timeout comes back to the render task.
+ */
+#pragma once
+
+#include "render_task.h"
+#include "esphome/core/component.h"
+#include <functional>
+#include <string>
+
+namespace esphome {
+namespace dial_menu {
+
+class SetpointCommitter {
+ public:
+  explicit SetpointCommitter(std::function<void(float)> &&sender);
+  // The scheduled timeout and its name are bound to this instance
+  SetpointCommitter(const SetpointCommitter &) = delete;
+  SetpointCommitter &operator=(const SetpointCommitter &) = delete;
+
+  // Component the scheduler timeout is attached to (the dial menu controller)
+  void set_owner(Component *owner) { this->owner_ = owner; }
+  // Render task of the dial menu, nullptr: everything runs on the main loop
+  void set_render_task(RenderTask *task) { this->render_task_ = task; }
+  void set_debounce(uint32_t debounce_ms) { this->debounce_ms_ = debounce_ms; }
+  // 0 = no deadline, commit only when the input rests
+  void set_max_latency(uint32_t max_latency_ms) { this->max_latency_ms_ = max_latency_ms; }
+  void set_min_interval(uint32_t min_interval_ms) { this->min_interval_ms_ = min_interval_ms; }
+
+  // New local setpoint (latest wins)
+  void update(float value);
+  // Commit the pending value now (no-op if nothing is pending)
+  void flush();
+  // Drop the pending value
+  void cancel();
+
+  bool has_pending() const { return this->has_pending_; }
+  float get_pending() const { return this->pending_value_; }
+
+ protected:
+  // Time at which the pending value is due, according to the policies
+  uint32_t due_time_() const;
+  void arm_(uint32_t now);
+  void disarm_();
+  void on_timeout_();
+  // Scheduler calls, made from the main loop
+  void schedule_(uint32_t delay_ms);
+  void unschedule_();
+  void commit_(uint32_t now);
+
+  std::function<void(float)> sender_;
+  Component *owner_{nullptr};
+  RenderTask *render_task_{nullptr};
+  // Scheduler name, unique among the owner's committers
+  std::string name_;
+  uint32_t debounce_ms_{500};
+  uint32_t max_latency_ms_{2000};
+  uint32_t min_interval_ms_{0};
+
+  float pending_value_{0.0f};
+  bool has_pending_{false};
+  uint32_t first_change_time_{0};  // First change since the last commit
+  uint32_t last_change_time_{0};
+  uint32_t last_commit_time_{0};
+  bool committed_once_{false};
+
+  // A single timeout is kept armed; it only moves earlier, never later
+  bool armed_{false};
+  uint32_t armed_time_{0};
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
@@ -0,0 +1,56 @@
+/**
+ * @file spsc_queue.h
+ * @brief Bounded lock-free queue for one producer thread and one consumer thread
+ *
+ * The producer only writes tail_, the consumer only writes head_; each side
+ * publishes its slot with a release store that the other side reads with an
+ * acquire load, so an item is fully written before it can be popped. N must
+ * be a power of two; one slot stays empty to tell full from empty.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace dial_menu {
+
+template<typename T, size_t N> class SpscQueue {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+ public:
+  // Producer side; false when the queue is full (the item is not queued)
+  bool push(const T &item) {
+    size_t tail = this->tail_.load(std::memory_order_relaxed);
+    size_t next = (tail + 1) & (N - 1);
+    if (next == this->head_.load(std::memory_order_acquire)) return false;
+    this->items_[tail] = item;
+    this->tail_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side; false when the queue is empty
+  bool pop(T *item) {
+    size_t head = this->head_.load(std::memory_order_relaxed);
+    if (head == this->tail_.load(std::memory_order_acquire)) return false;
+    *item = this->items_[head];
+    this->head_.store((head + 1) & (N - 1), std::memory_order_release);
+    return true;
+  }
+
+  // Items queued, exact from either side only while the other one is idle
+  size_t size() const {
+    return (this->tail_.load(std::memory_order_acquire) - this->head_.load(std::memory_order_acquire)) & (N - 1);
+  }
+  bool empty() const { return this->size() == 0; }
+  static constexpr size_t capacity() { return N - 1; }
+
+ protected:
+  std::atomic<size_t> head_{0};  // Next slot to pop, written by the consumer
+  std::atomic<size_t> tail_{0};  // Next slot to fill, written by the producer
+  T items_[N];
+};
+
+}  // namespace dial_menu
+}  // namespace esphome
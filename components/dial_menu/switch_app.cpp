@@ -10,21 +10,18 @@ namespace dial_menu {
 
 static const char *const TAG = "switch_app";
 
-// Store app pointer for static callback
-static SwitchApp *g_current_switch_app = nullptr;
-
-void SwitchApp::add_switch(switch_::Switch *sw, const std::string &name, uint32_t color) {
+void SwitchApp::add_switch(switch_::Switch *sw, const char *name, uint32_t color) {
   SwitchItem item;
   item.sw = sw;
   item.name = name;
   item.color = color;
   this->switches_.push_back(item);
-  ESP_LOGD(TAG, "Added switch: %s (total: %d)", name.c_str(), this->switches_.size());
+  ESP_LOGD(TAG, "Added switch: %s (total: %u)", name, (unsigned) this->switches_.size());
 }
 
 void SwitchApp::on_enter() {
-  ESP_LOGI(TAG, "Entering Switch App: %s", this->name_.c_str());
-  g_current_switch_app = this;
+  ESP_LOGI(TAG, "Entering Switch App: %s", this->name_);
+  this->active_ = true;
   
   // Show the app page
   if (this->page_ != nullptr) {
@@ -35,8 +32,8 @@ void SwitchApp::on_enter() {
 }
 
 void SwitchApp::on_exit() {
-  ESP_LOGI(TAG, "Exiting Switch App: %s", this->name_.c_str());
-  g_current_switch_app = nullptr;
+  ESP_LOGI(TAG, "Exiting Switch App: %s", this->name_);
+  this->active_ = false;
 }
 
 void SwitchApp::on_button_press() {
@@ -80,7 +77,7 @@ void SwitchApp::select_switch(int index) {
 }
 
 void SwitchApp::create_app_ui() {
-  ESP_LOGI(TAG, "Creating UI for Switch App: %s (%d switches)", this->name_.c_str(), this->switches_.size());
+  ESP_LOGI(TAG, "Creating UI for Switch App: %s (%d switches)", this->name_, (int) this->switches_.size());
   
   // Create a new screen/page for this app
   this->page_ = lv_obj_create(nullptr);
@@ -88,20 +85,20 @@ void SwitchApp::create_app_ui() {
   
   // App name at top (will show current switch name)
   this->name_label_ = lv_label_create(this->page_);
-  lv_obj_align(this->name_label_, LV_ALIGN_TOP_MID, 0, 35);
+  lv_obj_align(this->name_label_, LV_ALIGN_TOP_MID, 0, this->px(35));
   lv_obj_set_style_text_color(this->name_label_, lv_color_hex(0xFFFFFF), 0);
   // Use custom font if set, otherwise fallback to built-in
   const lv_font_t *font_14 = this->font_14_ ? this->font_14_->get_lv_font() : &lv_font_montserrat_14;
   lv_obj_set_style_text_font(this->name_label_, font_14, 0);
-  lv_label_set_text(this->name_label_, this->name_.c_str());
+  lv_label_set_text(this->name_label_, this->name_);
   
   // Large state button in center
   this->state_btn_ = lv_btn_create(this->page_);
-  lv_obj_set_size(this->state_btn_, 120, 120);
+  lv_obj_set_size(this->state_btn_, this->px(120), this->px(120));
   lv_obj_align(this->state_btn_, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_style_radius(this->state_btn_, 60, 0);
-  lv_obj_set_style_border_width(this->state_btn_, 3, 0);
-  lv_obj_set_style_shadow_width(this->state_btn_, 20, 0);
+  lv_obj_set_style_radius(this->state_btn_, this->px(60), 0);
+  lv_obj_set_style_border_width(this->state_btn_, this->px(3), 0);
+  lv_obj_set_style_shadow_width(this->state_btn_, this->shadow(20), 0);
   lv_obj_set_style_shadow_opa(this->state_btn_, LV_OPA_50, 0);
   
   // Store this pointer for callback
@@ -117,22 +114,23 @@ void SwitchApp::create_app_ui() {
   // Dots indicator (pagination) - only if multiple switches
   if (this->switches_.size() > 1) {
     this->dots_container_ = lv_obj_create(this->page_);
-    int container_width = this->switches_.size() * 16;
-    lv_obj_set_size(this->dots_container_, container_width, 12);
-    lv_obj_align(this->dots_container_, LV_ALIGN_BOTTOM_MID, 0, -25);
+    int dot_size = this->px(8);
+    int dot_spacing = this->px(16);
+    int container_width = this->switches_.size() * dot_spacing;
+    lv_obj_set_size(this->dots_container_, container_width, this->px(12));
+    lv_obj_align(this->dots_container_, LV_ALIGN_BOTTOM_MID, 0, this->px(-25));
     lv_obj_set_style_bg_opa(this->dots_container_, LV_OPA_TRANSP, 0);
     lv_obj_set_style_border_width(this->dots_container_, 0, 0);
     lv_obj_set_style_pad_all(this->dots_container_, 0, 0);
     lv_obj_clear_flag(this->dots_container_, LV_OBJ_FLAG_SCROLLABLE);
     
     // Create dots for each switch - manually positioned
-    int dot_spacing = 16;
-    int start_x = (container_width - (this->switches_.size() * dot_spacing - (dot_spacing - 8))) / 2;
+    int start_x = (container_width - (this->switches_.size() * dot_spacing - (dot_spacing - dot_size))) / 2;
     for (size_t i = 0; i < this->switches_.size(); i++) {
       lv_obj_t *dot = lv_obj_create(this->dots_container_);
-      lv_obj_set_size(dot, 8, 8);
-      lv_obj_set_pos(dot, start_x + i * dot_spacing, 2);
-      lv_obj_set_style_radius(dot, 4, 0);
+      lv_obj_set_size(dot, dot_size, dot_size);
+      lv_obj_set_pos(dot, start_x + i * dot_spacing, this->px(2));
+      lv_obj_set_style_radius(dot, dot_size / 2, 0);
       lv_obj_set_style_border_width(dot, 0, 0);
       lv_obj_set_style_bg_color(dot, lv_color_hex(0x555555), 0);
       this->dots_.push_back(dot);
@@ -143,11 +141,14 @@ void SwitchApp::create_app_ui() {
   for (size_t i = 0; i < this->switches_.size(); i++) {
     if (this->switches_[i].sw != nullptr) {
       this->switches_[i].sw->add_on_state_callback([this](bool state) {
-        // Only update if this app is currently active
-        if (g_current_switch_app == this) {
-          ESP_LOGD(TAG, "Switch state changed callback, refreshing UI");
-          this->update_state();
-        }
+        this->run_ui_(this, [](void *ctx, int32_t, float) {
+          auto *app = static_cast<SwitchApp *>(ctx);
+          // Only update if this app is currently active
+          if (app->active_) {
+            ESP_LOGD(TAG, "Switch state changed callback, refreshing UI");
+            app->update_state();
+          }
+        });
       });
     }
   }
@@ -176,7 +177,7 @@ void SwitchApp::update_state() {
   
   // Update name label with current switch name
   if (this->name_label_ != nullptr) {
-    lv_label_set_text(this->name_label_, current.name.c_str());
+    lv_label_set_text(this->name_label_, current.name);
   }
   
   if (is_on) {
@@ -193,7 +194,7 @@ void SwitchApp::update_state() {
     lv_label_set_text(this->state_label_, LV_SYMBOL_POWER);
   }
   
-  ESP_LOGD(TAG, "Switch '%s' state: %s", current.name.c_str(), is_on ? "ON" : "OFF");
+  ESP_LOGD(TAG, "Switch '%s' state: %s", current.name, is_on ? "ON" : "OFF");
 }
 
 void SwitchApp::update_dots() {
@@ -222,12 +223,20 @@ void SwitchApp::toggle() {
     return;
   }
   
-  ESP_LOGI(TAG, "Toggling switch: %s", current.name.c_str());
-  current.sw->toggle();
-  
+  this->toggle_switch_(this->current_index_);
   // Note: UI will be updated by the state callback when switch reports new state
 }
 
+void SwitchApp::toggle_switch_(int index) {
+  if (this->defer_to_main_(this, [](void *app, int32_t index, float) {
+        static_cast<SwitchApp *>(app)->toggle_switch_(index);
+      }, index))
+    return;
+  SwitchItem &item = this->switches_[index];
+  ESP_LOGI(TAG, "Toggling switch: %s", item.name);
+  item.sw->toggle();
+}
+
 void SwitchApp::state_btn_event_cb(lv_event_t *e) {
   lv_obj_t *btn = lv_event_get_target(e);
   SwitchApp *app = static_cast<SwitchApp *>(lv_obj_get_user_data(btn));
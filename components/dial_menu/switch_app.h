@@ -8,6 +8,7 @@
 #pragma once
 
 #include "dial_menu_controller.h"
+#include "memory_policy.h"
 #include "esphome/components/switch/switch.h"
 #include "esphome/components/font/font.h"
 #include <vector>
@@ -20,7 +21,7 @@ namespace dial_menu {
  */
 struct SwitchItem {
   switch_::Switch *sw;
-  std::string name;
+  const char *name;
   uint32_t color;
 };
 
@@ -37,7 +38,7 @@ struct SwitchItem {
 class SwitchApp : public DialApp {
  public:
   // Add a switch to the app (can add multiple)
-  void add_switch(switch_::Switch *sw, const std::string &name, uint32_t color);
+  void add_switch(switch_::Switch *sw, const char *name, uint32_t color);
   
   // Set custom font for labels
   void set_font_14(font::Font *font) { this->font_14_ = font; }
@@ -58,6 +59,11 @@ class SwitchApp : public DialApp {
   // This app needs its own UI page
   bool needs_ui() const override { return true; }
   
+  uint8_t get_view_index() const override { return this->current_index_; }
+  void restore_view_index(uint8_t index) override {
+    if (index < this->switches_.size()) this->current_index_ = index;
+  }
+  
   // Create the app's UI (called during setup)
   void create_app_ui() override;
   
@@ -82,8 +88,12 @@ class SwitchApp : public DialApp {
   size_t get_switch_count() const { return this->switches_.size(); }
 
  protected:
-  std::vector<SwitchItem> switches_;
+  // Toggle switch `index`, from the main loop
+  void toggle_switch_(int index);
+  
+  ColdVector<SwitchItem> switches_;
   int current_index_{0};
+  bool active_{false};  // Page shown, state callbacks refresh the UI
   
   // Custom font (optional)
   font::Font *font_14_{nullptr};
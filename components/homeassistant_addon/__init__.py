@@ -1,6 +1,6 @@
 """
 homeassistant_addon component for ESPHome
-Provides cover, climate, and media_player platforms imported from Home Assistant.
+Provides cover, climate, media_player, light and number entities imported from Home Assistant.
 
 These entity types are not natively available in ESPHome's homeassistant platform.
 
@@ -20,12 +20,29 @@ Usage:
     media_players:
       - id: my_speaker
         entity_id: media_player.living_room
+        packed_entity_id: sensor.living_room_speaker_packed  # Optional, see README
+    lights:
+      - id: my_lamp
+        entity_id: light.living_room
+        stream_rate: 5Hz
+    numbers:
+      - id: my_setpoint
+        entity_id: input_number.fan_speed
 """
 import esphome.codegen as cg
+from esphome.components import sensor
 import esphome.config_validation as cv
-from esphome.const import CONF_ENTITY_ID, CONF_ID, CONF_INTERNAL
+from esphome.const import (
+    CONF_ENTITY_ID,
+    CONF_ID,
+    CONF_INTERNAL,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_MILLISECOND,
+)
 
 DEPENDENCIES = ["api"]
+AUTO_LOAD = ["sensor"]
 CODEOWNERS = ["@AntorFr"]
 
 # Namespace - shared by all platforms
@@ -41,10 +58,93 @@ HomeassistantClimate = homeassistant_addon_ns.class_(
 HomeassistantMediaPlayer = homeassistant_addon_ns.class_(
     "HomeassistantMediaPlayer", cg.Component
 )
+HomeassistantLight = homeassistant_addon_ns.class_(
+    "HomeassistantLight", cg.Component
+)
+HomeassistantNumber = homeassistant_addon_ns.class_(
+    "HomeassistantNumber", cg.Component
+)
 
 # Configuration keys for media player (not a standard platform)
 CONF_MEDIA_PLAYERS = "media_players"
 CONF_VOLUME_STEP = "volume_step"
+CONF_SOURCE_LIST_ITEMS = "source_list_items"
+CONF_SOURCE_LIST_BYTES = "source_list_bytes"
+CONF_LIGHTS = "lights"
+CONF_NUMBERS = "numbers"
+CONF_STREAM_RATE = "stream_rate"
+CONF_MEDIA_TITLE_LENGTH = "media_title_length"
+CONF_MEDIA_ARTIST_LENGTH = "media_artist_length"
+CONF_MEDIA_SOURCE_LENGTH = "media_source_length"
+CONF_MEDIA_PICTURE_LENGTH = "media_picture_length"
+CONF_PACKED_ENTITY_ID = "packed_entity_id"
+CONF_PACKED_ATTRIBUTE = "packed_attribute"
+
+# Opt-in packed mode: all the attributes come from one attribute of a HA template sensor
+# (one subscription and one API message per change instead of one per attribute)
+PACKED_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_PACKED_ENTITY_ID): cv.entity_id,
+        cv.Optional(CONF_PACKED_ATTRIBUTE, default="packed"): cv.string_strict,
+    }
+)
+
+# Command round-trip latency (action sent -> first state update from HA), optional diagnostic sensors
+CONF_LATENCY = "latency"
+CONF_P50 = "p50"
+CONF_P95 = "p95"
+CONF_MAX = "max"
+
+_LATENCY_SENSOR_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_MILLISECOND,
+    icon="mdi:timer-outline",
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
+LATENCY_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_LATENCY): cv.Schema(
+            {
+                cv.Optional(CONF_P50): _LATENCY_SENSOR_SCHEMA,
+                cv.Optional(CONF_P95): _LATENCY_SENSOR_SCHEMA,
+                cv.Optional(CONF_MAX): _LATENCY_SENSOR_SCHEMA,
+            }
+        ),
+    }
+)
+
+
+# Last known state, restored at boot and shown as stale until HA answers.
+# Written at most once per interval and entity (flash wear), 0s disables it.
+CONF_SNAPSHOT_INTERVAL = "snapshot_interval"
+
+SNAPSHOT_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_SNAPSHOT_INTERVAL, default="5min"): cv.positive_time_period_milliseconds,
+    }
+)
+
+
+def setup_snapshot(var, config):
+    """Set the snapshot interval of a mirror (shared with the cover/climate platforms)."""
+    cg.add(var.set_snapshot_interval(config[CONF_SNAPSHOT_INTERVAL]))
+
+
+async def setup_latency_sensors(var, config):
+    """Register the latency sensors of a mirror (shared with the cover/climate platforms)."""
+    if CONF_LATENCY not in config:
+        return
+    tracker = var.get_latency_tracker()
+    latency = config[CONF_LATENCY]
+    if CONF_P50 in latency:
+        cg.add(tracker.set_p50_sensor(await sensor.new_sensor(latency[CONF_P50])))
+    if CONF_P95 in latency:
+        cg.add(tracker.set_p95_sensor(await sensor.new_sensor(latency[CONF_P95])))
+    if CONF_MAX in latency:
+        cg.add(tracker.set_max_sensor(await sensor.new_sensor(latency[CONF_MAX])))
+
 
 # Media player schema (custom, since media_player is not a standard ESPHome platform)
 MEDIA_PLAYER_SCHEMA = cv.Schema(
@@ -53,19 +153,53 @@ MEDIA_PLAYER_SCHEMA = cv.Schema(
         cv.Required(CONF_ENTITY_ID): cv.entity_id,
         cv.Optional(CONF_INTERNAL, default=True): cv.boolean,
         cv.Optional(CONF_VOLUME_STEP, default=0.05): cv.float_range(min=0.01, max=0.2),
+        # Capacity of source_list, sources past it are dropped (and logged).
+        # The text defaults to 16 bytes per source; item offsets are 16 bit.
+        cv.Optional(CONF_SOURCE_LIST_ITEMS, default=32): cv.int_range(min=1, max=4096),
+        cv.Optional(CONF_SOURCE_LIST_BYTES): cv.int_range(min=64, max=65535),
     }
-).extend(cv.COMPONENT_SCHEMA)
+).extend(PACKED_SCHEMA).extend(LATENCY_SCHEMA).extend(SNAPSHOT_SCHEMA).extend(cv.COMPONENT_SCHEMA)
 
-# Main schema - only for media_players (cover and climate use platform syntax)
+# Light and number schemas - setpoints are streamed at most stream_rate times per second
+# while the encoder moves (latest value wins, the last one is always sent)
+LIGHT_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(HomeassistantLight),
+        cv.Required(CONF_ENTITY_ID): cv.entity_id,
+        cv.Optional(CONF_STREAM_RATE, default="5Hz"): cv.All(cv.frequency, cv.float_range(min=0.5, max=20)),
+    }
+).extend(LATENCY_SCHEMA).extend(SNAPSHOT_SCHEMA).extend(cv.COMPONENT_SCHEMA)
+
+NUMBER_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(HomeassistantNumber),
+        cv.Required(CONF_ENTITY_ID): cv.entity_id,
+        cv.Optional(CONF_STREAM_RATE, default="5Hz"): cv.All(cv.frequency, cv.float_range(min=0.5, max=20)),
+    }
+).extend(LATENCY_SCHEMA).extend(SNAPSHOT_SCHEMA).extend(cv.COMPONENT_SCHEMA)
+
+# Main schema - for entity types without a standard platform (cover and climate use platform syntax)
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.Optional(CONF_MEDIA_PLAYERS): cv.ensure_list(MEDIA_PLAYER_SCHEMA),
+        cv.Optional(CONF_LIGHTS): cv.ensure_list(LIGHT_SCHEMA),
+        cv.Optional(CONF_NUMBERS): cv.ensure_list(NUMBER_SCHEMA),
+        # Fixed capacity (bytes) of the mirrored media strings, longer values are truncated
+        cv.Optional(CONF_MEDIA_TITLE_LENGTH, default=96): cv.int_range(min=16, max=1024),
+        cv.Optional(CONF_MEDIA_ARTIST_LENGTH, default=64): cv.int_range(min=16, max=1024),
+        cv.Optional(CONF_MEDIA_SOURCE_LENGTH, default=48): cv.int_range(min=16, max=1024),
+        cv.Optional(CONF_MEDIA_PICTURE_LENGTH, default=256): cv.int_range(min=64, max=2048),
     }
 )
 
 
 async def to_code(config):
-    # Only process media players here (cover and climate are handled by their platforms)
+    cg.add_define("HOMEASSISTANT_ADDON_MEDIA_TITLE_LENGTH", config[CONF_MEDIA_TITLE_LENGTH])
+    cg.add_define("HOMEASSISTANT_ADDON_MEDIA_ARTIST_LENGTH", config[CONF_MEDIA_ARTIST_LENGTH])
+    cg.add_define("HOMEASSISTANT_ADDON_MEDIA_SOURCE_LENGTH", config[CONF_MEDIA_SOURCE_LENGTH])
+    cg.add_define("HOMEASSISTANT_ADDON_MEDIA_PICTURE_LENGTH", config[CONF_MEDIA_PICTURE_LENGTH])
+
+    # Only process media players, lights and numbers here (cover and climate are handled by their platforms)
     for conf in config.get(CONF_MEDIA_PLAYERS, []):
         # Enable required API features
         cg.add_define("USE_API_HOMEASSISTANT_STATES")
@@ -76,3 +210,33 @@ async def to_code(config):
         
         cg.add(var.set_entity_id(conf[CONF_ENTITY_ID]))
         cg.add(var.set_volume_step(conf[CONF_VOLUME_STEP]))
+        items = conf[CONF_SOURCE_LIST_ITEMS]
+        cg.add(var.set_source_list_capacity(items, conf.get(CONF_SOURCE_LIST_BYTES, min(items * 16, 65535))))
+        if CONF_PACKED_ENTITY_ID in conf:
+            cg.add(var.set_packed_source(conf[CONF_PACKED_ENTITY_ID], conf[CONF_PACKED_ATTRIBUTE]))
+        setup_snapshot(var, conf)
+        await setup_latency_sensors(var, conf)
+
+    for conf in config.get(CONF_LIGHTS, []):
+        cg.add_define("USE_API_HOMEASSISTANT_STATES")
+        cg.add_define("USE_API_HOMEASSISTANT_SERVICES")
+
+        var = cg.new_Pvariable(conf[CONF_ID])
+        await cg.register_component(var, conf)
+
+        cg.add(var.set_entity_id(conf[CONF_ENTITY_ID]))
+        cg.add(var.set_stream_interval(int(1000 / conf[CONF_STREAM_RATE])))
+        setup_snapshot(var, conf)
+        await setup_latency_sensors(var, conf)
+
+    for conf in config.get(CONF_NUMBERS, []):
+        cg.add_define("USE_API_HOMEASSISTANT_STATES")
+        cg.add_define("USE_API_HOMEASSISTANT_SERVICES")
+
+        var = cg.new_Pvariable(conf[CONF_ID])
+        await cg.register_component(var, conf)
+
+        cg.add(var.set_entity_id(conf[CONF_ENTITY_ID]))
+        cg.add(var.set_stream_interval(int(1000 / conf[CONF_STREAM_RATE])))
+        setup_snapshot(var, conf)
+        await setup_latency_sensors(var, conf)
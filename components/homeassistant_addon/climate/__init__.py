@@ -9,13 +9,25 @@ Usage:
       temperature_step: 0.5
       min_temperature: 15
       max_temperature: 30
+      # Optional: read everything from one template sensor attribute (see README)
+      packed_entity_id: sensor.living_room_climate_packed
 """
 import esphome.codegen as cg
 from esphome.components import climate
 import esphome.config_validation as cv
 from esphome.const import CONF_ENTITY_ID, CONF_ID, CONF_INTERNAL
 
-from .. import homeassistant_addon_ns, DEPENDENCIES
+from .. import (
+    homeassistant_addon_ns,
+    DEPENDENCIES,
+    CONF_PACKED_ENTITY_ID,
+    CONF_PACKED_ATTRIBUTE,
+    PACKED_SCHEMA,
+    LATENCY_SCHEMA,
+    SNAPSHOT_SCHEMA,
+    setup_latency_sensors,
+    setup_snapshot,
+)
 
 CONF_TEMPERATURE_STEP = "temperature_step"
 CONF_MIN_TEMPERATURE = "min_temperature"
@@ -33,7 +45,7 @@ CONFIG_SCHEMA = climate.climate_schema(HomeassistantClimate).extend(
         cv.Optional(CONF_MIN_TEMPERATURE, default=7.0): cv.float_range(min=-20, max=50),
         cv.Optional(CONF_MAX_TEMPERATURE, default=35.0): cv.float_range(min=-20, max=50),
     }
-).extend(cv.COMPONENT_SCHEMA)
+).extend(PACKED_SCHEMA).extend(LATENCY_SCHEMA).extend(SNAPSHOT_SCHEMA).extend(cv.COMPONENT_SCHEMA)
 
 
 async def to_code(config):
@@ -49,3 +61,7 @@ async def to_code(config):
     cg.add(var.set_temperature_step(config[CONF_TEMPERATURE_STEP]))
     cg.add(var.set_min_temperature(config[CONF_MIN_TEMPERATURE]))
     cg.add(var.set_max_temperature(config[CONF_MAX_TEMPERATURE]))
+    if CONF_PACKED_ENTITY_ID in config:
+        cg.add(var.set_packed_source(config[CONF_PACKED_ENTITY_ID], config[CONF_PACKED_ATTRIBUTE]))
+    setup_snapshot(var, config)
+    await setup_latency_sensors(var, config)
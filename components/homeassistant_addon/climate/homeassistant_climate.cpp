@@ -4,7 +4,9 @@
  */
 
 #include "homeassistant_climate.h"
+#include "../packed_payload.h"
 #include "esphome/components/api/api_server.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -15,6 +17,21 @@ static const char *const TAG = "homeassistant_addon.climate";
 void HomeassistantClimate::setup() {
   ESP_LOGI(TAG, "Setting up Home Assistant Climate '%s'...", this->entity_id_);
   
+  // Start with the YAML limits (or the last known ones), HA attributes override them once received
+  this->restore_snapshot_();
+  this->rebuild_traits_();
+  if (this->stale_) {
+    this->publish_state();
+  }
+  
+  if (this->packed_entity_id_ != nullptr) {
+    // Packed mode: one template sensor attribute carries everything, one publish per change
+    api::global_api_server->subscribe_home_assistant_state(
+        this->packed_entity_id_, std::string(this->packed_attribute_),
+        [this](StringRef payload) { this->on_packed_payload_(payload); });
+    return;
+  }
+  
   // Subscribe to the main state (hvac_mode)
   api::global_api_server->subscribe_home_assistant_state(
       this->entity_id_, optional<std::string>(), 
@@ -22,8 +39,9 @@ void HomeassistantClimate::setup() {
         std::string state_str = state.str();
         ESP_LOGD(TAG, "'%s': Got state: %s", this->entity_id_, state_str.c_str());
         this->parse_hvac_mode(state_str);
+        this->latency_.confirm(LATENCY_MODE, this->mode);
         this->received_state_ = true;
-        this->publish_state();
+        this->publish_update_();
       });
   
   // Subscribe to current_temperature attribute
@@ -33,7 +51,7 @@ void HomeassistantClimate::setup() {
         std::string state_str = state.str();
         ESP_LOGD(TAG, "'%s': Got current_temperature: %s", this->entity_id_, state_str.c_str());
         this->parse_current_temperature(state_str);
-        this->publish_state();
+        this->publish_update_();
       });
   
   // Subscribe to temperature (target) attribute
@@ -43,7 +61,8 @@ void HomeassistantClimate::setup() {
         std::string state_str = state.str();
         ESP_LOGD(TAG, "'%s': Got target temperature: %s", this->entity_id_, state_str.c_str());
         this->parse_target_temperature(state_str);
-        this->publish_state();
+        this->latency_.confirm(LATENCY_TARGET_TEMPERATURE, this->target_temperature);
+        this->publish_update_();
       });
   
   // Subscribe to hvac_action attribute (heating, cooling, idle, off)
@@ -53,33 +72,133 @@ void HomeassistantClimate::setup() {
         std::string state_str = state.str();
         ESP_LOGD(TAG, "'%s': Got hvac_action: %s", this->entity_id_, state_str.c_str());
         this->parse_hvac_action(state_str);
-        this->publish_state();
+        this->publish_update_();
+      });
+  
+  // Subscribe to the attributes that define the traits
+  api::global_api_server->subscribe_home_assistant_state(
+      this->entity_id_, std::string("hvac_modes"),
+      [this](StringRef state) {
+        ESP_LOGD(TAG, "'%s': Got hvac_modes: %.*s", this->entity_id_, (int) state.size(), state.c_str());
+        if (this->parse_hvac_modes(state)) {
+          this->rebuild_traits_();
+          this->publish_update_();
+        }
+      });
+  this->subscribe_trait_("min_temp", &this->min_temperature_);
+  this->subscribe_trait_("max_temp", &this->max_temperature_);
+  this->subscribe_trait_("target_temp_step", &this->temperature_step_);
+}
+
+void HomeassistantClimate::subscribe_trait_(const char *attribute, float *target) {
+  api::global_api_server->subscribe_home_assistant_state(
+      this->entity_id_, std::string(attribute),
+      [this, attribute, target](StringRef state) {
+        ESP_LOGD(TAG, "'%s': Got %s: %.*s", this->entity_id_, attribute, (int) state.size(), state.c_str());
+        if (this->parse_trait_(state.str(), target)) {
+          this->rebuild_traits_();
+          this->publish_update_();
+        }
       });
 }
 
+void HomeassistantClimate::on_packed_payload_(StringRef payload) {
+  // hvac_mode|current_temperature|temperature|hvac_action|min_temp|max_temp|target_temp_step|hvac_modes
+  StringRef fields[8];
+  if (split_packed_payload(payload, fields) < 4) {
+    ESP_LOGW(TAG, "'%s': Packed payload is incomplete", this->packed_entity_id_);
+    return;
+  }
+  ESP_LOGD(TAG, "'%s': Got packed state: %.*s", this->entity_id_, (int) payload.size(), payload.c_str());
+  
+  this->parse_hvac_mode(fields[0].str());
+  this->parse_current_temperature(fields[1].str());
+  this->parse_target_temperature(fields[2].str());
+  this->parse_hvac_action(fields[3].str());
+  
+  bool traits_changed = this->parse_trait_(fields[4].str(), &this->min_temperature_);
+  traits_changed |= this->parse_trait_(fields[5].str(), &this->max_temperature_);
+  traits_changed |= this->parse_trait_(fields[6].str(), &this->temperature_step_);
+  traits_changed |= this->parse_hvac_modes(fields[7]);
+  if (traits_changed) {
+    this->rebuild_traits_();
+  }
+  
+  // One publish for the whole payload
+  this->latency_.confirm(LATENCY_MODE, this->mode);
+  this->latency_.confirm(LATENCY_TARGET_TEMPERATURE, this->target_temperature);
+  this->received_state_ = true;
+  this->publish_update_();
+}
+
+void HomeassistantClimate::publish_update_() {
+  // Anything received from HA replaces the restored state
+  this->stale_ = false;
+  ClimateSnapshot snapshot;
+  snapshot.mode = static_cast<uint8_t>(this->mode);
+  snapshot.action = static_cast<uint8_t>(this->action);
+  snapshot.current_temperature = this->current_temperature;
+  snapshot.target_temperature = this->target_temperature;
+  snapshot.min_temperature = this->min_temperature_;
+  snapshot.max_temperature = this->max_temperature_;
+  snapshot.temperature_step = this->temperature_step_;
+  snapshot.supported_modes_mask = this->supported_modes_mask_;
+  this->snapshot_.update(snapshot);
+  this->publish_state();
+}
+
+void HomeassistantClimate::restore_snapshot_() {
+  ClimateSnapshot snapshot;
+  if (!this->snapshot_.restore(this->entity_id_, &snapshot)) return;
+  this->mode = static_cast<climate::ClimateMode>(snapshot.mode);
+  this->action = static_cast<climate::ClimateAction>(snapshot.action);
+  this->current_temperature = snapshot.current_temperature;
+  this->target_temperature = snapshot.target_temperature;
+  this->min_temperature_ = snapshot.min_temperature;
+  this->max_temperature_ = snapshot.max_temperature;
+  this->temperature_step_ = snapshot.temperature_step;
+  this->supported_modes_mask_ = snapshot.supported_modes_mask;
+  this->stale_ = true;
+  ESP_LOGD(TAG, "'%s': Restored %s, target %.1f", this->entity_id_, climate::climate_mode_to_string(this->mode),
+           this->target_temperature);
+}
+
 void HomeassistantClimate::dump_config() {
   ESP_LOGCONFIG(TAG, "Home Assistant Climate:");
   ESP_LOGCONFIG(TAG, "  Entity ID: '%s'", this->entity_id_);
   ESP_LOGCONFIG(TAG, "  Temperature Step: %.1f", this->temperature_step_);
   ESP_LOGCONFIG(TAG, "  Min Temperature: %.1f", this->min_temperature_);
   ESP_LOGCONFIG(TAG, "  Max Temperature: %.1f", this->max_temperature_);
+  if (this->packed_entity_id_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Packed From: '%s[%s]'", this->packed_entity_id_, this->packed_attribute_);
+  }
+  ESP_LOGCONFIG(TAG, "  Snapshot Interval: %u ms (%u writes)", this->snapshot_.get_min_interval(),
+                this->snapshot_.get_writes());
+  this->latency_.dump_config(TAG);
 }
 
 float HomeassistantClimate::get_setup_priority() const {
-  return setup_priority::AFTER_CONNECTION;
+  // Before WiFi and the dial: the snapshot is shown from the first frame (see StateSnapshot)
+  return setup_priority::DATA;
 }
 
-climate::ClimateTraits HomeassistantClimate::traits() {
+void HomeassistantClimate::rebuild_traits_() {
   auto traits = climate::ClimateTraits();
   
-  // Supported modes
-  traits.set_supported_modes({
-      climate::CLIMATE_MODE_OFF,
-      climate::CLIMATE_MODE_HEAT,
-      climate::CLIMATE_MODE_COOL,
-      climate::CLIMATE_MODE_HEAT_COOL,
-      climate::CLIMATE_MODE_AUTO,
-  });
+  // Supported modes, as reported by HA (defaults until hvac_modes is received)
+  if (this->supported_modes_mask_ == 0) {
+    traits.add_supported_mode(climate::CLIMATE_MODE_OFF);
+    traits.add_supported_mode(climate::CLIMATE_MODE_HEAT);
+    traits.add_supported_mode(climate::CLIMATE_MODE_COOL);
+    traits.add_supported_mode(climate::CLIMATE_MODE_HEAT_COOL);
+    traits.add_supported_mode(climate::CLIMATE_MODE_AUTO);
+  } else {
+    for (uint32_t i = 0; i < 32; i++) {
+      if (this->supported_modes_mask_ & (1u << i)) {
+        traits.add_supported_mode(static_cast<climate::ClimateMode>(i));
+      }
+    }
+  }
   
   // Temperature settings
   traits.add_feature_flags(climate::CLIMATE_SUPPORTS_CURRENT_TEMPERATURE);
@@ -87,7 +206,8 @@ climate::ClimateTraits HomeassistantClimate::traits() {
   traits.set_visual_max_temperature(this->max_temperature_);
   traits.set_visual_temperature_step(this->temperature_step_);
   
-  return traits;
+  this->traits_ = traits;
+  this->traits_generation_++;
 }
 
 void HomeassistantClimate::control(const climate::ClimateCall &call) {
@@ -136,6 +256,8 @@ void HomeassistantClimate::send_set_temperature(float temperature) {
   temp_kv.value = StringRef(temp_value);
   
   api::global_api_server->send_homeassistant_action(req);
+  // Sent with one decimal
+  this->latency_.start(LATENCY_TARGET_TEMPERATURE, strtof(temp_str, nullptr), 0.05f);
 }
 
 void HomeassistantClimate::send_set_hvac_mode(climate::ClimateMode mode) {
@@ -164,6 +286,7 @@ void HomeassistantClimate::send_set_hvac_mode(climate::ClimateMode mode) {
   mode_kv.value = StringRef(mode_str);
   
   api::global_api_server->send_homeassistant_action(req);
+  this->latency_.start(LATENCY_MODE, mode);
 }
 
 void HomeassistantClimate::parse_current_temperature(const std::string &state) {
@@ -198,6 +321,42 @@ void HomeassistantClimate::parse_hvac_mode(const std::string &state) {
   this->mode = ha_mode_to_esphome(state);
 }
 
+bool HomeassistantClimate::parse_trait_(const std::string &state, float *target) {
+  auto value = parse_number<float>(state);
+  if (!value.has_value() || value.value() == *target) {
+    return false;
+  }
+  *target = value.value();
+  return true;
+}
+
+bool HomeassistantClimate::parse_hvac_modes(StringRef state) {
+  // HA sends the list as its string form, e.g. "['off', 'heat', 'auto']" (or "off,heat,auto" when packed)
+  if (state.empty() || state == "None" || state == "unknown" || state == "unavailable") {
+    return false;
+  }
+  if (!this->hvac_modes_.update(state)) {
+    return false;
+  }
+  if (this->hvac_modes_.get_dropped() > 0) {
+    ESP_LOGW(TAG, "'%s' hvac_modes: %u modes dropped, over %u modes / %u bytes", this->entity_id_,
+             (unsigned) this->hvac_modes_.get_dropped(), (unsigned) this->hvac_modes_.get_max_items(),
+             (unsigned) this->hvac_modes_.get_max_bytes());
+  }
+  
+  uint32_t mask = 0;
+  for (size_t i = 0; i < this->hvac_modes_.size(); i++) {
+    climate::ClimateMode mode = ha_mode_to_esphome(this->hvac_modes_.get(i).str());
+    mask |= 1u << static_cast<uint32_t>(mode);
+  }
+  
+  if (mask == 0 || mask == this->supported_modes_mask_) {
+    return false;
+  }
+  this->supported_modes_mask_ = mask;
+  return true;
+}
+
 void HomeassistantClimate::parse_hvac_action(const std::string &state) {
   if (state.empty() || state == "unknown" || state == "unavailable") {
     return;
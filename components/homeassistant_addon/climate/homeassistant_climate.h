@@ -10,10 +10,25 @@
 #include "esphome/core/component.h"
 #include "esphome/core/string_ref.h"
 #include "esphome/components/climate/climate.h"
+#include "../latency_tracker.h"
+#include "../list_attribute.h"
+#include "../state_snapshot.h"
 
 namespace esphome {
 namespace homeassistant_addon {
 
+struct ClimateSnapshot {
+  static constexpr uint32_t TYPE = 0x434C4D31;  // "CLM1"
+  uint8_t mode;
+  uint8_t action;
+  float current_temperature;
+  float target_temperature;
+  float min_temperature;
+  float max_temperature;
+  float temperature_step;
+  uint32_t supported_modes_mask;
+} __attribute__((packed));
+
 /**
  * @brief Climate component that mirrors a Home Assistant climate entity
  * 
@@ -34,11 +49,27 @@ class HomeassistantClimate : public climate::Climate, public Component {
   void set_temperature_step(float step) { this->temperature_step_ = step; }
   void set_min_temperature(float min_temp) { this->min_temperature_ = min_temp; }
   void set_max_temperature(float max_temp) { this->max_temperature_ = max_temp; }
+  // Packed mode: read everything from one attribute of a template sensor
+  void set_packed_source(const char *entity_id, const char *attribute) {
+    this->packed_entity_id_ = entity_id;
+    this->packed_attribute_ = attribute;
+  }
+  // Last state saved at most this often and restored at boot, 0 = not persisted
+  void set_snapshot_interval(uint32_t interval_ms) { this->snapshot_.set_min_interval(interval_ms); }
+  // Restored from the snapshot, HA has not confirmed it yet
+  bool is_stale() const { return this->stale_; }
+  
+  // Climate traits (cached, rebuilt when HA pushes new limits or modes)
+  climate::ClimateTraits traits() override { return this->traits_; }
+  // Bumped by every rebuild: a consumer copies get_traits() again only when it moved
+  uint32_t get_traits_generation() const { return this->traits_generation_; }
   
-  // Climate traits
-  climate::ClimateTraits traits() override;
+  LatencyTracker &get_latency_tracker() { return this->latency_; }
   
  protected:
+  // Fields a command's latency is confirmed on
+  enum LatencyField : uint8_t { LATENCY_MODE, LATENCY_TARGET_TEMPERATURE };
+
   // Called when user changes settings via ESPHome
   void control(const climate::ClimateCall &call) override;
   
@@ -51,6 +82,17 @@ class HomeassistantClimate : public climate::Climate, public Component {
   void parse_target_temperature(const std::string &state);
   void parse_hvac_mode(const std::string &state);
   void parse_hvac_action(const std::string &state);
+  // Trait parsers return true if the value changed (traits need a rebuild)
+  bool parse_hvac_modes(StringRef state);
+  bool parse_trait_(const std::string &state, float *target);
+  void on_packed_payload_(StringRef payload);
+  
+  // Subscribe to a numeric attribute that feeds the traits (min_temp, max_temp, ...)
+  void subscribe_trait_(const char *attribute, float *target);
+  void rebuild_traits_();
+  // Publish what HA sent, and keep it for the next boot
+  void publish_update_();
+  void restore_snapshot_();
   
   // Convert between ESPHome and HA modes
   static climate::ClimateMode ha_mode_to_esphome(const std::string &mode);
@@ -61,9 +103,23 @@ class HomeassistantClimate : public climate::Climate, public Component {
   float temperature_step_{0.5f};
   float min_temperature_{7.0f};
   float max_temperature_{35.0f};
+  const char *packed_entity_id_{nullptr};
+  const char *packed_attribute_{nullptr};
+  
+  // Modes reported by HA (bit per climate::ClimateMode), 0 = not received yet
+  uint32_t supported_modes_mask_{0};
+  // HA's HVACMode is a closed set of 7 names (35 bytes); room for all of them plus spares
+  ListAttribute hvac_modes_{16, 128};
+  climate::ClimateTraits traits_;
+  uint32_t traits_generation_{0};
   
   // Track if we've received initial state
   bool received_state_{false};
+  bool stale_{false};
+  
+  StateSnapshot<ClimateSnapshot> snapshot_{this, "snapshot"};
+  
+  LatencyTracker latency_;
 };
 
 }  // namespace homeassistant_addon
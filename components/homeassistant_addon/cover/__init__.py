@@ -12,7 +12,14 @@ from esphome.components import cover
 import esphome.config_validation as cv
 from esphome.const import CONF_ENTITY_ID, CONF_ID, CONF_INTERNAL
 
-from .. import homeassistant_addon_ns, DEPENDENCIES
+from .. import (
+    homeassistant_addon_ns,
+    DEPENDENCIES,
+    LATENCY_SCHEMA,
+    SNAPSHOT_SCHEMA,
+    setup_latency_sensors,
+    setup_snapshot,
+)
 
 HomeassistantCover = homeassistant_addon_ns.class_(
     "HomeassistantCover", cover.Cover, cg.Component
@@ -23,7 +30,7 @@ CONFIG_SCHEMA = cover.cover_schema(HomeassistantCover).extend(
         cv.Required(CONF_ENTITY_ID): cv.entity_id,
         cv.Optional(CONF_INTERNAL, default=True): cv.boolean,
     }
-).extend(cv.COMPONENT_SCHEMA)
+).extend(LATENCY_SCHEMA).extend(SNAPSHOT_SCHEMA).extend(cv.COMPONENT_SCHEMA)
 
 
 async def to_code(config):
@@ -35,3 +42,5 @@ async def to_code(config):
     await cg.register_component(var, config)
     
     cg.add(var.set_entity_id(config[CONF_ENTITY_ID]))
+    setup_snapshot(var, config)
+    await setup_latency_sensors(var, config)
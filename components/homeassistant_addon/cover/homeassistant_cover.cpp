@@ -1,6 +1,8 @@
 #include "homeassistant_cover.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include <cmath>
+#include <cstring>
 
 namespace esphome {
 namespace homeassistant_addon {
@@ -11,6 +13,18 @@ void HomeassistantCover::setup() {
   ESP_LOGD(TAG, "Setting up HomeAssistant Cover '%s' for entity '%s'", 
            this->get_name().c_str(), this->entity_id_);
   
+  // Last known state until HA answers
+  CoverSnapshot snapshot;
+  if (this->snapshot_.restore(this->entity_id_, &snapshot)) {
+    this->position = snapshot.position;
+    this->tilt = snapshot.tilt;
+    this->supports_position_ = snapshot.supports_position != 0;
+    this->supports_tilt_ = snapshot.supports_tilt != 0;
+    this->stale_ = true;
+    ESP_LOGD(TAG, "'%s' restored position: %.2f", this->entity_id_, this->position);
+    this->publish_state(false);
+  }
+  
   // Subscribe to state changes
   api::global_api_server->subscribe_home_assistant_state(
       this->entity_id_, nullopt,
@@ -35,7 +49,8 @@ void HomeassistantCover::setup() {
           auto val = parse_number<float>(tilt_str);
           if (val.has_value()) {
             this->tilt = val.value() / 100.0f;
-            this->publish_state(false);
+            this->latency_.confirm(LATENCY_TILT, this->tilt);
+            this->publish_update_();
           }
         }
       });
@@ -60,7 +75,11 @@ void HomeassistantCover::on_state_received(StringRef state) {
     return;
   }
   
-  this->publish_state(false);
+  this->latency_.confirm(LATENCY_OPERATION, this->current_operation);
+  if (this->current_operation == cover::COVER_OPERATION_IDLE) {
+    this->latency_.confirm(LATENCY_POSITION, this->position);
+  }
+  this->publish_update_();
 }
 
 void HomeassistantCover::on_position_received(StringRef position_str) {
@@ -77,10 +96,23 @@ void HomeassistantCover::on_position_received(StringRef position_str) {
     this->position = val.value() / 100.0f;
     ESP_LOGD(TAG, "'%s' received position: %.0f%% -> %.2f", 
              this->entity_id_, val.value(), this->position);
-    this->publish_state(false);
+    this->latency_.confirm(LATENCY_POSITION, this->position);
+    this->publish_update_();
   }
 }
 
+void HomeassistantCover::publish_update_() {
+  // Anything received from HA replaces the restored state
+  this->stale_ = false;
+  CoverSnapshot snapshot;
+  snapshot.position = this->position;
+  snapshot.tilt = this->tilt;
+  snapshot.supports_position = this->supports_position_;
+  snapshot.supports_tilt = this->supports_tilt_;
+  this->snapshot_.update(snapshot);
+  this->publish_state(false);
+}
+
 cover::CoverTraits HomeassistantCover::get_traits() {
   auto traits = cover::CoverTraits();
   traits.set_supports_stop(this->supports_stop_);
@@ -135,7 +167,7 @@ void HomeassistantCover::control(const cover::CoverCall &call) {
       entity_id_kv.key = ENTITY_ID_KEY;
       entity_id_kv.value = StringRef(entity_id_str);
       
-      position_str = to_string(static_cast<int>(pos * 100));
+      position_str = to_string(static_cast<int>(std::lround(pos * 100)));
       auto &pos_kv = req.data.emplace_back();
       pos_kv.key = POSITION_KEY;
       pos_kv.value = StringRef(position_str);
@@ -150,7 +182,7 @@ void HomeassistantCover::control(const cover::CoverCall &call) {
     entity_id_kv.key = ENTITY_ID_KEY;
     entity_id_kv.value = StringRef(entity_id_str);
     
-    position_str = to_string(static_cast<int>(tilt * 100));
+    position_str = to_string(static_cast<int>(std::lround(tilt * 100)));
     auto &tilt_kv = req.data.emplace_back();
     tilt_kv.key = TILT_KEY;
     tilt_kv.value = StringRef(position_str);
@@ -161,11 +193,68 @@ void HomeassistantCover::control(const cover::CoverCall &call) {
   
   ESP_LOGD(TAG, "Calling service: %s", service_str.c_str());
   api::global_api_server->send_homeassistant_action(req);
+  if (call.get_stop()) {
+    this->latency_.start(LATENCY_OPERATION, cover::COVER_OPERATION_IDLE);
+  } else if (call.get_position().has_value()) {
+    this->expect_position_(std::lround(call.get_position().value() * 100) / 100.0f);
+  } else {
+    this->latency_.start(LATENCY_TILT, std::lround(call.get_tilt().value() * 100) / 100.0f, POSITION_TOLERANCE);
+  }
+}
+
+void HomeassistantCover::expect_position_(float target) {
+  cover::CoverOperation towards =
+      target > this->position ? cover::COVER_OPERATION_OPENING : cover::COVER_OPERATION_CLOSING;
+  this->latency_.start(LATENCY_OPERATION, towards);
+  this->latency_.also_expect(LATENCY_POSITION, target, POSITION_TOLERANCE);
+}
+
+void HomeassistantCover::call_group_service(const char *service,
+                                            const std::vector<HomeassistantCover *> &covers) {
+  static constexpr auto ENTITY_ID_KEY = StringRef::from_lit("entity_id");
+  
+  if (covers.empty()) {
+    return;
+  }
+  
+  // HA splits a comma separated entity_id into a list
+  size_t length = 0;
+  for (auto *cover : covers) {
+    length += strlen(cover->entity_id_) + 1;
+  }
+  std::string entity_ids;
+  entity_ids.reserve(length);
+  for (auto *cover : covers) {
+    if (!entity_ids.empty()) {
+      entity_ids += ',';
+    }
+    entity_ids += cover->entity_id_;
+  }
+  
+  api::HomeassistantActionRequest req;
+  req.service = StringRef(service);
+  req.data.init(1);
+  auto &entity_id_kv = req.data.emplace_back();
+  entity_id_kv.key = ENTITY_ID_KEY;
+  entity_id_kv.value = StringRef(entity_ids);
+  
+  ESP_LOGD(TAG, "Calling service: %s for %u covers", service, (unsigned) covers.size());
+  api::global_api_server->send_homeassistant_action(req);
+  for (auto *member : covers) {
+    if (strcmp(service, "cover.stop_cover") == 0) {
+      member->latency_.start(LATENCY_OPERATION, cover::COVER_OPERATION_IDLE);
+    } else {
+      member->expect_position_(strcmp(service, "cover.open_cover") == 0 ? cover::COVER_OPEN : cover::COVER_CLOSED);
+    }
+  }
 }
 
 void HomeassistantCover::dump_config() {
   ESP_LOGCONFIG(TAG, "HomeAssistant Cover '%s':", this->get_name().c_str());
   ESP_LOGCONFIG(TAG, "  Entity ID: %s", this->entity_id_);
+  ESP_LOGCONFIG(TAG, "  Snapshot Interval: %u ms (%u writes)", this->snapshot_.get_min_interval(),
+                this->snapshot_.get_writes());
+  this->latency_.dump_config(TAG);
 }
 
 }  // namespace homeassistant_addon
@@ -4,26 +4,57 @@
 #include "esphome/core/string_ref.h"
 #include "esphome/components/cover/cover.h"
 #include "esphome/components/api/api_server.h"
+#include "../latency_tracker.h"
+#include "../state_snapshot.h"
+#include <vector>
 
 namespace esphome {
 namespace homeassistant_addon {
 
+struct CoverSnapshot {
+  static constexpr uint32_t TYPE = 0x43565231;  // "CVR1"
+  float position;
+  float tilt;
+  uint8_t supports_position;
+  uint8_t supports_tilt;
+} __attribute__((packed));
+
 class HomeassistantCover : public cover::Cover, public Component {
  public:
   void setup() override;
   void dump_config() override;
-  float get_setup_priority() const override { return setup_priority::AFTER_CONNECTION; }
+  // Before WiFi and the dial: the snapshot is shown from the first frame (see StateSnapshot)
+  float get_setup_priority() const override { return setup_priority::DATA; }
   
   void set_entity_id(const char *entity_id) { entity_id_ = entity_id; }
   const char *get_entity_id() const { return entity_id_; }
+  // Last state saved at most this often and restored at boot, 0 = not persisted
+  void set_snapshot_interval(uint32_t interval_ms) { this->snapshot_.set_min_interval(interval_ms); }
+  // Restored from the snapshot, HA has not confirmed it yet
+  bool is_stale() const { return this->stale_; }
   
   cover::CoverTraits get_traits() override;
+  
+  LatencyTracker &get_latency_tracker() { return this->latency_; }
+  
+  // Send a single cover.<action> call for several covers at once
+  // (entity_id is passed as a comma separated list)
+  static void call_group_service(const char *service, const std::vector<HomeassistantCover *> &covers);
 
  protected:
   void control(const cover::CoverCall &call) override;
   
+  // Fields a command's latency is confirmed on
+  enum LatencyField : uint8_t { LATENCY_OPERATION, LATENCY_POSITION, LATENCY_TILT };
+  // HA reports whole percents
+  static constexpr float POSITION_TOLERANCE = 0.005f;
+
   void on_state_received(StringRef state);
   void on_position_received(StringRef position_str);
+  // A move to target is confirmed by the cover reported moving that way, or already there
+  void expect_position_(float target);
+  // Publish what HA sent, and keep it for the next boot
+  void publish_update_();
   
   const char *entity_id_{nullptr};
   
@@ -31,6 +62,10 @@ class HomeassistantCover : public cover::Cover, public Component {
   bool supports_position_{false};
   bool supports_tilt_{false};
   bool supports_stop_{true};
+  bool stale_{false};
+  
+  LatencyTracker latency_;
+  StateSnapshot<CoverSnapshot> snapshot_{this, "snapshot"};
 };
 
 }  // namespace homeassistant_addon
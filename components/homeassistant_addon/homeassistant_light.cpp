@@ -0,0 +1,188 @@
+#include "homeassistant_light.h"
+#include "esphome/core/log.h"
+#include "esphome/components/api/api_server.h"
+
+namespace esphome {
+namespace homeassistant_addon {
+
+static const char *const TAG = "homeassistant_addon.light";
+
+static bool is_missing(const std::string &state) {
+  return state.empty() || state == "None" || state == "unknown" || state == "unavailable";
+}
+
+void HomeassistantLight::setup() {
+  LightSnapshot snapshot;
+  if (this->snapshot_.restore(this->entity_id_, &snapshot)) {
+    this->on_ = snapshot.on != 0;
+    this->brightness_ = snapshot.brightness;
+    this->color_temp_kelvin_ = snapshot.color_temp_kelvin;
+    this->min_color_temp_kelvin_ = snapshot.min_color_temp_kelvin;
+    this->max_color_temp_kelvin_ = snapshot.max_color_temp_kelvin;
+    this->stale_ = true;
+    ESP_LOGD(TAG, "'%s' restored: %s, brightness %.2f", this->entity_id_, ONOFF(this->on_), this->brightness_);
+    this->state_callback_.call();
+  }
+
+  // Subscribe to state (on/off)
+  api::global_api_server->subscribe_home_assistant_state(
+      this->entity_id_, nullopt,
+      [this](StringRef state) {
+        std::string state_str = state.str();
+        ESP_LOGD(TAG, "'%s' state: %s", this->entity_id_, state_str.c_str());
+        bool new_on = state_str == "on";
+        bool changed = new_on != this->on_;
+        this->on_ = new_on;
+        this->latency_.confirm(LATENCY_ON, new_on);
+        this->on_update_(changed);
+      });
+
+  // Subscribe to brightness (0-255, None when off)
+  api::global_api_server->subscribe_home_assistant_state(
+      this->entity_id_, std::string("brightness"),
+      [this](StringRef state) {
+        std::string state_str = state.str();
+        float new_brightness = 0.0f;
+        if (!is_missing(state_str)) {
+          auto val = parse_number<float>(state_str);
+          if (!val.has_value()) return;
+          new_brightness = val.value() / 255.0f;
+        }
+        ESP_LOGD(TAG, "'%s' brightness: %.2f", this->entity_id_, new_brightness);
+        bool changed = std::abs(new_brightness - this->brightness_) > 0.001f;
+        if (changed) {
+          this->brightness_ = new_brightness;
+        }
+        this->latency_.confirm(LATENCY_BRIGHTNESS, new_brightness);
+        this->on_update_(changed);
+      });
+
+  // Subscribe to color temperature and its range (only reported by lights that support it)
+  api::global_api_server->subscribe_home_assistant_state(
+      this->entity_id_, std::string("color_temp_kelvin"),
+      [this](StringRef state) {
+        std::string state_str = state.str();
+        if (is_missing(state_str)) return;
+        auto val = parse_number<float>(state_str);
+        if (!val.has_value()) return;
+        bool changed = val.value() != this->color_temp_kelvin_;
+        if (changed) {
+          ESP_LOGD(TAG, "'%s' color temp: %.0fK", this->entity_id_, val.value());
+          this->color_temp_kelvin_ = val.value();
+        }
+        this->latency_.confirm(LATENCY_COLOR_TEMP, val.value());
+        this->on_update_(changed);
+      });
+
+  api::global_api_server->subscribe_home_assistant_state(
+      this->entity_id_, std::string("min_color_temp_kelvin"),
+      [this](StringRef state) {
+        auto val = parse_number<float>(state.str());
+        if (val.has_value()) {
+          bool changed = val.value() != this->min_color_temp_kelvin_;
+          this->min_color_temp_kelvin_ = val.value();
+          this->on_update_(changed);
+        }
+      });
+
+  api::global_api_server->subscribe_home_assistant_state(
+      this->entity_id_, std::string("max_color_temp_kelvin"),
+      [this](StringRef state) {
+        auto val = parse_number<float>(state.str());
+        if (val.has_value()) {
+          bool changed = val.value() != this->max_color_temp_kelvin_;
+          this->max_color_temp_kelvin_ = val.value();
+          this->on_update_(changed);
+        }
+      });
+}
+
+void HomeassistantLight::on_update_(bool changed) {
+  // The first update confirms or replaces the restored state
+  if (this->stale_) {
+    this->stale_ = false;
+    changed = true;
+  }
+  if (!changed) return;
+
+  LightSnapshot snapshot;
+  snapshot.on = this->on_;
+  snapshot.brightness = this->brightness_;
+  snapshot.color_temp_kelvin = this->color_temp_kelvin_;
+  snapshot.min_color_temp_kelvin = this->min_color_temp_kelvin_;
+  snapshot.max_color_temp_kelvin = this->max_color_temp_kelvin_;
+  this->snapshot_.update(snapshot);
+  this->state_callback_.call();
+}
+
+void HomeassistantLight::dump_config() {
+  ESP_LOGCONFIG(TAG, "Home Assistant Light:");
+  ESP_LOGCONFIG(TAG, "  Entity ID: %s", this->entity_id_);
+  ESP_LOGCONFIG(TAG, "  Stream Interval: %u ms", this->brightness_stream_.get_min_interval());
+  ESP_LOGCONFIG(TAG, "  Snapshot Interval: %u ms (%u writes)", this->snapshot_.get_min_interval(),
+                this->snapshot_.get_writes());
+  this->latency_.dump_config(TAG);
+}
+
+void HomeassistantLight::send_command_(const char *service, const char *data_key, const std::string &data_value) {
+  static constexpr auto ENTITY_ID_KEY = StringRef::from_lit("entity_id");
+
+  api::HomeassistantActionRequest req;
+  std::string entity_id_str = this->entity_id_;
+
+  req.service = StringRef(service);
+  req.data.init(data_key != nullptr ? 2 : 1);
+  auto &entity_id_kv = req.data.emplace_back();
+  entity_id_kv.key = ENTITY_ID_KEY;
+  entity_id_kv.value = StringRef(entity_id_str);
+
+  if (data_key != nullptr) {
+    auto &data_kv = req.data.emplace_back();
+    data_kv.key = StringRef(data_key);
+    data_kv.value = StringRef(data_value);
+    ESP_LOGD(TAG, "Calling %s on %s with %s=%s", service, this->entity_id_, data_key, data_value.c_str());
+  } else {
+    ESP_LOGD(TAG, "Calling %s on %s", service, this->entity_id_);
+  }
+  api::global_api_server->send_homeassistant_action(req);
+}
+
+void HomeassistantLight::send_brightness_(float brightness) {
+  if (brightness <= 0.0f) {
+    this->turn_off();
+    return;
+  }
+  if (brightness > 1.0f) brightness = 1.0f;
+  int level = static_cast<int>(brightness * 255.0f + 0.5f);
+  this->send_command_("light.turn_on", "brightness", to_string(level));
+  // Some lights keep fewer levels than 0-255
+  this->latency_.start(LATENCY_BRIGHTNESS, level / 255.0f, 1.5f / 255.0f);
+}
+
+void HomeassistantLight::send_color_temp_(float kelvin) {
+  if (this->supports_color_temp()) {
+    kelvin = clamp(kelvin, this->min_color_temp_kelvin_, this->max_color_temp_kelvin_);
+  }
+  int sent = static_cast<int>(kelvin);
+  this->send_command_("light.turn_on", "color_temp_kelvin", to_string(sent));
+  // HA may keep the temperature in mireds: a round trip moves it by a few kelvin
+  this->latency_.start(LATENCY_COLOR_TEMP, sent, sent * 0.01f);
+}
+
+void HomeassistantLight::turn_on() {
+  this->send_command_("light.turn_on", nullptr, "");
+  this->latency_.start(LATENCY_ON, 1.0f);
+}
+
+void HomeassistantLight::turn_off() {
+  this->send_command_("light.turn_off", nullptr, "");
+  this->latency_.start(LATENCY_ON, 0.0f);
+}
+
+void HomeassistantLight::toggle() {
+  this->send_command_("light.toggle", nullptr, "");
+  this->latency_.start(LATENCY_ON, !this->on_);
+}
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
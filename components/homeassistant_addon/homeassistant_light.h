@@ -0,0 +1,104 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/string_ref.h"
+#include "latency_tracker.h"
+#include "setpoint_stream.h"
+#include "state_snapshot.h"
+#include <string>
+#include <functional>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+struct LightSnapshot {
+  static constexpr uint32_t TYPE = 0x4C474831;  // "LGH1"
+  uint8_t on;
+  float brightness;
+  float color_temp_kelvin;
+  float min_color_temp_kelvin;
+  float max_color_temp_kelvin;
+} __attribute__((packed));
+
+/**
+ * @brief Mirrors a Home Assistant light (on/off, brightness, colour temperature)
+ *
+ * Brightness and colour temperature can be streamed while the encoder moves:
+ * intermediate values are sent at most at the configured rate (latest wins),
+ * so the lamp follows the dial live without flooding the HA API.
+ */
+class HomeassistantLight : public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  // Before WiFi and the dial: the snapshot is shown from the first frame (see StateSnapshot)
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void set_entity_id(const char *entity_id) { this->entity_id_ = entity_id; }
+  void set_stream_interval(uint32_t interval_ms) {
+    this->brightness_stream_.set_min_interval(interval_ms);
+    this->color_temp_stream_.set_min_interval(interval_ms);
+  }
+  // Last state saved at most this often and restored at boot, 0 = not persisted
+  void set_snapshot_interval(uint32_t interval_ms) { this->snapshot_.set_min_interval(interval_ms); }
+
+  // Getters
+  const char *get_entity_id() const { return this->entity_id_; }
+  // Restored from the snapshot, HA has not confirmed it yet
+  bool is_stale() const { return this->stale_; }
+  bool is_on() const { return this->on_; }
+  float get_brightness() const { return this->brightness_; }  // 0.0 - 1.0
+  bool supports_color_temp() const { return this->max_color_temp_kelvin_ > this->min_color_temp_kelvin_; }
+  float get_color_temp_kelvin() const { return this->color_temp_kelvin_; }
+  float get_min_color_temp_kelvin() const { return this->min_color_temp_kelvin_; }
+  float get_max_color_temp_kelvin() const { return this->max_color_temp_kelvin_; }
+
+  // Control methods
+  void turn_on();
+  void turn_off();
+  void toggle();
+  // Streaming setpoints (rate limited) and final commits (sent immediately)
+  void stream_brightness(float brightness) { this->brightness_stream_.stream(brightness); }
+  void set_brightness(float brightness) { this->brightness_stream_.commit(brightness); }
+  void stream_color_temp_kelvin(float kelvin) { this->color_temp_stream_.stream(kelvin); }
+  void set_color_temp_kelvin(float kelvin) { this->color_temp_stream_.commit(kelvin); }
+
+  // Callback for state changes
+  void add_on_state_callback(std::function<void()> &&callback) {
+    this->state_callback_.add(std::move(callback));
+  }
+
+  LatencyTracker &get_latency_tracker() { return this->latency_; }
+
+ protected:
+  // Fields a command's latency is confirmed on
+  enum LatencyField : uint8_t { LATENCY_ON, LATENCY_BRIGHTNESS, LATENCY_COLOR_TEMP };
+
+  void send_command_(const char *service, const char *data_key, const std::string &data_value);
+  void send_brightness_(float brightness);
+  void send_color_temp_(float kelvin);
+  // A value arrived from HA (changed or not)
+  void on_update_(bool changed);
+
+  const char *entity_id_{nullptr};
+
+  // State
+  bool on_{false};
+  float brightness_{0.0f};
+  float color_temp_kelvin_{0.0f};
+  float min_color_temp_kelvin_{0.0f};
+  float max_color_temp_kelvin_{0.0f};
+  bool stale_{false};
+
+  LatencyTracker latency_;
+  StateSnapshot<LightSnapshot> snapshot_{this, "snapshot"};
+
+  SetpointStream brightness_stream_{this, "brightness", [this](float value) { this->send_brightness_(value); }};
+  SetpointStream color_temp_stream_{this, "color_temp", [this](float value) { this->send_color_temp_(value); }};
+
+  CallbackManager<void()> state_callback_;
+};
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
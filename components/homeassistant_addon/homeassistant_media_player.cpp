@@ -1,6 +1,9 @@
 #include "homeassistant_media_player.h"
+#include "packed_payload.h"
 #include "esphome/core/log.h"
 #include "esphome/components/api/api_server.h"
+#include <algorithm>
+#include <cstring>
 
 namespace esphome {
 namespace homeassistant_addon {
@@ -8,130 +11,328 @@ namespace homeassistant_addon {
 static const char *const TAG = "homeassistant_addon.media_player";
 
 void HomeassistantMediaPlayer::setup() {
+  this->restore_snapshot_();
+
+  if (this->packed_entity_id_ != nullptr) {
+    // Packed mode: one template sensor attribute carries everything, one message per change
+    api::global_api_server->subscribe_home_assistant_state(
+        this->packed_entity_id_, std::string(this->packed_attribute_),
+        [this](StringRef payload) { this->on_packed_payload_(payload); });
+    return;
+  }
+
   // Subscribe to state
   api::global_api_server->subscribe_home_assistant_state(
       this->entity_id_, nullopt,
       [this](StringRef state) {
-        std::string state_str = state.str();
-        ESP_LOGD(TAG, "'%s' state: %s", this->entity_id_, state_str.c_str());
-        
-        MediaPlayerState new_state = MediaPlayerState::UNKNOWN;
-        if (state_str == "off") {
-          new_state = MediaPlayerState::OFF;
-        } else if (state_str == "on") {
-          new_state = MediaPlayerState::ON;
-        } else if (state_str == "idle") {
-          new_state = MediaPlayerState::IDLE;
-        } else if (state_str == "playing") {
-          new_state = MediaPlayerState::PLAYING;
-        } else if (state_str == "paused") {
-          new_state = MediaPlayerState::PAUSED;
-        } else if (state_str == "standby") {
-          new_state = MediaPlayerState::STANDBY;
-        } else if (state_str == "buffering") {
-          new_state = MediaPlayerState::BUFFERING;
-        }
-        
-        if (new_state != this->state_) {
-          this->state_ = new_state;
-          this->state_callback_.call();
-        }
+        this->on_update_(this->apply_state_(state), Interest::BACKGROUND);
       });
 
   // Subscribe to volume_level
   api::global_api_server->subscribe_home_assistant_state(
       this->entity_id_, std::string("volume_level"),
       [this](StringRef state) {
-        std::string state_str = state.str();
-        if (state_str.empty() || state_str == "None" || state_str == "unknown" || state_str == "unavailable") {
-          return;
-        }
-        auto val = parse_number<float>(state_str);
-        if (val.has_value()) {
-          float new_vol = val.value();
-          ESP_LOGD(TAG, "'%s' volume: %.2f", this->entity_id_, new_vol);
-          if (std::abs(new_vol - this->volume_) > 0.001f) {
-            this->volume_ = new_vol;
-            this->state_callback_.call();
-          }
-        }
+        this->on_update_(this->apply_volume_(state), Interest::BACKGROUND);
       });
 
   // Subscribe to is_volume_muted
   api::global_api_server->subscribe_home_assistant_state(
       this->entity_id_, std::string("is_volume_muted"),
       [this](StringRef state) {
-        std::string state_str = state.str();
-        bool new_muted = (state_str == "True" || state_str == "true" || state_str == "1");
-        ESP_LOGD(TAG, "'%s' muted: %s", this->entity_id_, state_str.c_str());
-        if (new_muted != this->muted_) {
-          this->muted_ = new_muted;
-          this->state_callback_.call();
-        }
+        this->on_update_(this->apply_muted_(state), Interest::BACKGROUND);
       });
 
-  // Subscribe to media_title
+  // Subscribe to source_list (can be large, only re-parsed when it changes)
   api::global_api_server->subscribe_home_assistant_state(
-      this->entity_id_, std::string("media_title"),
+      this->entity_id_, std::string("source_list"),
       [this](StringRef state) {
-        std::string state_str = state.str();
-        if (state_str == "None" || state_str == "unknown" || state_str == "unavailable") {
-          if (!this->media_title_.empty()) {
-            this->media_title_ = "";
-            this->state_callback_.call();
-          }
-          return;
-        }
-        ESP_LOGD(TAG, "'%s' title: %s", this->entity_id_, state_str.c_str());
-        if (state_str != this->media_title_) {
-          this->media_title_ = state_str;
-          this->state_callback_.call();
-        }
+        this->on_update_(this->apply_source_list_(state), Interest::VISIBLE);
       });
 
-  // Subscribe to media_artist
-  api::global_api_server->subscribe_home_assistant_state(
-      this->entity_id_, std::string("media_artist"),
-      [this](StringRef state) {
-        std::string state_str = state.str();
-        if (state_str == "None" || state_str == "unknown" || state_str == "unavailable") {
-          if (!this->media_artist_.empty()) {
-            this->media_artist_ = "";
-            this->state_callback_.call();
-          }
-          return;
-        }
-        ESP_LOGD(TAG, "'%s' artist: %s", this->entity_id_, state_str.c_str());
-        if (state_str != this->media_artist_) {
-          this->media_artist_ = state_str;
-          this->state_callback_.call();
-        }
-      });
+  // Subscribe to the metadata (title, artist, source and entity_picture, the
+  // album art URL relative to the HA base URL), only parsed while visible
+  for (DeferredAttribute *attribute :
+       {&this->media_title_, &this->media_artist_, &this->source_, &this->entity_picture_}) {
+    api::global_api_server->subscribe_home_assistant_state(
+        this->entity_id_, std::string(attribute->name),
+        [this, attribute](StringRef state) {
+          this->on_update_(this->on_metadata_(*attribute, state), Interest::VISIBLE);
+        });
+  }
+}
 
-  // Subscribe to source
-  api::global_api_server->subscribe_home_assistant_state(
-      this->entity_id_, std::string("source"),
-      [this](StringRef state) {
-        std::string state_str = state.str();
-        if (state_str == "None" || state_str == "unknown" || state_str == "unavailable") {
-          if (!this->source_.empty()) {
-            this->source_ = "";
-            this->state_callback_.call();
-          }
-          return;
-        }
-        ESP_LOGD(TAG, "'%s' source: %s", this->entity_id_, state_str.c_str());
-        if (state_str != this->source_) {
-          this->source_ = state_str;
-          this->state_callback_.call();
-        }
-      });
+void HomeassistantMediaPlayer::on_packed_payload_(StringRef payload) {
+  // state|volume_level|is_volume_muted|media_title|media_artist|source|entity_picture|source_list
+  StringRef fields[8];
+  if (split_packed_payload(payload, fields) < 3) {
+    ESP_LOGW(TAG, "'%s' packed payload is incomplete", this->packed_entity_id_);
+    return;
+  }
+
+  bool core_changed = this->apply_state_(fields[0]);
+  core_changed |= this->apply_volume_(fields[1]);
+  core_changed |= this->apply_muted_(fields[2]);
+
+  bool metadata_changed = this->on_metadata_(this->media_title_, fields[3]);
+  metadata_changed |= this->on_metadata_(this->media_artist_, fields[4]);
+  metadata_changed |= this->on_metadata_(this->source_, fields[5]);
+  metadata_changed |= this->on_metadata_(this->entity_picture_, fields[6]);
+  metadata_changed |= this->apply_source_list_(fields[7]);
+
+  // One notification for the whole payload
+  this->on_update_(metadata_changed || core_changed, metadata_changed ? Interest::VISIBLE : Interest::BACKGROUND);
+}
+
+void HomeassistantMediaPlayer::on_update_(bool changed, Interest needed) {
+  // The first update confirms or replaces the restored state, everyone hears about it
+  if (this->stale_) {
+    this->stale_ = false;
+    changed = true;
+    needed = Interest::BACKGROUND;
+  }
+  if (!changed) return;
+  this->save_snapshot_();
+  this->notify_(needed);
+}
+
+// Copy at most size - 1 bytes, without cutting a multi-byte character
+static void copy_snapshot_text(char *dest, size_t size, const InlineStringBase &src) {
+  size_t len = std::min(src.size(), size - 1);
+  while (len > 0 && len < src.size() && (static_cast<uint8_t>(src.c_str()[len]) & 0xC0) == 0x80) {
+    len--;
+  }
+  memcpy(dest, src.c_str(), len);
+  memset(dest + len, 0, size - len);
+}
+
+void HomeassistantMediaPlayer::restore_snapshot_() {
+  MediaPlayerSnapshot snapshot;
+  if (!this->snapshot_.restore(this->entity_id_, &snapshot)) return;
+  this->state_ = static_cast<MediaPlayerState>(snapshot.state);
+  this->volume_ = snapshot.volume;
+  this->muted_ = snapshot.muted != 0;
+  this->media_title_.value.assign(snapshot.media_title, strnlen(snapshot.media_title, sizeof(snapshot.media_title)));
+  this->media_artist_.value.assign(snapshot.media_artist,
+                                   strnlen(snapshot.media_artist, sizeof(snapshot.media_artist)));
+  this->stale_ = true;
+  ESP_LOGD(TAG, "'%s' restored: state %u, volume %.2f", this->entity_id_, (unsigned) snapshot.state, this->volume_);
+  this->notify_(Interest::BACKGROUND);
+}
+
+void HomeassistantMediaPlayer::save_snapshot_() {
+  MediaPlayerSnapshot snapshot;
+  snapshot.state = static_cast<uint8_t>(this->state_);
+  snapshot.volume = this->volume_;
+  snapshot.muted = this->muted_;
+  copy_snapshot_text(snapshot.media_title, sizeof(snapshot.media_title), this->media_title_.value);
+  copy_snapshot_text(snapshot.media_artist, sizeof(snapshot.media_artist), this->media_artist_.value);
+  this->snapshot_.update(snapshot);
+}
+
+bool HomeassistantMediaPlayer::apply_state_(StringRef state) {
+  ESP_LOGD(TAG, "'%s' state: %.*s", this->entity_id_, (int) state.size(), state.c_str());
+
+  MediaPlayerState new_state = MediaPlayerState::UNKNOWN;
+  if (state == "off") {
+    new_state = MediaPlayerState::OFF;
+  } else if (state == "on") {
+    new_state = MediaPlayerState::ON;
+  } else if (state == "idle") {
+    new_state = MediaPlayerState::IDLE;
+  } else if (state == "playing") {
+    new_state = MediaPlayerState::PLAYING;
+  } else if (state == "paused") {
+    new_state = MediaPlayerState::PAUSED;
+  } else if (state == "standby") {
+    new_state = MediaPlayerState::STANDBY;
+  } else if (state == "buffering") {
+    new_state = MediaPlayerState::BUFFERING;
+  }
+
+  if (new_state == this->state_) {
+    return false;
+  }
+  this->state_ = new_state;
+  this->latency_.confirm(LATENCY_STATE, (float) new_state);
+  this->latency_.confirm(LATENCY_POWER, new_state != MediaPlayerState::OFF);
+  return true;
+}
+
+bool HomeassistantMediaPlayer::apply_volume_(StringRef state) {
+  if (state.empty() || state == "None" || state == "unknown" || state == "unavailable") {
+    return false;
+  }
+  auto val = parse_number<float>(state.str());
+  if (!val.has_value()) {
+    return false;
+  }
+  float new_vol = val.value();
+  ESP_LOGD(TAG, "'%s' volume: %.2f", this->entity_id_, new_vol);
+  if (std::abs(new_vol - this->volume_) <= 0.001f) {
+    return false;
+  }
+  this->volume_ = new_vol;
+  this->latency_.confirm(LATENCY_VOLUME, new_vol);
+  return true;
+}
+
+bool HomeassistantMediaPlayer::apply_muted_(StringRef state) {
+  bool new_muted = (state == "True" || state == "true" || state == "1");
+  ESP_LOGD(TAG, "'%s' muted: %s", this->entity_id_, YESNO(new_muted));
+  if (new_muted == this->muted_) {
+    return false;
+  }
+  this->muted_ = new_muted;
+  this->latency_.confirm(LATENCY_MUTED, new_muted);
+  return true;
+}
+
+bool HomeassistantMediaPlayer::apply_source_list_(StringRef state) {
+  if (state.empty() || state == "None" || state == "unknown" || state == "unavailable") {
+    return false;
+  }
+  if (!this->source_list_.update(state)) {
+    return false;
+  }
+  ESP_LOGD(TAG, "'%s' source list: %u sources", this->entity_id_, (unsigned) this->source_list_.size());
+  if (this->source_list_.get_dropped() > 0) {
+    ESP_LOGW(TAG, "'%s' source list: %u sources dropped, over %u sources / %u bytes (source_list_items / source_list_bytes)",
+             this->entity_id_, (unsigned) this->source_list_.get_dropped(),
+             (unsigned) this->source_list_.get_max_items(), (unsigned) this->source_list_.get_max_bytes());
+  }
+  return true;
+}
+
+size_t HomeassistantMediaPlayer::register_consumer(Interest interest, std::function<void()> &&callback) {
+  this->consumers_.push_back(Consumer{interest, false, std::move(callback)});
+  return this->consumers_.size() - 1;
+}
+
+void HomeassistantMediaPlayer::set_interest(size_t consumer, Interest interest) {
+  if (consumer >= this->consumers_.size()) {
+    return;
+  }
+  Interest before = this->consumers_[consumer].interest;
+  this->consumers_[consumer].interest = interest;
+  if (interest <= before) {
+    return;
+  }
+
+  // Catch up on what was deferred (or not notified) while it was not looking;
+  // re-read metadata is notified when HA answers
+  if (interest == Interest::VISIBLE) {
+    this->reread_deferred_();
+  }
+  if (this->consumers_[consumer].missed) {
+    this->consumers_[consumer].missed = false;
+    this->consumers_[consumer].callback();
+  }
+}
+
+Interest HomeassistantMediaPlayer::get_interest_() const {
+  // Listeners without a declared interest get everything, as without consumers
+  if (this->consumers_.empty() || this->listeners_ > 0) {
+    return Interest::VISIBLE;
+  }
+  Interest interest = Interest::NONE;
+  for (const Consumer &consumer : this->consumers_) {
+    if (consumer.interest > interest) {
+      interest = consumer.interest;
+    }
+  }
+  return interest;
+}
+
+void HomeassistantMediaPlayer::notify_(Interest needed) {
+  this->state_callback_.call();
+  // A callback may change interests: index, not iterators
+  for (size_t i = 0; i < this->consumers_.size(); i++) {
+    if (this->consumers_[i].interest >= needed) {
+      this->consumers_[i].missed = false;
+      this->consumers_[i].callback();
+    } else {
+      this->consumers_[i].missed = true;
+    }
+  }
+}
+
+bool HomeassistantMediaPlayer::on_metadata_(DeferredAttribute &attribute, StringRef state) {
+  attribute.requested = false;
+  // A new title or source answers a command whether or not anyone looks at it
+  float sent = LatencyTracker::text_value(state);
+  if (sent != attribute.sent) {
+    attribute.sent = sent;
+    this->latency_.confirm(attribute.latency_field, sent);
+  }
+  if (this->get_interest_() < Interest::VISIBLE) {
+    // Nothing is kept: read again from HA when a consumer becomes visible
+    attribute.dirty = true;
+    return false;
+  }
+  attribute.dirty = false;
+  return this->apply_metadata_(attribute, state);
+}
+
+bool HomeassistantMediaPlayer::apply_metadata_(DeferredAttribute &attribute, StringRef state) {
+  if (state == "None" || state == "unknown" || state == "unavailable") {
+    if (attribute.value.empty()) {
+      return false;
+    }
+    attribute.value.clear();
+    return true;
+  }
+  if (attribute.value == state) {
+    return false;
+  }
+  ESP_LOGD(TAG, "'%s' %s: %.*s", this->entity_id_, attribute.name, (int) state.size(), state.c_str());
+  attribute.value.assign(state.c_str(), state.size());
+  return true;
+}
+
+void HomeassistantMediaPlayer::reread_deferred_() {
+  bool request_packed = false;
+  for (DeferredAttribute *attribute :
+       {&this->media_title_, &this->media_artist_, &this->source_, &this->entity_picture_}) {
+    if (!attribute->dirty || attribute->requested) {
+      continue;
+    }
+    attribute->requested = true;
+    if (this->packed_entity_id_ != nullptr) {
+      request_packed = true;
+      continue;
+    }
+    this->rereads_++;
+    api::global_api_server->get_home_assistant_state(
+        this->entity_id_, std::string(attribute->name),
+        [this, attribute](StringRef state) {
+          this->on_update_(this->on_metadata_(*attribute, state), Interest::VISIBLE);
+        });
+  }
+
+  // Packed mode: one payload carries every attribute
+  if (request_packed) {
+    this->rereads_++;
+    api::global_api_server->get_home_assistant_state(
+        this->packed_entity_id_, std::string(this->packed_attribute_),
+        [this](StringRef payload) { this->on_packed_payload_(payload); });
+  }
 }
 
 void HomeassistantMediaPlayer::dump_config() {
   ESP_LOGCONFIG(TAG, "Home Assistant Media Player:");
   ESP_LOGCONFIG(TAG, "  Entity ID: %s", this->entity_id_);
   ESP_LOGCONFIG(TAG, "  Volume Step: %.2f", this->volume_step_);
+  ESP_LOGCONFIG(TAG, "  Snapshot Interval: %u ms (%u writes)", this->snapshot_.get_min_interval(),
+                this->snapshot_.get_writes());
+  if (this->packed_entity_id_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Packed From: %s[%s]", this->packed_entity_id_, this->packed_attribute_);
+  }
+  ESP_LOGCONFIG(TAG, "  Source List: %u/%u sources, %u/%u bytes, %u dropped", (unsigned) this->source_list_.size(),
+                (unsigned) this->source_list_.get_max_items(), (unsigned) this->source_list_.get_used_bytes(),
+                (unsigned) this->source_list_.get_max_bytes(), (unsigned) this->source_list_.get_dropped());
+  ESP_LOGCONFIG(TAG, "  Consumers: %u, listeners: %u, metadata re-reads: %u", (unsigned) this->consumers_.size(),
+                (unsigned) this->listeners_, (unsigned) this->rereads_);
+  this->latency_.dump_config(TAG);
 }
 
 void HomeassistantMediaPlayer::send_command_(const std::string &service) {
@@ -186,56 +387,79 @@ void HomeassistantMediaPlayer::send_command_with_float_(const std::string &servi
 
 void HomeassistantMediaPlayer::play() {
   this->send_command_("media_play");
+  this->latency_.start(LATENCY_STATE, (float) MediaPlayerState::PLAYING);
 }
 
 void HomeassistantMediaPlayer::pause() {
   this->send_command_("media_pause");
+  this->latency_.start(LATENCY_STATE, (float) MediaPlayerState::PAUSED);
 }
 
 void HomeassistantMediaPlayer::play_pause() {
+  MediaPlayerState expected =
+      this->state_ == MediaPlayerState::PLAYING ? MediaPlayerState::PAUSED : MediaPlayerState::PLAYING;
   this->send_command_("media_play_pause");
+  this->latency_.start(LATENCY_STATE, (float) expected);
 }
 
 void HomeassistantMediaPlayer::stop() {
   this->send_command_("media_stop");
+  // Players report a stopped queue as idle or off
+  this->latency_.start(LATENCY_STATE, (float) MediaPlayerState::IDLE);
+  this->latency_.also_expect(LATENCY_STATE, (float) MediaPlayerState::OFF);
 }
 
 void HomeassistantMediaPlayer::next_track() {
   this->send_command_("media_next_track");
+  this->latency_.start_change(LATENCY_TITLE, this->media_title_.sent);
 }
 
 void HomeassistantMediaPlayer::previous_track() {
   this->send_command_("media_previous_track");
+  this->latency_.start_change(LATENCY_TITLE, this->media_title_.sent);
 }
 
 void HomeassistantMediaPlayer::volume_up() {
   this->send_command_("volume_up");
+  this->latency_.start_change(LATENCY_VOLUME, this->volume_);
 }
 
 void HomeassistantMediaPlayer::volume_down() {
   this->send_command_("volume_down");
+  this->latency_.start_change(LATENCY_VOLUME, this->volume_);
 }
 
 void HomeassistantMediaPlayer::set_volume(float volume) {
   if (volume < 0.0f) volume = 0.0f;
   if (volume > 1.0f) volume = 1.0f;
   this->send_command_with_float_("volume_set", "volume_level", volume);
+  // Players keep the volume in whole percents at best
+  this->latency_.start(LATENCY_VOLUME, volume, 0.01f);
+}
+
+void HomeassistantMediaPlayer::select_source(const std::string &source) {
+  this->send_command_with_data_("select_source", "source", source);
+  this->latency_.start(LATENCY_SOURCE, LatencyTracker::text_value(StringRef(source)));
 }
 
 void HomeassistantMediaPlayer::mute() {
   this->send_command_with_data_("volume_mute", "is_volume_muted", "true");
+  this->latency_.start(LATENCY_MUTED, 1.0f);
 }
 
 void HomeassistantMediaPlayer::unmute() {
   this->send_command_with_data_("volume_mute", "is_volume_muted", "false");
+  this->latency_.start(LATENCY_MUTED, 0.0f);
 }
 
 void HomeassistantMediaPlayer::turn_on() {
   this->send_command_("turn_on");
+  this->latency_.start(LATENCY_POWER, 1.0f);
 }
 
 void HomeassistantMediaPlayer::turn_off() {
   this->send_command_("turn_off");
+  this->latency_.start(LATENCY_POWER, 0.0f);
 }
 
 }  // namespace homeassistant_addon
@@ -1,10 +1,30 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/string_ref.h"
 #include "esphome/components/api/custom_api_device.h"
+#include "inline_string.h"
+#include "latency_tracker.h"
+#include "list_attribute.h"
+#include "state_snapshot.h"
 #include <string>
 #include <functional>
+#include <vector>
+
+// Capacity (bytes) of the mirrored metadata, set from YAML. Longer values are truncated.
+#ifndef HOMEASSISTANT_ADDON_MEDIA_TITLE_LENGTH
+#define HOMEASSISTANT_ADDON_MEDIA_TITLE_LENGTH 96
+#endif
+#ifndef HOMEASSISTANT_ADDON_MEDIA_ARTIST_LENGTH
+#define HOMEASSISTANT_ADDON_MEDIA_ARTIST_LENGTH 64
+#endif
+#ifndef HOMEASSISTANT_ADDON_MEDIA_SOURCE_LENGTH
+#define HOMEASSISTANT_ADDON_MEDIA_SOURCE_LENGTH 48
+#endif
+#ifndef HOMEASSISTANT_ADDON_MEDIA_PICTURE_LENGTH
+#define HOMEASSISTANT_ADDON_MEDIA_PICTURE_LENGTH 256
+#endif
 
 namespace esphome {
 namespace homeassistant_addon {
@@ -20,23 +40,70 @@ enum class MediaPlayerState : uint8_t {
   BUFFERING,
 };
 
+// Playback state and the start of the metadata, restored at boot
+struct MediaPlayerSnapshot {
+  static constexpr uint32_t TYPE = 0x4D504C31;  // "MPL1"
+  static constexpr size_t TEXT_LENGTH = 48;
+  uint8_t state;
+  float volume;
+  uint8_t muted;
+  char media_title[TEXT_LENGTH];
+  char media_artist[TEXT_LENGTH];
+} __attribute__((packed));
+
+/**
+ * How much a consumer (e.g. a dial_menu app) cares about the mirror's state.
+ *
+ * - VISIBLE: everything is parsed and notified as it arrives
+ * - BACKGROUND: playback state, volume and mute are notified, metadata is deferred
+ * - NONE: nothing is notified, metadata is deferred
+ *
+ * Deferred metadata (title, artist, source, picture) is dropped on arrival and
+ * only marked dirty; once a consumer becomes visible the dirty attributes are
+ * read again from Home Assistant. Callbacks added with add_on_state_callback()
+ * (e.g. YAML lambdas) count as visible consumers.
+ */
+enum class Interest : uint8_t {
+  NONE = 0,
+  BACKGROUND,
+  VISIBLE,
+};
+
 class HomeassistantMediaPlayer : public Component {
  public:
   void setup() override;
   void dump_config() override;
-  float get_setup_priority() const override { return setup_priority::AFTER_CONNECTION; }
+  // Before WiFi and the dial: the snapshot is shown from the first frame (see StateSnapshot)
+  float get_setup_priority() const override { return setup_priority::DATA; }
 
   void set_entity_id(const char *entity_id) { this->entity_id_ = entity_id; }
   void set_volume_step(float step) { this->volume_step_ = step; }
+  // Sources kept from source_list (items, bytes of text), the rest are dropped
+  void set_source_list_capacity(size_t max_items, size_t max_bytes) {
+    this->source_list_.set_capacity(max_items, max_bytes);
+  }
+  // Packed mode: read everything from one attribute of a template sensor
+  void set_packed_source(const char *entity_id, const char *attribute) {
+    this->packed_entity_id_ = entity_id;
+    this->packed_attribute_ = attribute;
+  }
+  // Last state saved at most this often and restored at boot, 0 = not persisted
+  void set_snapshot_interval(uint32_t interval_ms) { this->snapshot_.set_min_interval(interval_ms); }
 
   // Getters
   const char *get_entity_id() const { return this->entity_id_; }
+  // Restored from the snapshot, HA has not confirmed it yet
+  bool is_stale() const { return this->stale_; }
   MediaPlayerState get_state() const { return this->state_; }
   float get_volume() const { return this->volume_; }
   bool is_muted() const { return this->muted_; }
-  const std::string &get_media_title() const { return this->media_title_; }
-  const std::string &get_media_artist() const { return this->media_artist_; }
-  const std::string &get_source() const { return this->source_; }
+  const InlineStringBase &get_media_title() const { return this->media_title_.value; }
+  const InlineStringBase &get_media_artist() const { return this->media_artist_.value; }
+  const InlineStringBase &get_source() const { return this->source_.value; }
+  // Sources the player can switch to (source_list attribute)
+  const ListAttribute &get_source_list() const { return this->source_list_; }
+  // Relative picture URL as reported by HA (e.g. /api/media_player_proxy/...), empty when none
+  const InlineStringBase &get_entity_picture() const { return this->entity_picture_.value; }
   float get_volume_step() const { return this->volume_step_; }
 
   // Control methods
@@ -49,32 +116,104 @@ class HomeassistantMediaPlayer : public Component {
   void volume_up();
   void volume_down();
   void set_volume(float volume);
+  void select_source(const std::string &source);
   void mute();
   void unmute();
   void turn_on();
   void turn_off();
 
-  // Callback for state changes
+  // Callback for state changes, always notified: metadata is never deferred while one is set
   void add_on_state_callback(std::function<void()> &&callback) {
     this->state_callback_.add(std::move(callback));
+    this->listeners_++;
   }
 
+  LatencyTracker &get_latency_tracker() { return this->latency_; }
+
+  // A consumer whose callback only hears about what its interest covers; returns its handle.
+  // Without consumers or listeners everything is treated as visible.
+  size_t register_consumer(Interest interest, std::function<void()> &&callback);
+  void set_interest(size_t consumer, Interest interest);
+  // Deferred attributes read again from HA
+  uint32_t get_rereads() const { return this->rereads_; }
+
  protected:
+  // Fields a command's latency is confirmed on
+  enum LatencyField : uint8_t {
+    LATENCY_STATE,
+    LATENCY_POWER,
+    LATENCY_VOLUME,
+    LATENCY_MUTED,
+    LATENCY_TITLE,
+    LATENCY_SOURCE,
+    LATENCY_METADATA,
+  };
+  // Metadata attribute whose parsing is deferred while nobody is looking at it
+  struct DeferredAttribute {
+    const char *name;  // HA attribute name
+    InlineStringBase &value;
+    uint8_t latency_field;
+    bool dirty{false};      // Changed while hidden, value is out of date
+    bool requested{false};  // Re-read from HA in flight
+    // LatencyTracker::text_value() of what HA last sent, kept while hidden too
+    float sent{0.0f};
+  };
+  struct Consumer {
+    Interest interest;
+    bool missed;  // A change it was not notified about
+    std::function<void()> callback;
+  };
+
+  // Parsers, return true if the value changed
+  bool apply_state_(StringRef state);
+  bool apply_volume_(StringRef state);
+  bool apply_muted_(StringRef state);
+  bool apply_source_list_(StringRef state);
+  void on_packed_payload_(StringRef payload);
+
+  Interest get_interest_() const;
+  void notify_(Interest needed);
+  // A value arrived from HA (changed or not), consumers with at least this interest are notified
+  void on_update_(bool changed, Interest needed);
+  void restore_snapshot_();
+  void save_snapshot_();
+  bool on_metadata_(DeferredAttribute &attribute, StringRef state);
+  bool apply_metadata_(DeferredAttribute &attribute, StringRef state);
+  // Ask HA again for the attributes that changed while hidden
+  void reread_deferred_();
+
   void send_command_(const std::string &service);
   void send_command_with_data_(const std::string &service, const std::string &data_key, const std::string &data_value);
   void send_command_with_float_(const std::string &service, const std::string &data_key, float data_value);
 
   const char *entity_id_{nullptr};
   float volume_step_{0.05f};
+  const char *packed_entity_id_{nullptr};
+  const char *packed_attribute_{nullptr};
 
   // State
   MediaPlayerState state_{MediaPlayerState::UNKNOWN};
   float volume_{0.0f};
   bool muted_{false};
-  std::string media_title_;
-  std::string media_artist_;
-  std::string source_;
+  bool stale_{false};
+  // Fixed-capacity storage, updates never allocate
+  InlineString<HOMEASSISTANT_ADDON_MEDIA_TITLE_LENGTH> media_title_value_;
+  InlineString<HOMEASSISTANT_ADDON_MEDIA_ARTIST_LENGTH> media_artist_value_;
+  InlineString<HOMEASSISTANT_ADDON_MEDIA_SOURCE_LENGTH> source_value_;
+  InlineString<HOMEASSISTANT_ADDON_MEDIA_PICTURE_LENGTH> entity_picture_value_;
+  DeferredAttribute media_title_{"media_title", media_title_value_, LATENCY_TITLE};
+  DeferredAttribute media_artist_{"media_artist", media_artist_value_, LATENCY_METADATA};
+  DeferredAttribute source_{"source", source_value_, LATENCY_SOURCE};
+  DeferredAttribute entity_picture_{"entity_picture", entity_picture_value_, LATENCY_METADATA};
+  ListAttribute source_list_{32, 512};
+
+  std::vector<Consumer> consumers_;
+  // Callbacks added with add_on_state_callback()
+  size_t listeners_{0};
+  uint32_t rereads_{0};
 
+  LatencyTracker latency_;
+  StateSnapshot<MediaPlayerSnapshot> snapshot_{this, "snapshot"};
   CallbackManager<void()> state_callback_;
 };
 
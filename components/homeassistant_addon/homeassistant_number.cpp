@@ -0,0 +1,125 @@
+#include "homeassistant_number.h"
+#include "esphome/core/log.h"
+#include "esphome/components/api/api_server.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+static const char *const TAG = "homeassistant_addon.number";
+
+void HomeassistantNumber::setup() {
+  NumberSnapshot snapshot;
+  if (this->snapshot_.restore(this->entity_id_, &snapshot)) {
+    this->value_ = snapshot.value;
+    this->min_value_ = snapshot.min_value;
+    this->max_value_ = snapshot.max_value;
+    this->step_ = snapshot.step;
+    this->has_state_ = true;
+    this->stale_ = true;
+    ESP_LOGD(TAG, "'%s' restored: %.2f", this->entity_id_, this->value_);
+    this->state_callback_.call();
+  }
+
+  // Subscribe to the value (entity state)
+  api::global_api_server->subscribe_home_assistant_state(
+      this->entity_id_, nullopt,
+      [this](StringRef state) {
+        auto val = parse_number<float>(state.str());
+        if (!val.has_value()) {
+          ESP_LOGW(TAG, "'%s' state is not a number", this->entity_id_);
+          return;
+        }
+        ESP_LOGD(TAG, "'%s' value: %.2f", this->entity_id_, val.value());
+        bool changed = !this->has_state_ || val.value() != this->value_;
+        this->has_state_ = true;
+        this->value_ = val.value();
+        this->latency_.confirm(LATENCY_VALUE, val.value());
+        this->on_update_(changed);
+      });
+
+  // Range and step come from the entity attributes
+  this->subscribe_float_("min", &this->min_value_);
+  this->subscribe_float_("max", &this->max_value_);
+  this->subscribe_float_("step", &this->step_);
+}
+
+void HomeassistantNumber::subscribe_float_(const char *attribute, float *target) {
+  api::global_api_server->subscribe_home_assistant_state(
+      this->entity_id_, std::string(attribute),
+      [this, attribute, target](StringRef state) {
+        auto val = parse_number<float>(state.str());
+        if (!val.has_value()) return;
+        bool changed = val.value() != *target;
+        if (changed) {
+          ESP_LOGD(TAG, "'%s' %s: %.2f", this->entity_id_, attribute, val.value());
+          *target = val.value();
+        }
+        this->on_update_(changed);
+      });
+}
+
+void HomeassistantNumber::on_update_(bool changed) {
+  // The first update confirms or replaces the restored state
+  if (this->stale_) {
+    this->stale_ = false;
+    changed = true;
+  }
+  if (!changed) return;
+
+  NumberSnapshot snapshot;
+  snapshot.value = this->value_;
+  snapshot.min_value = this->min_value_;
+  snapshot.max_value = this->max_value_;
+  snapshot.step = this->step_;
+  this->snapshot_.update(snapshot);
+  this->state_callback_.call();
+}
+
+void HomeassistantNumber::dump_config() {
+  ESP_LOGCONFIG(TAG, "Home Assistant Number:");
+  ESP_LOGCONFIG(TAG, "  Entity ID: %s", this->entity_id_);
+  ESP_LOGCONFIG(TAG, "  Stream Interval: %u ms", this->value_stream_.get_min_interval());
+  ESP_LOGCONFIG(TAG, "  Snapshot Interval: %u ms (%u writes)", this->snapshot_.get_min_interval(),
+                this->snapshot_.get_writes());
+  this->latency_.dump_config(TAG);
+}
+
+void HomeassistantNumber::send_value_(float value) {
+  static constexpr auto ENTITY_ID_KEY = StringRef::from_lit("entity_id");
+  static constexpr auto VALUE_KEY = StringRef::from_lit("value");
+
+  value = clamp(value, this->min_value_, this->max_value_);
+
+  // input_number.* entities use input_number.set_value, number.* entities use number.set_value
+  const char *service = strncmp(this->entity_id_, "input_number.", 13) == 0 ? "input_number.set_value"
+                                                                             : "number.set_value";
+
+  api::HomeassistantActionRequest req;
+  std::string entity_id_str = this->entity_id_;
+  char value_buf[16];
+  snprintf(value_buf, sizeof(value_buf), "%g", value);
+  std::string value_str = value_buf;
+
+  req.service = StringRef(service);
+  req.data.init(2);
+  auto &entity_id_kv = req.data.emplace_back();
+  entity_id_kv.key = ENTITY_ID_KEY;
+  entity_id_kv.value = StringRef(entity_id_str);
+
+  auto &value_kv = req.data.emplace_back();
+  value_kv.key = VALUE_KEY;
+  value_kv.value = StringRef(value_str);
+
+  ESP_LOGD(TAG, "Calling %s on %s with value=%s", service, this->entity_id_, value_buf);
+  api::global_api_server->send_homeassistant_action(req);
+  // Sent with six significant digits, HA may round it to the step
+  float tolerance = std::max(this->step_ * 0.5f, 1e-4f * std::abs(value));
+  this->latency_.start(LATENCY_VALUE, strtof(value_buf, nullptr), tolerance);
+}
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
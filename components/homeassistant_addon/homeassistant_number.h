@@ -0,0 +1,91 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/string_ref.h"
+#include "latency_tracker.h"
+#include "setpoint_stream.h"
+#include "state_snapshot.h"
+#include <string>
+#include <functional>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+struct NumberSnapshot {
+  static constexpr uint32_t TYPE = 0x4E554D31;  // "NUM1"
+  float value;
+  float min_value;
+  float max_value;
+  float step;
+} __attribute__((packed));
+
+/**
+ * @brief Mirrors a Home Assistant input_number or number entity
+ *
+ * Value range and step are read from the entity attributes. Like the light
+ * mirror, values can be streamed (rate limited, latest wins) while the encoder
+ * moves and committed once it stops.
+ */
+class HomeassistantNumber : public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  // Before WiFi and the dial: the snapshot is shown from the first frame (see StateSnapshot)
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void set_entity_id(const char *entity_id) { this->entity_id_ = entity_id; }
+  void set_stream_interval(uint32_t interval_ms) { this->value_stream_.set_min_interval(interval_ms); }
+  // Last state saved at most this often and restored at boot, 0 = not persisted
+  void set_snapshot_interval(uint32_t interval_ms) { this->snapshot_.set_min_interval(interval_ms); }
+
+  // Getters
+  const char *get_entity_id() const { return this->entity_id_; }
+  bool has_state() const { return this->has_state_; }
+  // Restored from the snapshot, HA has not confirmed it yet
+  bool is_stale() const { return this->stale_; }
+  float get_value() const { return this->value_; }
+  float get_min_value() const { return this->min_value_; }
+  float get_max_value() const { return this->max_value_; }
+  float get_step() const { return this->step_; }
+
+  // Streaming setpoint (rate limited) and final commit (sent immediately)
+  void stream_value(float value) { this->value_stream_.stream(value); }
+  void set_value(float value) { this->value_stream_.commit(value); }
+
+  // Callback for state changes
+  void add_on_state_callback(std::function<void()> &&callback) {
+    this->state_callback_.add(std::move(callback));
+  }
+
+  LatencyTracker &get_latency_tracker() { return this->latency_; }
+
+ protected:
+  // Field a command's latency is confirmed on
+  enum LatencyField : uint8_t { LATENCY_VALUE };
+
+  void send_value_(float value);
+  void subscribe_float_(const char *attribute, float *target);
+  // A value arrived from HA (changed or not)
+  void on_update_(bool changed);
+
+  const char *entity_id_{nullptr};
+
+  // State
+  bool has_state_{false};
+  float value_{0.0f};
+  float min_value_{0.0f};
+  float max_value_{100.0f};
+  float step_{1.0f};
+  bool stale_{false};
+
+  LatencyTracker latency_;
+  StateSnapshot<NumberSnapshot> snapshot_{this, "snapshot"};
+
+  SetpointStream value_stream_{this, "value", [this](float value) { this->send_value_(value); }};
+
+  CallbackManager<void()> state_callback_;
+};
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
@@ -0,0 +1,39 @@
+#include "inline_string.h"
+#include <cstring>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+void InlineStringBase::clear() {
+  this->size_ = 0;
+  this->data_[0] = '\0';
+}
+
+size_t InlineStringBase::fit_length_(const char *str, size_t len) const {
+  if (len <= this->capacity_) {
+    return len;
+  }
+  // Back off to the start of the codepoint that would be cut (continuation bytes are 10xxxxxx)
+  len = this->capacity_;
+  while (len > 0 && (static_cast<uint8_t>(str[len]) & 0xC0) == 0x80) {
+    len--;
+  }
+  return len;
+}
+
+bool InlineStringBase::assign(const char *str, size_t len) {
+  bool fits = len <= this->capacity_;
+  len = this->fit_length_(str, len);
+  memmove(this->data_, str, len);
+  this->data_[len] = '\0';
+  this->size_ = len;
+  return fits;
+}
+
+bool InlineStringBase::operator==(StringRef other) const {
+  return this->size_ == this->fit_length_(other.c_str(), other.size()) &&
+         memcmp(this->data_, other.c_str(), this->size_) == 0;
+}
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
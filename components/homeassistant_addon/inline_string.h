@@ -0,0 +1,58 @@
+#pragma once
+
+#include "esphome/core/string_ref.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+/**
+ * @brief Fixed-capacity, null-terminated UTF-8 string stored in place
+ *
+ * Assigning never allocates: text longer than the capacity is truncated at a
+ * codepoint boundary (a multi-byte character is never cut in half).
+ * The storage lives in InlineString<N>, this base lets code handle strings of
+ * different capacities alike.
+ */
+class InlineStringBase {
+ public:
+  InlineStringBase(const InlineStringBase &) = delete;
+  InlineStringBase &operator=(const InlineStringBase &) = delete;
+
+  const char *c_str() const { return this->data_; }
+  size_t size() const { return this->size_; }
+  size_t capacity() const { return this->capacity_; }
+  bool empty() const { return this->size_ == 0; }
+  StringRef ref() const { return StringRef(this->data_, this->size_); }
+
+  void clear();
+  // Returns false if the text had to be truncated
+  bool assign(const char *str, size_t len);
+  bool assign(StringRef str) { return this->assign(str.c_str(), str.size()); }
+
+  // True if the string holds what assign(other) would store (truncation included)
+  bool operator==(StringRef other) const;
+  bool operator!=(StringRef other) const { return !(*this == other); }
+
+ protected:
+  InlineStringBase(char *data, size_t capacity) : data_(data), capacity_(capacity) { data[0] = '\0'; }
+
+  // Length of str once truncated to the capacity at a codepoint boundary
+  size_t fit_length_(const char *str, size_t len) const;
+
+  char *data_;
+  size_t capacity_;
+  size_t size_{0};
+};
+
+template<size_t N> class InlineString : public InlineStringBase {
+ public:
+  InlineString() : InlineStringBase(this->storage_, N) {}
+
+ protected:
+  char storage_[N + 1];
+};
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
@@ -0,0 +1,98 @@
+#include "latency_tracker.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+void LatencyTracker::start(uint8_t field, float value, float tolerance) {
+  // A new command restarts the measurement, the state update confirms the latest one
+  this->started_at_ = millis();
+  this->pending_ = true;
+  this->expected_[0] = Expected{field, false, value, tolerance};
+  this->expected_count_ = 1;
+}
+
+void LatencyTracker::start_change(uint8_t field, float value) {
+  this->start(field, value);
+  this->expected_[0].change = true;
+}
+
+void LatencyTracker::also_expect(uint8_t field, float value, float tolerance) {
+  if (!this->pending_ || this->expected_count_ >= MAX_EXPECTED) {
+    return;
+  }
+  this->expected_[this->expected_count_++] = Expected{field, false, value, tolerance};
+}
+
+float LatencyTracker::text_value(StringRef text) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < text.size(); i++) {
+    hash = (hash * 16777619UL) ^ (uint8_t) text.c_str()[i];
+  }
+  return (float) (hash & 0xFFFFFF);
+}
+
+void LatencyTracker::confirm(uint8_t field, float value) {
+  if (!this->pending_) {
+    return;
+  }
+  bool matched = false;
+  for (uint8_t i = 0; i < this->expected_count_ && !matched; i++) {
+    const Expected &expected = this->expected_[i];
+    bool equal = std::fabs(value - expected.value) <= expected.tolerance;
+    matched = expected.field == field && equal != expected.change;
+  }
+  if (!matched) {
+    this->unrelated_++;
+    return;
+  }
+  this->pending_ = false;
+
+  uint32_t latency = millis() - this->started_at_;
+  if (latency > TIMEOUT_MS) {
+    return;
+  }
+
+  this->samples_[this->next_] = latency;
+  this->next_ = (this->next_ + 1) % WINDOW;
+  if (this->count_ < WINDOW) {
+    this->count_++;
+  }
+  this->update_stats_();
+}
+
+void LatencyTracker::update_stats_() {
+  uint32_t sorted[WINDOW];
+  std::copy(this->samples_, this->samples_ + this->count_, sorted);
+  std::sort(sorted, sorted + this->count_);
+
+  this->p50_ = sorted[(this->count_ - 1) * 50 / 100];
+  this->p95_ = sorted[(this->count_ - 1) * 95 / 100];
+  this->max_ = sorted[this->count_ - 1];
+
+  if (this->p50_sensor_ != nullptr) {
+    this->p50_sensor_->publish_state(this->p50_);
+  }
+  if (this->p95_sensor_ != nullptr) {
+    this->p95_sensor_->publish_state(this->p95_);
+  }
+  if (this->max_sensor_ != nullptr) {
+    this->max_sensor_->publish_state(this->max_);
+  }
+}
+
+void LatencyTracker::dump_config(const char *tag) const {
+  if (this->count_ == 0) {
+    ESP_LOGCONFIG(tag, "  Command Latency: no samples yet (%u unrelated updates)", (unsigned) this->unrelated_);
+    return;
+  }
+  ESP_LOGCONFIG(tag, "  Command Latency (%u samples): p50=%u ms, p95=%u ms, max=%u ms, %u unrelated updates",
+                (unsigned) this->count_, (unsigned) this->p50_, (unsigned) this->p95_, (unsigned) this->max_,
+                (unsigned) this->unrelated_);
+}
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
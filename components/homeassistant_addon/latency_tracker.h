@@ -0,0 +1,84 @@
+#pragma once
+
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/string_ref.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+/**
+ * @brief Command round-trip latency of a mirrored entity
+ *
+ * start() is called when an action is sent to HA, with the field the action
+ * sets and the value HA should report back; the mirror calls confirm() with
+ * each field it receives. Only the update showing the expected value closes
+ * the measurement: a position report while the cover still moves or an
+ * unrelated attribute does not. Fields are numbered by each mirror. The last
+ * samples are kept to report p50/p95/max, optionally published to diagnostic
+ * sensors.
+ */
+class LatencyTracker {
+ public:
+  void set_p50_sensor(sensor::Sensor *sensor) { this->p50_sensor_ = sensor; }
+  void set_p95_sensor(sensor::Sensor *sensor) { this->p95_sensor_ = sensor; }
+  void set_max_sensor(sensor::Sensor *sensor) { this->max_sensor_ = sensor; }
+
+  // An action was sent to HA: field reported at value (± tolerance) confirms it
+  void start(uint8_t field, float value, float tolerance = 0.0f);
+  // An action was sent to HA: field reported at anything but value confirms it (next track, volume up)
+  void start_change(uint8_t field, float value);
+  // Another report that also confirms the pending action (a cover already at its target)
+  void also_expect(uint8_t field, float value, float tolerance = 0.0f);
+  // HA reported field at value
+  void confirm(uint8_t field, float value);
+
+  // Text fields are compared by a 24-bit hash, exact in a float
+  static float text_value(StringRef text);
+
+  bool is_pending() const { return this->pending_; }
+  size_t get_count() const { return this->count_; }
+  uint32_t get_p50() const { return this->p50_; }
+  uint32_t get_p95() const { return this->p95_; }
+  uint32_t get_max() const { return this->max_; }
+  // Reports received while a command was pending that were not its answer
+  uint32_t get_unrelated() const { return this->unrelated_; }
+
+  void dump_config(const char *tag) const;
+
+ protected:
+  struct Expected {
+    uint8_t field;
+    bool change;  // Any value but `value`
+    float value;
+    float tolerance;
+  };
+
+  void update_stats_();
+
+  static constexpr size_t WINDOW = 32;
+  static constexpr size_t MAX_EXPECTED = 2;
+  // Commands not confirmed within this time are dropped (entity unchanged or unavailable)
+  static constexpr uint32_t TIMEOUT_MS = 30000;
+
+  uint32_t samples_[WINDOW]{};
+  size_t count_{0};
+  size_t next_{0};
+  uint32_t started_at_{0};
+  bool pending_{false};
+  Expected expected_[MAX_EXPECTED]{};
+  uint8_t expected_count_{0};
+  uint32_t unrelated_{0};
+
+  uint32_t p50_{0};
+  uint32_t p95_{0};
+  uint32_t max_{0};
+
+  sensor::Sensor *p50_sensor_{nullptr};
+  sensor::Sensor *p95_sensor_{nullptr};
+  sensor::Sensor *max_sensor_{nullptr};
+};
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
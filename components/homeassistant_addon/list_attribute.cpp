@@ -0,0 +1,105 @@
+#include "list_attribute.h"
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+// FNV-1a, over the raw attribute on every update and over each item for the index
+static uint32_t hash_text(StringRef text) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < text.size(); i++) {
+    hash ^= static_cast<uint8_t>(text.c_str()[i]);
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+void ListAttribute::set_capacity(size_t max_items, size_t max_bytes) {
+  this->max_items_ = std::min(std::max(max_items, (size_t) 1), MAX_ITEMS);
+  this->max_bytes_ = std::min(std::max(max_bytes, (size_t) 1), MAX_BYTES);
+  size_t slots = 2;
+  while (slots < this->max_items_ * 2) {
+    slots <<= 1;
+  }
+  this->slot_mask_ = slots - 1;
+  // Allocated again, at the new size, by the next update
+  this->items_.reset();
+  this->buffer_.reset();
+  this->slots_.reset();
+  this->count_ = 0;
+  this->used_ = 0;
+  this->dropped_ = 0;
+}
+
+bool ListAttribute::update(StringRef text) {
+  uint32_t hash = hash_text(text);
+  if (this->items_ != nullptr && hash == this->hash_) {
+    return false;
+  }
+  this->hash_ = hash;
+
+  if (this->items_ == nullptr) {
+    this->items_.reset(new Item[this->max_items_]);
+    this->buffer_.reset(new char[this->max_bytes_]);
+    this->slots_.reset(new uint16_t[this->slot_mask_ + 1]);
+  }
+  memset(this->slots_.get(), 0, (this->slot_mask_ + 1) * sizeof(uint16_t));
+  this->count_ = 0;
+  this->used_ = 0;
+  this->dropped_ = 0;
+
+  for_each_list_item(text, [this](StringRef item) { this->add_(item); });
+  return true;
+}
+
+size_t ListAttribute::find_slot_(StringRef item, uint32_t hash) const {
+  size_t slot = hash & this->slot_mask_;
+  // At most half the slots are used, the probe always ends on an empty one
+  while (this->slots_[slot] != 0) {
+    const Item &entry = this->items_[this->slots_[slot] - 1];
+    if (entry.hash == hash && entry.length == item.size() &&
+        memcmp(this->buffer_.get() + entry.offset, item.c_str(), item.size()) == 0) {
+      break;
+    }
+    slot = (slot + 1) & this->slot_mask_;
+  }
+  return slot;
+}
+
+void ListAttribute::add_(StringRef item) {
+  if (item.empty()) {
+    return;
+  }
+  uint32_t hash = hash_text(item);
+  size_t slot = this->find_slot_(item, hash);
+  if (this->slots_[slot] != 0) {
+    return;
+  }
+  if (this->count_ >= this->max_items_ || this->used_ + item.size() > this->max_bytes_) {
+    this->dropped_++;
+    return;
+  }
+  memcpy(this->buffer_.get() + this->used_, item.c_str(), item.size());
+  this->items_[this->count_] = {hash, static_cast<uint16_t>(this->used_), static_cast<uint16_t>(item.size())};
+  this->slots_[slot] = static_cast<uint16_t>(++this->count_);
+  this->used_ += item.size();
+}
+
+StringRef ListAttribute::get(size_t index) const {
+  if (index >= this->count_) {
+    return StringRef();
+  }
+  const Item &item = this->items_[index];
+  return StringRef(this->buffer_.get() + item.offset, item.length);
+}
+
+int ListAttribute::index_of(StringRef item) const {
+  if (this->count_ == 0) {
+    return -1;
+  }
+  return static_cast<int>(this->slots_[this->find_slot_(item, hash_text(item))]) - 1;
+}
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "esphome/core/string_ref.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+/**
+ * @brief Walk the items of a HA list attribute without copying
+ *
+ * Accepts the Python repr HA sends ("['a', \"b's\"]"), JSON ('["a","b"]') and
+ * plain comma-separated text ("a, b"). Each item is passed to fn as a slice of
+ * text (quotes stripped, escapes left as-is). Returns the number of items.
+ */
+template<typename F> size_t for_each_list_item(StringRef text, F &&fn) {
+  const char *p = text.c_str();
+  const char *end = p + text.size();
+  size_t count = 0;
+  while (p < end) {
+    char c = *p;
+    if (c == '[' || c == ']' || c == ',' || c == ' ' || c == '\n' || c == '\t') {
+      p++;
+      continue;
+    }
+    if (c == '\'' || c == '"') {
+      // Quoted item, runs until the matching unescaped quote
+      const char *start = ++p;
+      while (p < end && *p != c) {
+        p += (*p == '\\' && p + 1 < end) ? 2 : 1;
+      }
+      fn(StringRef(start, p - start));
+      p++;
+    } else {
+      // Bare item, runs until the next separator
+      const char *start = p;
+      while (p < end && *p != ',' && *p != ']') {
+        p++;
+      }
+      const char *stop = p;
+      while (stop > start && stop[-1] == ' ') {
+        stop--;
+      }
+      fn(StringRef(start, stop - start));
+    }
+    count++;
+  }
+  return count;
+}
+
+/**
+ * @brief Bounded, reusable store for the items of a list attribute
+ *
+ * Items are interned (duplicates stored once) into one buffer allocated on the
+ * first update and reused afterwards. A hash index (open addressing, two slots
+ * per item) keeps the dedupe and index_of() constant time, so a list of a
+ * thousand sources parses in one pass. update() hashes the raw attribute first
+ * and does nothing when the list did not change. Items that don't fit in the
+ * capacity are dropped and counted; the owner logs them with its entity.
+ */
+class ListAttribute {
+ public:
+  // Item offsets and lengths are 16 bit
+  static constexpr size_t MAX_BYTES = UINT16_MAX;
+  static constexpr size_t MAX_ITEMS = 4096;
+
+  ListAttribute(size_t max_items, size_t max_bytes) { this->set_capacity(max_items, max_bytes); }
+
+  // Clamped to MAX_ITEMS / MAX_BYTES; called after an update, the next one parses again
+  void set_capacity(size_t max_items, size_t max_bytes);
+
+  // Returns true if the list changed
+  bool update(StringRef text);
+
+  size_t size() const { return this->count_; }
+  StringRef get(size_t index) const;
+  // Index of an item, -1 if not in the list
+  int index_of(StringRef item) const;
+
+  size_t get_max_items() const { return this->max_items_; }
+  size_t get_max_bytes() const { return this->max_bytes_; }
+  size_t get_used_bytes() const { return this->used_; }
+  // Items of the last update that did not fit
+  size_t get_dropped() const { return this->dropped_; }
+
+ protected:
+  struct Item {
+    uint32_t hash;
+    uint16_t offset;
+    uint16_t length;
+  };
+
+  void add_(StringRef item);
+  // Slot holding item, or the empty slot where it would go
+  size_t find_slot_(StringRef item, uint32_t hash) const;
+
+  size_t max_items_{0};
+  size_t max_bytes_{0};
+  // Power of two, at least twice max_items_
+  size_t slot_mask_{0};
+  std::unique_ptr<Item[]> items_;
+  std::unique_ptr<char[]> buffer_;
+  // Item index + 1, 0 = empty
+  std::unique_ptr<uint16_t[]> slots_;
+  size_t count_{0};
+  size_t used_{0};
+  size_t dropped_{0};
+  uint32_t hash_{0};
+};
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
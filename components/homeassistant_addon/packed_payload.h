@@ -0,0 +1,38 @@
+#pragma once
+
+#include "esphome/core/string_ref.h"
+#include <cstddef>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+// Delimiter between the fields of a packed template sensor payload
+static constexpr char PACKED_DELIMITER = '|';
+
+/**
+ * @brief Split a packed "field|field|..." payload in place
+ *
+ * Fields are returned as slices of the payload (no copies). Missing trailing
+ * fields are left empty, extra fields are ignored.
+ *
+ * @return number of fields found
+ */
+template<size_t N> size_t split_packed_payload(StringRef payload, StringRef (&fields)[N]) {
+  const char *data = payload.c_str();
+  size_t size = payload.size();
+  size_t count = 0;
+  size_t start = 0;
+  for (size_t i = 0; i <= size && count < N; i++) {
+    if (i == size || data[i] == PACKED_DELIMITER) {
+      fields[count++] = StringRef(data + start, i - start);
+      start = i + 1;
+    }
+  }
+  for (size_t i = count; i < N; i++) {
+    fields[i] = StringRef();
+  }
+  return count;
+}
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
@@ -0,0 +1,49 @@
+#include "setpoint_stream.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace homeassistant_addon {
+
+static const char *const TAG = "homeassistant_addon.stream";
+
+void SetpointStream::stream(float value) {
+  bool was_pending = this->has_pending_;
+  this->pending_value_ = value;
+  this->has_pending_ = true;
+
+  // A trailing send is already scheduled: it will pick up the latest value
+  if (was_pending) return;
+
+  uint32_t elapsed = millis() - this->last_sent_time_;
+  if (!this->sent_once_ || elapsed >= this->min_interval_ms_) {
+    this->flush_();
+    return;
+  }
+
+  App.scheduler.set_timeout(this->owner_, this->name_, this->min_interval_ms_ - elapsed,
+                            [this]() { this->flush_(); });
+}
+
+void SetpointStream::commit(float value) {
+  App.scheduler.cancel_timeout(this->owner_, this->name_);
+  this->has_pending_ = false;
+  this->send_(value);
+}
+
+void SetpointStream::flush_() {
+  if (!this->has_pending_) return;
+  this->has_pending_ = false;
+  this->send_(this->pending_value_);
+}
+
+void SetpointStream::send_(float value) {
+  ESP_LOGV(TAG, "%s: sending %.3f", this->name_.c_str(), value);
+  this->last_sent_time_ = millis();
+  this->sent_once_ = true;
+  this->sender_(value);
+}
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include <functional>
+#include <string>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+/**
+ * @brief Rate-limited, latest-wins sender for values driven by a continuous input
+ *
+ * While the encoder moves, stream() is called for every step. The first value is
+ * sent right away, then at most one value per min_interval; values arriving in
+ * between only replace the pending one, which is sent when the interval elapses.
+ * The last value is therefore always sent (trailing send), without flooding HA.
+ * commit() sends a value immediately and drops anything pending.
+ */
+class SetpointStream {
+ public:
+  SetpointStream(Component *owner, const char *name, std::function<void(float)> &&sender)
+      : owner_(owner), name_(name), sender_(std::move(sender)) {}
+
+  void set_min_interval(uint32_t interval_ms) { this->min_interval_ms_ = interval_ms; }
+  uint32_t get_min_interval() const { return this->min_interval_ms_; }
+
+  // Intermediate setpoint (rate limited, latest wins)
+  void stream(float value);
+  // Final setpoint (sent now)
+  void commit(float value);
+
+  bool has_pending() const { return this->has_pending_; }
+
+ protected:
+  void flush_();
+  void send_(float value);
+
+  Component *owner_;
+  std::string name_;
+  std::function<void(float)> sender_;
+  uint32_t min_interval_ms_{200};
+  uint32_t last_sent_time_{0};
+  bool sent_once_{false};
+  bool has_pending_{false};
+  float pending_value_{0.0f};
+};
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
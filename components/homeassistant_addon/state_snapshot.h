@@ -0,0 +1,99 @@
+#pragma once
+
+#include "esphome/core/application.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
+#include <cstring>
+
+namespace esphome {
+namespace homeassistant_addon {
+
+/**
+ * @brief Last known state of a mirror, kept in preferences across reboots
+ *
+ * restore() is called in setup(): the mirror starts from the saved state
+ * instead of empty values, and reports itself stale until HA sends a fresh
+ * update. Mirrors are set up at DATA priority, before WiFi and before the
+ * dial draws its first frame, so the saved state is on screen for the whole
+ * time it takes to connect. Their subscriptions are registered there too;
+ * the API server sends them to HA once it connects. update() is called on every change; writes are coalesced to at most
+ * one per min_interval (latest wins, the last change is always written) and
+ * skipped when nothing changed, on top of the flash write interval of the
+ * preferences backend.
+ *
+ * T is a packed struct with a TYPE constant; the slot is keyed by the entity
+ * id, so reordering the YAML keeps the snapshots. Change TYPE when the layout
+ * of T changes, old snapshots are then ignored.
+ */
+template<typename T> class StateSnapshot {
+ public:
+  StateSnapshot(Component *owner, const char *name) : owner_(owner), name_(name) {}
+
+  // 0 disables persistence: nothing is restored nor written
+  void set_min_interval(uint32_t interval_ms) { this->min_interval_ms_ = interval_ms; }
+  uint32_t get_min_interval() const { return this->min_interval_ms_; }
+  bool is_enabled() const { return this->min_interval_ms_ > 0; }
+
+  // Open the slot of this entity; true and state filled if a snapshot was saved
+  bool restore(const char *key, T *state) {
+    if (!this->is_enabled()) return false;
+    this->pref_ = global_preferences->make_preference<T>(fnv1_hash(key) ^ T::TYPE, true);
+    this->open_ = true;
+    // Boot counts as a write: the first one comes a full interval later
+    this->last_write_time_ = millis();
+    if (!this->pref_.load(&this->saved_)) return false;
+    *state = this->saved_;
+    return true;
+  }
+
+  // Latest state of the mirror
+  void update(const T &state) {
+    if (!this->open_) return;
+    this->pending_ = state;
+    if (memcmp(&state, &this->saved_, sizeof(T)) == 0) {
+      // Back to what is saved: nothing to write
+      App.scheduler.cancel_timeout(this->owner_, this->name_);
+      this->has_pending_ = false;
+      return;
+    }
+    // A write is already scheduled: it will pick up the latest state
+    if (this->has_pending_) return;
+    this->has_pending_ = true;
+
+    uint32_t elapsed = millis() - this->last_write_time_;
+    if (elapsed >= this->min_interval_ms_) {
+      this->write_();
+      return;
+    }
+    App.scheduler.set_timeout(this->owner_, this->name_, this->min_interval_ms_ - elapsed,
+                              [this]() { this->write_(); });
+  }
+
+  uint32_t get_writes() const { return this->writes_; }
+
+ protected:
+  void write_() {
+    if (!this->has_pending_) return;
+    this->has_pending_ = false;
+    this->pref_.save(&this->pending_);
+    this->saved_ = this->pending_;
+    this->last_write_time_ = millis();
+    this->writes_++;
+  }
+
+  Component *owner_;
+  const char *name_;
+  uint32_t min_interval_ms_{0};
+  ESPPreferenceObject pref_;
+  bool open_{false};
+  bool has_pending_{false};
+  T saved_{};
+  T pending_{};
+  uint32_t last_write_time_{0};
+  uint32_t writes_{0};
+};
+
+}  // namespace homeassistant_addon
+}  // namespace esphome
@@ -0,0 +1,114 @@
+/**
+ * @file dial_fixture.h
+ * @brief A dial with switch, cover and climate apps, wired as codegen would
+ *
+ * Shared by the runner and the tests. Home Assistant is played through the
+ * API stand-in, the user through the lvgl component's encoder and the
+ * controller's input calls.
+ */
+#pragma once
+
+#include "esphome/core/application.h"
+#include "esphome/components/api/api_server.h"
+#include "esphome/components/lvgl/lvgl_esphome.h"
+#include "esphome/components/time/real_time_clock.h"
+#include "esphome/components/homeassistant_addon/climate/homeassistant_climate.h"
+#include "esphome/components/homeassistant_addon/cover/homeassistant_cover.h"
+#include "esphome/components/dial_menu/dial_menu_controller.h"
+#include "esphome/components/dial_menu/climate_app.h"
+#include "esphome/components/dial_menu/cover_app.h"
+#include "esphome/components/dial_menu/switch_app.h"
+#include <cmath>
+#include <vector>
+
+namespace esphome {
+namespace host {
+
+// Optimistic switch, as a template switch would be
+class HostSwitch : public switch_::Switch {
+ protected:
+  void write_state(bool state) override { this->publish_state(state); }
+};
+
+class HostDial {
+ public:
+  explicit HostDial(uint16_t width = 240, uint16_t height = 240, bool render_task = false)
+      : lvgl(width, height) {
+    this->lamp.set_name("Lamp");
+    this->fan.set_name("Fan");
+    this->blinds.set_name("Blinds");
+    this->blinds.set_entity_id("cover.living_room");
+    this->thermostat.set_name("Thermostat");
+    this->thermostat.set_entity_id("climate.living_room");
+
+    this->switches.set_name("Switches");
+    this->switches.set_icon("light");
+    this->switches.add_switch(&this->lamp, "Lamp", 0xFFC107);
+    this->switches.add_switch(&this->fan, "Fan", 0x03A9F4);
+    this->covers.set_name("Blinds");
+    this->covers.set_icon("blinds");
+    this->covers.set_controller(&this->menu);
+    this->covers.add_homeassistant_cover(&this->blinds, "Living room", 0x4CAF50);
+    this->climate.set_name("Climate");
+    this->climate.set_icon("thermostat");
+    this->climate.set_controller(&this->menu);
+    this->climate.set_climate(&this->thermostat);
+
+    // The diameter defaults to the display's shorter side, the ring is scaled to it
+    // and apps are placed as calculate_icon_positions() in the component's __init__.py
+    int diameter = width < height ? width : height;
+    this->menu.set_diameter(diameter);
+    this->menu.set_button_size(HostDial::scale(50, diameter));
+    this->menu.set_button_size_focused(HostDial::scale(58, diameter));
+    std::vector<dial_menu::DialApp *> apps{&this->switches, &this->covers, &this->climate};
+    int radius = HostDial::scale(85, diameter);
+    for (size_t i = 0; i < apps.size(); i++) {
+      double angle = 2 * M_PI * i / apps.size() - M_PI / 2;
+      apps[i]->set_index(i);
+      apps[i]->set_position((int) (radius * cos(angle)), (int) (radius * sin(angle)));
+      this->menu.add_app(apps[i]);
+    }
+    this->menu.set_time(&this->clock);
+    this->menu.set_snapshot_key("dial_menu_host");
+    this->menu.set_lvgl(&this->lvgl);
+    if (render_task) this->menu.set_render_task(0);
+  }
+
+  // Same order as the generated main.cpp: entities first, LVGL before the menu
+  void setup() {
+    for (Component *component : std::vector<Component *>{&this->api, &this->blinds, &this->thermostat, &this->clock,
+                                                         &this->lvgl, &this->menu}) {
+      App.register_component(component);
+    }
+    App.setup();
+  }
+
+  // Home Assistant answers the subscriptions
+  void answer_subscriptions() {
+    this->api.inject_state("cover.living_room", "", "open");
+    this->api.inject_state("cover.living_room", "current_position", "100");
+    this->api.inject_state("climate.living_room", "", "heat");
+    this->api.inject_state("climate.living_room", "temperature", "20.5");
+    this->api.inject_state("climate.living_room", "current_temperature", "19.8");
+  }
+
+  lvgl::HostDisplay &display() { return this->lvgl.get_display(); }
+
+  // scale_to_diameter() of __init__.py: a length of the 240 px reference display
+  static int scale(int reference, int diameter) { return (int) lround(reference * diameter / 240.0); }
+
+  api::APIServer api;
+  lvgl::LvglComponent lvgl;
+  time::RealTimeClock clock;
+  HostSwitch lamp;
+  HostSwitch fan;
+  homeassistant_addon::HomeassistantCover blinds;
+  homeassistant_addon::HomeassistantClimate thermostat;
+  dial_menu::DialMenuController menu;
+  dial_menu::SwitchApp switches;
+  dial_menu::CoverApp covers;
+  dial_menu::ClimateApp climate;
+};
+
+}  // namespace host
+}  // namespace esphome
@@ -0,0 +1,100 @@
+/**
+ * @file dial_menu_host.cpp
+ * @brief Headless run of a dial with switch, cover and climate apps
+ *
+ * Plays Home Assistant and the user against the host dial (dial_fixture.h)
+ * and prints the frame counters of each step:
+ *
+ *   dial_menu_host [--render-task] [--ppm <file>]
+ *
+ * --render-task runs LVGL in the render task (a thread here), --ppm saves the
+ * last frame. tests/test_dial_menu.cpp checks the same steps.
+ */
+
+#include "dial_fixture.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <cstdio>
+#include <cstring>
+
+using namespace esphome;
+
+static const char *const TAG = "host";
+
+static void report(const char *step, lvgl::HostDisplay &display) {
+  const lvgl::FrameStats &stats = display.get_stats();
+  ESP_LOGI(TAG, "%-22s %4u frames, %8llu px flushed, avg %6u us, max %6u us", step, (unsigned) stats.frames,
+           (unsigned long long) stats.flushed_px, (unsigned) stats.average_frame_us(), (unsigned) stats.max_frame_us);
+  display.reset_stats();
+}
+
+int main(int argc, char **argv) {
+  bool render_task = false;
+  const char *ppm_path = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--render-task") == 0) {
+      render_task = true;
+    } else if (strcmp(argv[i], "--ppm") == 0 && i + 1 < argc) {
+      ppm_path = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--render-task] [--ppm <file>]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  host::HostDial dial(240, 240, render_task);
+  dial.setup();
+  App.run_for(1000);
+  const dial_menu::BootTimeline &boot = dial.menu.get_boot_timeline();
+  ESP_LOGI(TAG, "Boot: first frame at %u ms (%u us), UI ready at %u ms", (unsigned) boot.first_frame,
+           (unsigned) boot.first_frame_us, (unsigned) boot.idle_screen);
+  report("boot", dial.display());
+
+  dial.answer_subscriptions();
+  App.run_for(200);
+  report("ha states", dial.display());
+
+  // Turn the dial through the launcher: LVGL's encoder moves the focus
+  for (int i = 0; i < 3; i++) {
+    dial.lvgl.rotate_encoder(1);
+    App.run_for(100);
+  }
+  report("launcher rotate x3", dial.display());
+
+  // Open the cover app and move the target: the position is sent once the dial rests
+  dial.menu.select_app(1);
+  dial.menu.on_button_click();
+  App.run_for(300);
+  report("open cover app", dial.display());
+
+  // A tap on the position label switches from the actions to position mode
+  dial.covers.next_mode();
+  App.run_for(100);
+
+  uint32_t input_us = micros();
+  for (int i = 0; i < 4; i++) {
+    dial.menu.on_encoder_rotate(-1);
+    App.run_for(30);
+  }
+  App.run_for(2000);
+  report("cover target", dial.display());
+  for (const auto &action : dial.api.get_sent_actions()) {
+    ESP_LOGI(TAG, "Sent %s position=%s, %u ms after the first step", action.service.c_str(),
+             action.get("position").c_str(), (unsigned) ((action.time_us - input_us) / 1000));
+  }
+
+  dial.menu.on_long_press();
+  App.run_for(300);
+  report("back to launcher", dial.display());
+
+  dial.menu.show_idle_screen();
+  App.run_for(300);
+  report("idle screen", dial.display());
+
+  if (ppm_path != nullptr && !dial.display().save_ppm(ppm_path)) {
+    ESP_LOGE(TAG, "Could not write %s", ppm_path);
+    return 1;
+  }
+  App.dump_config();
+  return 0;
+}
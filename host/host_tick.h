@@ -0,0 +1,20 @@
+/**
+ * @file host_tick.h
+ * @brief LVGL's tick source on the host: millis(), manual clock included
+ */
+#ifndef HOST_TICK_H
+#define HOST_TICK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t host_tick_ms(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // HOST_TICK_H
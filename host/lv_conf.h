@@ -0,0 +1,30 @@
+/**
+ * @file lv_conf.h
+ * @brief LVGL 8 configuration of the host build
+ *
+ * Only what differs from LVGL's defaults (lv_conf_internal.h): RGB565 like
+ * the dial's panel, LVGL's own heap so lv_mem_monitor() has numbers, the
+ * tick taken from the host clock, and the fonts dial_menu falls back to.
+ */
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH 16
+
+#define LV_MEM_CUSTOM 0
+#define LV_MEM_SIZE (256U * 1024U)
+
+#define LV_TICK_CUSTOM 1
+#define LV_TICK_CUSTOM_INCLUDE "host_tick.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (host_tick_ms())
+
+#define LV_DISP_DEF_REFR_PERIOD 16
+#define LV_USE_PERF_MONITOR 0
+#define LV_USE_LOG 0
+
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_MONTSERRAT_18 1
+#define LV_FONT_MONTSERRAT_28 1
+#define LV_FONT_MONTSERRAT_48 1
+
+#endif  // LV_CONF_H
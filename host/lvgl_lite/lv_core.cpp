@@ -0,0 +1,252 @@
+/**
+ * @file lv_core.cpp
+ * @brief Init, tick, memory accounting, timers, areas and colors
+ */
+
+#include "lv_lite_private.h"
+#include <cstdlib>
+#include <cstring>
+
+#if defined(LV_TICK_CUSTOM) && LV_TICK_CUSTOM
+#include LV_TICK_CUSTOM_INCLUDE
+#endif
+
+/*********************
+ * Init
+ *********************/
+
+static bool lv_initialized = false;
+
+void lv_init(void) { lv_initialized = true; }
+
+void lv_deinit(void) {
+  lv_lite_indev_reset();
+  lv_initialized = false;
+}
+
+bool lv_is_initialized(void) { return lv_initialized; }
+
+/*********************
+ * Tick
+ *********************/
+
+#if defined(LV_TICK_CUSTOM) && LV_TICK_CUSTOM
+uint32_t lv_tick_get(void) { return LV_TICK_CUSTOM_SYS_TIME_EXPR; }
+#else
+static uint32_t sys_time = 0;
+void lv_tick_inc(uint32_t tick_period) { sys_time += tick_period; }
+uint32_t lv_tick_get(void) { return sys_time; }
+#endif
+
+uint32_t lv_tick_elaps(uint32_t prev_tick) { return lv_tick_get() - prev_tick; }
+
+/*********************
+ * Memory
+ *
+ * The C heap with a size header, so lv_mem_monitor() reports what LVGL's own
+ * heap of LV_MEM_SIZE would hold (without its fragmentation).
+ *********************/
+
+namespace {
+struct MemHeader {
+  size_t size;
+  size_t pad;  // Keeps the payload 16-byte aligned
+};
+uint32_t mem_used = 0;
+uint32_t mem_max_used = 0;
+uint32_t mem_used_cnt = 0;
+}  // namespace
+
+void *lv_mem_alloc(size_t size) {
+  if (size == 0) size = 1;
+  auto *header = static_cast<MemHeader *>(malloc(sizeof(MemHeader) + size));
+  if (header == nullptr) return nullptr;
+  header->size = size;
+  mem_used += (uint32_t) size;
+  mem_used_cnt++;
+  if (mem_used > mem_max_used) mem_max_used = mem_used;
+  return header + 1;
+}
+
+void lv_mem_free(void *data) {
+  if (data == nullptr) return;
+  MemHeader *header = static_cast<MemHeader *>(data) - 1;
+  mem_used -= (uint32_t) header->size;
+  mem_used_cnt--;
+  free(header);
+}
+
+void *lv_mem_realloc(void *data_p, size_t new_size) {
+  if (data_p == nullptr) return lv_mem_alloc(new_size);
+  if (new_size == 0) {
+    lv_mem_free(data_p);
+    return nullptr;
+  }
+  MemHeader *header = static_cast<MemHeader *>(data_p) - 1;
+  size_t old_size = header->size;
+  auto *moved = static_cast<MemHeader *>(realloc(header, sizeof(MemHeader) + new_size));
+  if (moved == nullptr) return nullptr;
+  moved->size = new_size;
+  mem_used = mem_used - (uint32_t) old_size + (uint32_t) new_size;
+  if (mem_used > mem_max_used) mem_max_used = mem_used;
+  return moved + 1;
+}
+
+void lv_mem_monitor(lv_mem_monitor_t *mon_p) {
+  memset(mon_p, 0, sizeof(*mon_p));
+  mon_p->total_size = LV_MEM_SIZE;
+  mon_p->used_cnt = mem_used_cnt;
+  mon_p->free_cnt = 1;
+  mon_p->free_size = mem_used < LV_MEM_SIZE ? LV_MEM_SIZE - mem_used : 0;
+  mon_p->free_biggest_size = mon_p->free_size;
+  mon_p->max_used = mem_max_used;
+  mon_p->used_pct = (uint8_t) (100 - (uint64_t) mon_p->free_size * 100 / LV_MEM_SIZE);
+  mon_p->frag_pct = 0;
+}
+
+/*********************
+ * Timers
+ *
+ * Newest first, like LVGL's linked list; a timer created or deleted from a
+ * callback restarts the pass.
+ *********************/
+
+namespace {
+lv_timer_t **timers = nullptr;
+uint32_t timer_cnt = 0;
+bool timer_list_changed = false;
+bool handler_running = false;
+}  // namespace
+
+lv_timer_t *lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void *user_data) {
+  auto *timer = static_cast<lv_timer_t *>(lv_mem_alloc(sizeof(lv_timer_t)));
+  if (timer == nullptr) return nullptr;
+  memset(timer, 0, sizeof(*timer));
+  timer->period = period;
+  timer->timer_cb = timer_xcb;
+  timer->repeat_count = -1;
+  timer->last_run = lv_tick_get();
+  timer->user_data = user_data;
+
+  timers = static_cast<lv_timer_t **>(lv_mem_realloc(timers, sizeof(lv_timer_t *) * (timer_cnt + 1)));
+  memmove(&timers[1], &timers[0], sizeof(lv_timer_t *) * timer_cnt);
+  timers[0] = timer;
+  timer_cnt++;
+  timer_list_changed = true;
+  return timer;
+}
+
+void lv_timer_del(lv_timer_t *timer) {
+  for (uint32_t i = 0; i < timer_cnt; i++) {
+    if (timers[i] != timer) continue;
+    memmove(&timers[i], &timers[i + 1], sizeof(lv_timer_t *) * (timer_cnt - i - 1));
+    timer_cnt--;
+    timer_list_changed = true;
+    lv_mem_free(timer);
+    return;
+  }
+}
+
+void lv_timer_pause(lv_timer_t *timer) { timer->paused = 1; }
+void lv_timer_resume(lv_timer_t *timer) { timer->paused = 0; }
+void lv_timer_set_period(lv_timer_t *timer, uint32_t period) { timer->period = period; }
+void lv_timer_set_cb(lv_timer_t *timer, lv_timer_cb_t timer_cb) { timer->timer_cb = timer_cb; }
+void lv_timer_ready(lv_timer_t *timer) { timer->last_run = lv_tick_get() - timer->period - 1; }
+void lv_timer_reset(lv_timer_t *timer) { timer->last_run = lv_tick_get(); }
+
+lv_timer_t *lv_timer_get_next(lv_timer_t *timer) {
+  if (timer == nullptr) return timer_cnt > 0 ? timers[0] : nullptr;
+  for (uint32_t i = 0; i + 1 < timer_cnt; i++) {
+    if (timers[i] == timer) return timers[i + 1];
+  }
+  return nullptr;
+}
+
+uint32_t lv_timer_handler(void) {
+  if (handler_running) return 1;
+  handler_running = true;
+
+  bool restart;
+  do {
+    restart = false;
+    timer_list_changed = false;
+    for (uint32_t i = 0; i < timer_cnt; i++) {
+      lv_timer_t *timer = timers[i];
+      if (timer->paused || lv_tick_elaps(timer->last_run) < timer->period) continue;
+      timer->last_run = lv_tick_get();
+      if (timer->timer_cb != nullptr) timer->timer_cb(timer);
+      if (timer_list_changed) {
+        restart = true;
+        break;
+      }
+      if (timer->repeat_count > 0 && --timer->repeat_count == 0) {
+        lv_timer_del(timer);
+        restart = true;
+        break;
+      }
+    }
+  } while (restart);
+
+  uint32_t next = LV_NO_TIMER_READY;
+  for (uint32_t i = 0; i < timer_cnt; i++) {
+    lv_timer_t *timer = timers[i];
+    if (timer->paused) continue;
+    uint32_t elapsed = lv_tick_elaps(timer->last_run);
+    uint32_t remaining = elapsed >= timer->period ? 0 : timer->period - elapsed;
+    if (remaining < next) next = remaining;
+  }
+  handler_running = false;
+  return next;
+}
+
+/*********************
+ * Areas
+ *********************/
+
+void lv_area_set(lv_area_t *area, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2) {
+  area->x1 = x1;
+  area->y1 = y1;
+  area->x2 = x2;
+  area->y2 = y2;
+}
+
+bool _lv_area_intersect(lv_area_t *res, const lv_area_t *a1, const lv_area_t *a2) {
+  lv_area_t out;
+  out.x1 = a1->x1 > a2->x1 ? a1->x1 : a2->x1;
+  out.y1 = a1->y1 > a2->y1 ? a1->y1 : a2->y1;
+  out.x2 = a1->x2 < a2->x2 ? a1->x2 : a2->x2;
+  out.y2 = a1->y2 < a2->y2 ? a1->y2 : a2->y2;
+  *res = out;
+  return out.x1 <= out.x2 && out.y1 <= out.y2;
+}
+
+void _lv_area_join(lv_area_t *res, const lv_area_t *a1, const lv_area_t *a2) {
+  lv_area_t out;
+  out.x1 = a1->x1 < a2->x1 ? a1->x1 : a2->x1;
+  out.y1 = a1->y1 < a2->y1 ? a1->y1 : a2->y1;
+  out.x2 = a1->x2 > a2->x2 ? a1->x2 : a2->x2;
+  out.y2 = a1->y2 > a2->y2 ? a1->y2 : a2->y2;
+  *res = out;
+}
+
+bool _lv_area_is_on(const lv_area_t *a1, const lv_area_t *a2) {
+  return a1->x1 <= a2->x2 && a1->x2 >= a2->x1 && a1->y1 <= a2->y2 && a1->y2 >= a2->y1;
+}
+
+bool _lv_area_is_in(const lv_area_t *ain, const lv_area_t *aholder, lv_coord_t radius) {
+  if (ain->x1 < aholder->x1 + radius || ain->y1 < aholder->y1 + radius) return false;
+  if (ain->x2 > aholder->x2 - radius || ain->y2 > aholder->y2 - radius) return false;
+  return true;
+}
+
+/*********************
+ * Colors
+ *********************/
+
+lv_color_t lv_color_mix(lv_color_t c1, lv_color_t c2, uint8_t mix) {
+  lv_color_t out;
+  out.ch.red = (uint16_t) ((c1.ch.red * mix + c2.ch.red * (255 - mix) + 127) / 255);
+  out.ch.green = (uint16_t) ((c1.ch.green * mix + c2.ch.green * (255 - mix) + 127) / 255);
+  out.ch.blue = (uint16_t) ((c1.ch.blue * mix + c2.ch.blue * (255 - mix) + 127) / 255);
+  return out;
+}
@@ -0,0 +1,278 @@
+/**
+ * @file lv_disp.cpp
+ * @brief Displays, invalidation and the refresh timer
+ */
+
+#include "lv_lite_private.h"
+#include <cstring>
+
+namespace {
+lv_disp_t *disp_def = nullptr;
+lv_disp_t *disp_head = nullptr;
+}  // namespace
+
+void lv_disp_drv_init(lv_disp_drv_t *driver) {
+  memset(driver, 0, sizeof(*driver));
+  driver->hor_res = 320;
+  driver->ver_res = 240;
+  driver->antialiasing = 1;
+  driver->dpi = 130;
+}
+
+void lv_disp_draw_buf_init(lv_disp_draw_buf_t *draw_buf, void *buf1, void *buf2, uint32_t size_in_px_cnt) {
+  memset(draw_buf, 0, sizeof(*draw_buf));
+  draw_buf->buf1 = buf1;
+  draw_buf->buf2 = buf2;
+  draw_buf->buf_act = buf1;
+  draw_buf->size = size_in_px_cnt;
+}
+
+lv_disp_t *lv_disp_drv_register(lv_disp_drv_t *driver) {
+  auto *disp = static_cast<lv_disp_t *>(lv_mem_alloc(sizeof(lv_disp_t)));
+  memset(disp, 0, sizeof(*disp));
+  disp->driver = driver;
+  disp->next = disp_head;
+  disp_head = disp;
+
+  // The screens are created on the new display, whichever is the default
+  lv_disp_t *disp_def_tmp = disp_def;
+  disp_def = disp;
+  disp->refr_timer = lv_timer_create(_lv_disp_refr_timer, LV_DISP_DEF_REFR_PERIOD, disp);
+  disp->act_scr = lv_obj_create(nullptr);
+  disp->top_layer = lv_obj_create(nullptr);
+  disp->sys_layer = lv_obj_create(nullptr);
+  lv_obj_remove_style_all(disp->top_layer);
+  lv_obj_remove_style_all(disp->sys_layer);
+  lv_obj_clear_flag(disp->top_layer, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_clear_flag(disp->sys_layer, LV_OBJ_FLAG_CLICKABLE);
+  disp_def = disp_def_tmp != nullptr ? disp_def_tmp : disp;
+
+  lv_obj_invalidate(disp->act_scr);
+  lv_timer_ready(disp->refr_timer);
+  return disp;
+}
+
+void lv_disp_remove(lv_disp_t *disp) {
+  while (disp->screen_cnt > 0) lv_obj_del(disp->screens[disp->screen_cnt - 1]);
+  lv_mem_free(disp->screens);
+  lv_timer_del(disp->refr_timer);
+  for (lv_disp_t **it = &disp_head; *it != nullptr; it = &(*it)->next) {
+    if (*it == disp) {
+      *it = disp->next;
+      break;
+    }
+  }
+  if (disp_def == disp) disp_def = disp_head;
+  lv_mem_free(disp);
+}
+
+void lv_disp_set_default(lv_disp_t *disp) { disp_def = disp; }
+lv_disp_t *lv_disp_get_default(void) { return disp_def; }
+lv_disp_t *lv_disp_get_next(lv_disp_t *disp) { return disp == nullptr ? disp_head : disp->next; }
+
+lv_coord_t lv_disp_get_hor_res(lv_disp_t *disp) {
+  if (disp == nullptr) disp = disp_def;
+  return disp == nullptr ? 0 : disp->driver->hor_res;
+}
+
+lv_coord_t lv_disp_get_ver_res(lv_disp_t *disp) {
+  if (disp == nullptr) disp = disp_def;
+  return disp == nullptr ? 0 : disp->driver->ver_res;
+}
+
+void lv_disp_flush_ready(lv_disp_drv_t *disp_drv) {
+  disp_drv->draw_buf->flushing = 0;
+  disp_drv->draw_buf->flushing_last = 0;
+}
+
+bool lv_disp_flush_is_last(lv_disp_drv_t *disp_drv) { return disp_drv->draw_buf->flushing_last; }
+
+lv_obj_t *lv_disp_get_scr_act(lv_disp_t *disp) {
+  if (disp == nullptr) disp = disp_def;
+  return disp == nullptr ? nullptr : disp->act_scr;
+}
+
+void lv_disp_load_scr(lv_obj_t *scr) {
+  lv_disp_t *disp = lv_obj_get_disp(scr);
+  if (disp == nullptr) return;
+  lv_obj_t *old_scr = disp->act_scr;
+  if (old_scr != nullptr && old_scr != scr) lv_event_send(old_scr, LV_EVENT_SCREEN_UNLOAD_START, nullptr);
+  lv_event_send(scr, LV_EVENT_SCREEN_LOAD_START, nullptr);
+  disp->act_scr = scr;
+  disp->prev_scr = nullptr;
+  lv_event_send(scr, LV_EVENT_SCREEN_LOADED, nullptr);
+  if (old_scr != nullptr && old_scr != scr) lv_event_send(old_scr, LV_EVENT_SCREEN_UNLOADED, nullptr);
+  lv_obj_invalidate(scr);
+}
+
+void lv_lite_disp_add_screen(lv_disp_t *disp, lv_obj_t *scr) {
+  disp->screens = static_cast<lv_obj_t **>(lv_mem_realloc(disp->screens, sizeof(lv_obj_t *) * (disp->screen_cnt + 1)));
+  disp->screens[disp->screen_cnt++] = scr;
+}
+
+void lv_lite_disp_remove_screen(lv_disp_t *disp, lv_obj_t *scr) {
+  for (uint32_t i = 0; i < disp->screen_cnt; i++) {
+    if (disp->screens[i] != scr) continue;
+    memmove(&disp->screens[i], &disp->screens[i + 1], sizeof(lv_obj_t *) * (disp->screen_cnt - i - 1));
+    disp->screen_cnt--;
+    break;
+  }
+  if (disp->act_scr == scr) disp->act_scr = nullptr;
+  if (disp->top_layer == scr) disp->top_layer = nullptr;
+  if (disp->sys_layer == scr) disp->sys_layer = nullptr;
+}
+
+/*********************
+ * Invalidation
+ *********************/
+
+void _lv_inv_area(lv_disp_t *disp, const lv_area_t *area_p) {
+  if (disp == nullptr) disp = disp_def;
+  if (disp == nullptr) return;
+  if (area_p == nullptr) {
+    disp->inv_p = 0;
+    return;
+  }
+
+  lv_area_t scr_area;
+  lv_area_set(&scr_area, 0, 0, (lv_coord_t) (disp->driver->hor_res - 1), (lv_coord_t) (disp->driver->ver_res - 1));
+  lv_area_t com_area;
+  if (!_lv_area_intersect(&com_area, area_p, &scr_area)) return;
+
+  if (disp->driver->full_refresh) {
+    disp->inv_areas[0] = scr_area;
+    disp->inv_p = 1;
+    if (disp->refr_timer != nullptr) lv_timer_resume(disp->refr_timer);
+    return;
+  }
+
+  if (disp->driver->rounder_cb != nullptr) disp->driver->rounder_cb(disp->driver, &com_area);
+
+  // Nothing to do if already covered
+  for (uint16_t i = 0; i < disp->inv_p; i++) {
+    if (_lv_area_is_in(&com_area, &disp->inv_areas[i], 0)) return;
+  }
+
+  // Out of slots: the whole screen
+  if (disp->inv_p < LV_INV_BUF_SIZE) {
+    disp->inv_areas[disp->inv_p] = com_area;
+  } else {
+    disp->inv_p = 0;
+    disp->inv_areas[0] = scr_area;
+  }
+  disp->inv_p++;
+  if (disp->refr_timer != nullptr) lv_timer_resume(disp->refr_timer);
+}
+
+/*********************
+ * Refresh
+ *********************/
+
+// Merge areas when the union is smaller than the two apart
+static void refr_join_area(lv_disp_t *disp) {
+  for (uint32_t join_in = 0; join_in < disp->inv_p; join_in++) {
+    if (disp->inv_area_joined[join_in]) continue;
+    for (uint32_t join_from = 0; join_from < disp->inv_p; join_from++) {
+      if (disp->inv_area_joined[join_from] || join_in == join_from) continue;
+      if (!_lv_area_is_on(&disp->inv_areas[join_in], &disp->inv_areas[join_from])) continue;
+      lv_area_t joined_area;
+      _lv_area_join(&joined_area, &disp->inv_areas[join_in], &disp->inv_areas[join_from]);
+      if (lv_area_get_size(&joined_area) <
+          lv_area_get_size(&disp->inv_areas[join_in]) + lv_area_get_size(&disp->inv_areas[join_from])) {
+        disp->inv_areas[join_in] = joined_area;
+        disp->inv_area_joined[join_from] = 1;
+      }
+    }
+  }
+}
+
+static void draw_buf_flush(lv_disp_t *disp, const lv_area_t *area, bool last_part) {
+  lv_disp_draw_buf_t *draw_buf = disp->driver->draw_buf;
+  draw_buf->flushing = 1;
+  draw_buf->flushing_last = draw_buf->last_area && last_part;
+  draw_buf->last_part = last_part;
+  if (disp->driver->flush_cb != nullptr) {
+    disp->driver->flush_cb(disp->driver, area, static_cast<lv_color_t *>(draw_buf->buf_act));
+  }
+  // Single buffered, as the dial: wait until the panel has the band
+  while (draw_buf->flushing) {
+  }
+  if (draw_buf->buf1 != nullptr && draw_buf->buf2 != nullptr) {
+    draw_buf->buf_act = draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+  }
+}
+
+// An area in bands of as many rows as the draw buffer holds, rounded like the panel wants them
+static void refr_area(lv_disp_t *disp, const lv_area_t *area) {
+  lv_disp_drv_t *driver = disp->driver;
+  lv_coord_t w = lv_area_get_width(area);
+  lv_coord_t max_row = (lv_coord_t) (driver->draw_buf->size / (uint32_t) w);
+  if (max_row > lv_area_get_height(area)) max_row = lv_area_get_height(area);
+  if (max_row < 1) max_row = 1;
+
+  lv_coord_t row = area->y1;
+  while (row <= area->y2) {
+    lv_coord_t rows = max_row;
+    lv_area_t sub;
+    for (;;) {
+      lv_area_set(&sub, area->x1, row, area->x2, (lv_coord_t) (row + rows - 1));
+      if (sub.y2 > area->y2) sub.y2 = area->y2;
+      if (driver->rounder_cb != nullptr) driver->rounder_cb(driver, &sub);
+      if (lv_area_get_size(&sub) <= driver->draw_buf->size || rows == 1) break;
+      rows--;
+    }
+    bool last_part = sub.y2 >= area->y2;
+    lv_lite_draw_area(disp, &sub, static_cast<lv_color_t *>(driver->draw_buf->buf_act));
+    draw_buf_flush(disp, &sub, last_part);
+    row = (lv_coord_t) (sub.y2 + 1);
+  }
+}
+
+void _lv_disp_refr_timer(lv_timer_t *timer) {
+  lv_disp_t *disp;
+  if (timer != nullptr) {
+    disp = static_cast<lv_disp_t *>(timer->user_data);
+    lv_timer_pause(timer);
+  } else {
+    disp = disp_def;
+  }
+  if (disp == nullptr || disp->act_scr == nullptr) return;
+  if (disp->inv_p == 0) return;
+
+  uint32_t start = lv_tick_get();
+  refr_join_area(disp);
+
+  int32_t last = -1;
+  for (int32_t i = disp->inv_p - 1; i >= 0; i--) {
+    if (!disp->inv_area_joined[i]) {
+      last = i;
+      break;
+    }
+  }
+
+  uint32_t px_num = 0;
+  for (int32_t i = 0; i < disp->inv_p; i++) {
+    if (disp->inv_area_joined[i]) continue;
+    disp->driver->draw_buf->last_area = i == last;
+    refr_area(disp, &disp->inv_areas[i]);
+    px_num += lv_area_get_size(&disp->inv_areas[i]);
+  }
+
+  memset(disp->inv_areas, 0, sizeof(disp->inv_areas));
+  memset(disp->inv_area_joined, 0, sizeof(disp->inv_area_joined));
+  disp->inv_p = 0;
+
+  if (disp->driver->monitor_cb != nullptr && px_num > 0) {
+    disp->driver->monitor_cb(disp->driver, lv_tick_elaps(start), px_num);
+  }
+}
+
+void lv_refr_now(lv_disp_t *disp) {
+  if (disp != nullptr) {
+    if (disp->refr_timer != nullptr) _lv_disp_refr_timer(disp->refr_timer);
+    return;
+  }
+  for (lv_disp_t *d = disp_head; d != nullptr; d = d->next) {
+    if (d->refr_timer != nullptr) _lv_disp_refr_timer(d->refr_timer);
+  }
+}
@@ -0,0 +1,373 @@
+/**
+ * @file lv_draw.cpp
+ * @brief Software rendering of a screen area into the draw buffer
+ *
+ * Per object, in LVGL's order: shadow, background, content (image, text,
+ * arcs), border, outline, then the children clipped to the object.
+ */
+
+#include "lv_lite_private.h"
+#include <cmath>
+#include <initializer_list>
+
+namespace {
+
+struct DrawCtx {
+  lv_color_t *buf;
+  lv_area_t buf_area;
+  lv_coord_t stride;
+};
+
+inline lv_opa_t opa_mix(lv_opa_t a, lv_opa_t b) {
+  if (a >= LV_OPA_COVER) return b;
+  if (b >= LV_OPA_COVER) return a;
+  return (lv_opa_t) (((uint32_t) a * b) >> 8);
+}
+
+inline void blend_px(const DrawCtx &ctx, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa) {
+  lv_color_t *px = &ctx.buf[(int32_t) (y - ctx.buf_area.y1) * ctx.stride + (x - ctx.buf_area.x1)];
+  *px = opa >= LV_OPA_COVER ? color : lv_color_mix(color, *px, opa);
+}
+
+// x1..x2 on row y, clipped to clip
+void fill_span(const DrawCtx &ctx, const lv_area_t &clip, lv_coord_t y, lv_coord_t x1, lv_coord_t x2,
+               lv_color_t color, lv_opa_t opa) {
+  if (y < clip.y1 || y > clip.y2) return;
+  if (x1 < clip.x1) x1 = clip.x1;
+  if (x2 > clip.x2) x2 = clip.x2;
+  for (lv_coord_t x = x1; x <= x2; x++) blend_px(ctx, x, y, color, opa);
+}
+
+lv_coord_t clamp_radius(const lv_area_t &area, lv_coord_t radius) {
+  lv_coord_t short_side = lv_area_get_width(&area) < lv_area_get_height(&area) ? lv_area_get_width(&area)
+                                                                              : lv_area_get_height(&area);
+  if (radius > short_side / 2) radius = (lv_coord_t) (short_side / 2);
+  return radius < 0 ? 0 : radius;
+}
+
+// Horizontal extent of a rounded rectangle on row y
+void rounded_span(const lv_area_t &area, lv_coord_t radius, lv_coord_t y, lv_coord_t *x1, lv_coord_t *x2) {
+  lv_coord_t dy = 0;
+  if (y < area.y1 + radius) {
+    dy = (lv_coord_t) (area.y1 + radius - y);
+  } else if (y > area.y2 - radius) {
+    dy = (lv_coord_t) (y - (area.y2 - radius));
+  }
+  lv_coord_t inset = 0;
+  if (dy > 0) {
+    float fy = (float) dy - 0.5f;
+    float dx = std::sqrt(std::fmax(0.0f, (float) radius * radius - fy * fy));
+    inset = (lv_coord_t) (radius - (lv_coord_t) std::lround(dx));
+  }
+  *x1 = (lv_coord_t) (area.x1 + inset);
+  *x2 = (lv_coord_t) (area.x2 - inset);
+}
+
+void fill_rounded(const DrawCtx &ctx, const lv_area_t &clip, const lv_area_t &area, lv_coord_t radius,
+                  lv_color_t color, lv_opa_t opa) {
+  lv_area_t rows;
+  if (opa == LV_OPA_TRANSP || !_lv_area_intersect(&rows, &clip, &area)) return;
+  radius = clamp_radius(area, radius);
+  for (lv_coord_t y = rows.y1; y <= rows.y2; y++) {
+    lv_coord_t x1, x2;
+    rounded_span(area, radius, y, &x1, &x2);
+    fill_span(ctx, clip, y, x1, x2, color, opa);
+  }
+}
+
+void draw_ring(const DrawCtx &ctx, const lv_area_t &clip, const lv_area_t &outer, lv_coord_t radius,
+               lv_coord_t width, lv_color_t color, lv_opa_t opa) {
+  lv_area_t rows;
+  if (opa == LV_OPA_TRANSP || width <= 0 || !_lv_area_intersect(&rows, &clip, &outer)) return;
+  radius = clamp_radius(outer, radius);
+  lv_area_t inner = {(lv_coord_t) (outer.x1 + width), (lv_coord_t) (outer.y1 + width), (lv_coord_t) (outer.x2 - width),
+                     (lv_coord_t) (outer.y2 - width)};
+  bool has_inner = inner.x1 <= inner.x2 && inner.y1 <= inner.y2;
+  lv_coord_t inner_radius = has_inner ? clamp_radius(inner, (lv_coord_t) (radius - width)) : 0;
+  for (lv_coord_t y = rows.y1; y <= rows.y2; y++) {
+    lv_coord_t ox1, ox2;
+    rounded_span(outer, radius, y, &ox1, &ox2);
+    if (!has_inner || y < inner.y1 || y > inner.y2) {
+      fill_span(ctx, clip, y, ox1, ox2, color, opa);
+      continue;
+    }
+    lv_coord_t ix1, ix2;
+    rounded_span(inner, inner_radius, y, &ix1, &ix2);
+    fill_span(ctx, clip, y, ox1, (lv_coord_t) (ix1 - 1), color, opa);
+    fill_span(ctx, clip, y, (lv_coord_t) (ix2 + 1), ox2, color, opa);
+  }
+}
+
+void fill_circle(const DrawCtx &ctx, const lv_area_t &clip, float cx, float cy, float r, lv_color_t color,
+                 lv_opa_t opa) {
+  lv_area_t area = {(lv_coord_t) std::floor(cx - r), (lv_coord_t) std::floor(cy - r), (lv_coord_t) std::ceil(cx + r),
+                    (lv_coord_t) std::ceil(cy + r)};
+  lv_area_t rows;
+  if (!_lv_area_intersect(&rows, &clip, &area)) return;
+  for (lv_coord_t y = rows.y1; y <= rows.y2; y++) {
+    float dy = (float) y + 0.5f - cy;
+    float half = r * r - dy * dy;
+    if (half < 0) continue;
+    half = std::sqrt(half);
+    fill_span(ctx, clip, y, (lv_coord_t) std::lround(cx - half), (lv_coord_t) (std::lround(cx + half) - 1), color,
+              opa);
+  }
+}
+
+bool angle_in(float angle, uint16_t start, uint16_t end) {
+  if (start == end) return false;
+  if (start < end) return angle >= start && angle <= end;
+  return angle >= start || angle <= end;
+}
+
+// Ring segment from start to end degrees, clockwise from 3 o'clock like LVGL
+void draw_arc(const DrawCtx &ctx, const lv_area_t &clip, const lv_area_t &coords, uint16_t start, uint16_t end,
+              lv_coord_t width, bool rounded, lv_color_t color, lv_opa_t opa) {
+  if (width <= 0 || opa == LV_OPA_TRANSP || start == end) return;
+  float cx = (coords.x1 + coords.x2 + 1) / 2.0f;
+  float cy = (coords.y1 + coords.y2 + 1) / 2.0f;
+  float r_out = (lv_area_get_width(&coords) < lv_area_get_height(&coords) ? lv_area_get_width(&coords)
+                                                                          : lv_area_get_height(&coords)) /
+                2.0f;
+  float r_in = r_out - width;
+  if (r_in < 0) r_in = 0;
+
+  lv_area_t rows;
+  if (!_lv_area_intersect(&rows, &clip, &coords)) return;
+  for (lv_coord_t y = rows.y1; y <= rows.y2; y++) {
+    float dy = (float) y + 0.5f - cy;
+    if (std::fabs(dy) > r_out) continue;
+    float out_half = std::sqrt(r_out * r_out - dy * dy);
+    float in_half = std::fabs(dy) < r_in ? std::sqrt(r_in * r_in - dy * dy) : 0.0f;
+    lv_coord_t x1 = (lv_coord_t) std::lround(cx - out_half);
+    lv_coord_t x2 = (lv_coord_t) (std::lround(cx + out_half) - 1);
+    if (x1 < clip.x1) x1 = clip.x1;
+    if (x2 > clip.x2) x2 = clip.x2;
+    for (lv_coord_t x = x1; x <= x2; x++) {
+      float dx = (float) x + 0.5f - cx;
+      if (std::fabs(dx) < in_half) continue;
+      float angle = std::atan2(dy, dx) * 180.0f / (float) M_PI;
+      if (angle < 0) angle += 360.0f;
+      if (angle_in(angle, start, end)) blend_px(ctx, x, y, color, opa);
+    }
+  }
+
+  if (!rounded) return;
+  float r_mid = r_out - width / 2.0f;
+  for (uint16_t angle : {start, end}) {
+    float rad = angle * (float) M_PI / 180.0f;
+    fill_circle(ctx, clip, cx + r_mid * std::cos(rad), cy + r_mid * std::sin(rad), width / 2.0f, color, opa);
+  }
+}
+
+lv_color_t style_color(const lv_obj_t *obj, lv_part_t part, lv_lite_prop_t prop) {
+  return lv_lite_style_color(obj, part, prop);
+}
+
+lv_coord_t style_coord(const lv_obj_t *obj, lv_part_t part, lv_lite_prop_t prop) {
+  return (lv_coord_t) lv_lite_style_num(obj, part, prop);
+}
+
+lv_opa_t style_opa(const lv_obj_t *obj, lv_part_t part, lv_lite_prop_t prop, lv_opa_t parent_opa) {
+  return opa_mix((lv_opa_t) lv_lite_style_num(obj, part, prop), parent_opa);
+}
+
+void draw_label(const DrawCtx &ctx, const lv_area_t &clip, const lv_obj_t *obj, lv_opa_t opa) {
+  auto *label = static_cast<const lv_lite_label_t *>(obj->ext);
+  if (label == nullptr || label->text == nullptr) return;
+  auto *font = static_cast<const lv_font_t *>(lv_lite_style_ptr(obj, LV_PART_MAIN, LITE_PROP_TEXT_FONT));
+  lv_color_t color = style_color(obj, LV_PART_MAIN, LITE_PROP_TEXT_COLOR);
+  auto align = (lv_text_align_t) lv_lite_style_num(obj, LV_PART_MAIN, LITE_PROP_TEXT_ALIGN);
+
+  lv_area_t content = obj->coords;
+  content.x1 = (lv_coord_t) (content.x1 + style_coord(obj, LV_PART_MAIN, LITE_PROP_PAD_LEFT));
+  content.x2 = (lv_coord_t) (content.x2 - style_coord(obj, LV_PART_MAIN, LITE_PROP_PAD_RIGHT));
+  content.y1 = (lv_coord_t) (content.y1 + style_coord(obj, LV_PART_MAIN, LITE_PROP_PAD_TOP));
+  lv_area_t text_clip;
+  if (!_lv_area_intersect(&text_clip, &clip, &obj->coords)) return;
+  lv_coord_t max_w = lv_area_get_width(&content);
+  bool wrap = label->long_mode == LV_LABEL_LONG_WRAP;
+
+  const char *line = label->text;
+  lv_coord_t y = content.y1;
+  while (*line != 0 && y <= text_clip.y2) {
+    // Measure the line: up to a newline, or as much as fits when wrapping
+    const char *end = line;
+    lv_coord_t line_w = 0;
+    for (;;) {
+      const char *next = end;
+      uint32_t letter = lv_lite_next_letter(&next);
+      if (letter == 0 || letter == '\n') break;
+      lv_coord_t letter_w = lv_lite_letter_width(letter, font);
+      if (wrap && line_w > 0 && line_w + letter_w > max_w) break;
+      line_w = (lv_coord_t) (line_w + letter_w);
+      end = next;
+    }
+
+    lv_coord_t x = content.x1;
+    if (align == LV_TEXT_ALIGN_CENTER) x = (lv_coord_t) (content.x1 + (max_w - line_w) / 2);
+    if (align == LV_TEXT_ALIGN_RIGHT) x = (lv_coord_t) (content.x2 - line_w + 1);
+
+    // Glyphs as boxes over the x-height and ascenders
+    lv_coord_t top = (lv_coord_t) (y + font->line_height / 4);
+    lv_coord_t bottom = (lv_coord_t) (y + font->line_height - font->base_line - 1);
+    if (bottom > text_clip.y2) bottom = text_clip.y2;
+    for (const char *c = line; c < end;) {
+      uint32_t letter = lv_lite_next_letter(&c);
+      lv_coord_t letter_w = lv_lite_letter_width(letter, font);
+      if (letter != ' ') {
+        lv_area_t glyph = {(lv_coord_t) (x + 1), top, (lv_coord_t) (x + letter_w - 2), bottom};
+        lv_area_t visible;
+        if (_lv_area_intersect(&visible, &glyph, &text_clip)) {
+          for (lv_coord_t gy = visible.y1; gy <= visible.y2; gy++) {
+            fill_span(ctx, visible, gy, visible.x1, visible.x2, color, opa);
+          }
+        }
+      }
+      x = (lv_coord_t) (x + letter_w);
+    }
+
+    y = (lv_coord_t) (y + font->line_height);
+    line = end;
+    if (*line == '\n') line++;
+  }
+}
+
+void draw_img(const DrawCtx &ctx, const lv_area_t &clip, const lv_obj_t *obj, lv_opa_t opa) {
+  auto *img = static_cast<const lv_lite_img_t *>(obj->ext);
+  if (img == nullptr || img->src == nullptr || (*static_cast<const uint8_t *>(img->src) & 0x80) != 0) return;
+  auto *dsc = static_cast<const lv_img_dsc_t *>(img->src);
+  if (dsc->data == nullptr) return;
+  lv_opa_t img_opa = style_opa(obj, LV_PART_MAIN, LITE_PROP_IMG_OPA, opa);
+  lv_color_t recolor = style_color(obj, LV_PART_MAIN, LITE_PROP_IMG_RECOLOR);
+  auto recolor_opa = (lv_opa_t) lv_lite_style_num(obj, LV_PART_MAIN, LITE_PROP_IMG_RECOLOR_OPA);
+
+  lv_area_t img_area = {obj->coords.x1, obj->coords.y1, (lv_coord_t) (obj->coords.x1 + dsc->header.w - 1),
+                        (lv_coord_t) (obj->coords.y1 + dsc->header.h - 1)};
+  lv_area_t visible;
+  if (!_lv_area_intersect(&visible, &clip, &img_area) || !_lv_area_intersect(&visible, &visible, &obj->coords)) {
+    return;
+  }
+  for (lv_coord_t y = visible.y1; y <= visible.y2; y++) {
+    uint32_t row = (uint32_t) (y - img_area.y1) * dsc->header.w;
+    for (lv_coord_t x = visible.x1; x <= visible.x2; x++) {
+      uint32_t i = row + (uint32_t) (x - img_area.x1);
+      switch (dsc->header.cf) {
+        case LV_IMG_CF_ALPHA_8BIT:
+          // Alpha only: drawn in the recolor
+          blend_px(ctx, x, y, recolor, opa_mix(dsc->data[i], img_opa));
+          break;
+        case LV_IMG_CF_TRUE_COLOR: {
+          lv_color_t color;
+          color.full = (uint16_t) (dsc->data[i * 2] | (dsc->data[i * 2 + 1] << 8));
+          if (recolor_opa > LV_OPA_TRANSP) color = lv_color_mix(recolor, color, recolor_opa);
+          blend_px(ctx, x, y, color, img_opa);
+          break;
+        }
+        case LV_IMG_CF_TRUE_COLOR_ALPHA: {
+          lv_color_t color;
+          color.full = (uint16_t) (dsc->data[i * 3] | (dsc->data[i * 3 + 1] << 8));
+          if (recolor_opa > LV_OPA_TRANSP) color = lv_color_mix(recolor, color, recolor_opa);
+          blend_px(ctx, x, y, color, opa_mix(dsc->data[i * 3 + 2], img_opa));
+          break;
+        }
+        default:
+          return;
+      }
+    }
+  }
+}
+
+void draw_arc_obj(const DrawCtx &ctx, const lv_area_t &clip, const lv_obj_t *obj, lv_opa_t opa) {
+  auto *arc = static_cast<const lv_lite_arc_t *>(obj->ext);
+  if (arc == nullptr) return;
+  auto rotate = [arc](uint16_t angle) { return (uint16_t) ((angle + arc->rotation) % 360); };
+
+  draw_arc(ctx, clip, obj->coords, rotate(arc->bg_start), rotate(arc->bg_end),
+           style_coord(obj, LV_PART_MAIN, LITE_PROP_ARC_WIDTH),
+           lv_lite_style_num(obj, LV_PART_MAIN, LITE_PROP_ARC_ROUNDED) != 0,
+           style_color(obj, LV_PART_MAIN, LITE_PROP_ARC_COLOR), style_opa(obj, LV_PART_MAIN, LITE_PROP_ARC_OPA, opa));
+
+  lv_coord_t ind_width = style_coord(obj, LV_PART_INDICATOR, LITE_PROP_ARC_WIDTH);
+  draw_arc(ctx, clip, obj->coords, rotate(arc->ind_start), rotate(arc->ind_end), ind_width,
+           lv_lite_style_num(obj, LV_PART_INDICATOR, LITE_PROP_ARC_ROUNDED) != 0,
+           style_color(obj, LV_PART_INDICATOR, LITE_PROP_ARC_COLOR),
+           style_opa(obj, LV_PART_INDICATOR, LITE_PROP_ARC_OPA, opa));
+
+  lv_opa_t knob_opa = style_opa(obj, LV_PART_KNOB, LITE_PROP_BG_OPA, opa);
+  if (knob_opa == LV_OPA_TRANSP) return;
+  float cx = (obj->coords.x1 + obj->coords.x2 + 1) / 2.0f;
+  float cy = (obj->coords.y1 + obj->coords.y2 + 1) / 2.0f;
+  float r_out = (lv_obj_get_width(obj) < lv_obj_get_height(obj) ? lv_obj_get_width(obj) : lv_obj_get_height(obj)) /
+                2.0f;
+  float r_mid = r_out - ind_width / 2.0f;
+  float rad = rotate(arc->ind_end) * (float) M_PI / 180.0f;
+  fill_circle(ctx, clip, cx + r_mid * std::cos(rad), cy + r_mid * std::sin(rad),
+              ind_width / 2.0f + style_coord(obj, LV_PART_KNOB, LITE_PROP_PAD_LEFT),
+              style_color(obj, LV_PART_KNOB, LITE_PROP_BG_COLOR), knob_opa);
+}
+
+void draw_obj(const DrawCtx &ctx, const lv_area_t &clip, const lv_obj_t *obj, lv_opa_t parent_opa) {
+  if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+  lv_coord_t ext = lv_lite_ext_draw_size(obj);
+  lv_area_t ext_area = {(lv_coord_t) (obj->coords.x1 - ext), (lv_coord_t) (obj->coords.y1 - ext),
+                        (lv_coord_t) (obj->coords.x2 + ext), (lv_coord_t) (obj->coords.y2 + ext)};
+  lv_area_t touched;
+  if (!_lv_area_intersect(&touched, &clip, &ext_area)) return;
+  lv_opa_t opa = style_opa(obj, LV_PART_MAIN, LITE_PROP_OPA, parent_opa);
+  if (opa == LV_OPA_TRANSP) return;
+
+  lv_coord_t radius = style_coord(obj, LV_PART_MAIN, LITE_PROP_RADIUS);
+
+  // Shadow: a faint halo of half its width
+  lv_coord_t shadow = style_coord(obj, LV_PART_MAIN, LITE_PROP_SHADOW_WIDTH);
+  if (shadow > 0) {
+    lv_coord_t grow = (lv_coord_t) (shadow / 2);
+    lv_area_t halo = {(lv_coord_t) (obj->coords.x1 - grow), (lv_coord_t) (obj->coords.y1 - grow),
+                      (lv_coord_t) (obj->coords.x2 + grow), (lv_coord_t) (obj->coords.y2 + grow)};
+    lv_opa_t shadow_opa = style_opa(obj, LV_PART_MAIN, LITE_PROP_SHADOW_OPA, opa);
+    fill_rounded(ctx, clip, halo, (lv_coord_t) (clamp_radius(obj->coords, radius) + grow),
+                 style_color(obj, LV_PART_MAIN, LITE_PROP_SHADOW_COLOR), (lv_opa_t) (shadow_opa / 4));
+  }
+
+  fill_rounded(ctx, clip, obj->coords, radius, style_color(obj, LV_PART_MAIN, LITE_PROP_BG_COLOR),
+               style_opa(obj, LV_PART_MAIN, LITE_PROP_BG_OPA, opa));
+
+  if (obj->class_p == &lv_img_class) draw_img(ctx, clip, obj, opa);
+  if (obj->class_p == &lv_label_class) draw_label(ctx, clip, obj, opa);
+  if (obj->class_p == &lv_arc_class) draw_arc_obj(ctx, clip, obj, opa);
+
+  draw_ring(ctx, clip, obj->coords, radius, style_coord(obj, LV_PART_MAIN, LITE_PROP_BORDER_WIDTH),
+            style_color(obj, LV_PART_MAIN, LITE_PROP_BORDER_COLOR),
+            style_opa(obj, LV_PART_MAIN, LITE_PROP_BORDER_OPA, opa));
+
+  lv_coord_t outline = style_coord(obj, LV_PART_MAIN, LITE_PROP_OUTLINE_WIDTH);
+  if (outline > 0) {
+    lv_coord_t grow = (lv_coord_t) (outline + style_coord(obj, LV_PART_MAIN, LITE_PROP_OUTLINE_PAD));
+    lv_area_t outer = {(lv_coord_t) (obj->coords.x1 - grow), (lv_coord_t) (obj->coords.y1 - grow),
+                       (lv_coord_t) (obj->coords.x2 + grow), (lv_coord_t) (obj->coords.y2 + grow)};
+    draw_ring(ctx, clip, outer, (lv_coord_t) (clamp_radius(obj->coords, radius) + grow), outline,
+              style_color(obj, LV_PART_MAIN, LITE_PROP_OUTLINE_COLOR), opa);
+  }
+
+  if (obj->child_cnt == 0) return;
+  lv_area_t child_clip = clip;
+  if (!lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE) && !_lv_area_intersect(&child_clip, &clip, &obj->coords)) {
+    return;
+  }
+  for (uint32_t i = 0; i < obj->child_cnt; i++) draw_obj(ctx, child_clip, obj->children[i], opa);
+}
+
+}  // namespace
+
+void lv_lite_draw_area(lv_disp_t *disp, const lv_area_t *area, lv_color_t *buf) {
+  DrawCtx ctx{buf, *area, lv_area_get_width(area)};
+  // What shows through a transparent screen
+  uint32_t count = lv_area_get_size(area);
+  lv_color_t white = lv_color_white();
+  for (uint32_t i = 0; i < count; i++) buf[i] = white;
+
+  for (lv_obj_t *layer : {disp->act_scr, disp->top_layer, disp->sys_layer}) {
+    if (layer != nullptr) draw_obj(ctx, *area, layer, LV_OPA_COVER);
+  }
+}
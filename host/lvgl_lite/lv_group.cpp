@@ -0,0 +1,192 @@
+/**
+ * @file lv_group.cpp
+ * @brief Focus groups and input devices (encoders)
+ */
+
+#include "lv_lite_private.h"
+#include <cstring>
+
+namespace {
+lv_group_t *group_def = nullptr;
+lv_indev_t *indev_head = nullptr;
+}  // namespace
+
+/*********************
+ * Groups
+ *********************/
+
+lv_group_t *lv_group_create(void) {
+  auto *group = static_cast<lv_group_t *>(lv_mem_alloc(sizeof(lv_group_t)));
+  memset(group, 0, sizeof(*group));
+  group->wrap = 1;
+  return group;
+}
+
+void lv_group_del(lv_group_t *group) {
+  for (uint32_t i = 0; i < group->obj_cnt; i++) group->objs[i]->group_p = nullptr;
+  for (lv_indev_t *indev = indev_head; indev != nullptr; indev = indev->next) {
+    if (indev->group == group) indev->group = nullptr;
+  }
+  if (group_def == group) group_def = nullptr;
+  lv_mem_free(group->objs);
+  lv_mem_free(group);
+}
+
+void lv_group_set_default(lv_group_t *group) { group_def = group; }
+lv_group_t *lv_group_get_default(void) { return group_def; }
+
+static void focus(lv_group_t *group, lv_obj_t *obj) {
+  if (group->obj_focus == obj) return;
+  lv_obj_t *old = group->obj_focus;
+  if (old != nullptr) {
+    lv_obj_clear_state(old, LV_STATE_FOCUSED | LV_STATE_FOCUS_KEY);
+    lv_event_send(old, LV_EVENT_DEFOCUSED, nullptr);
+  }
+  group->obj_focus = obj;
+  if (obj != nullptr) {
+    lv_obj_add_state(obj, LV_STATE_FOCUSED | LV_STATE_FOCUS_KEY);
+    lv_event_send(obj, LV_EVENT_FOCUSED, nullptr);
+  }
+}
+
+void lv_group_add_obj(lv_group_t *group, lv_obj_t *obj) {
+  if (obj->group_p == group) return;
+  if (obj->group_p != nullptr) lv_group_remove_obj(obj);
+  group->objs = static_cast<lv_obj_t **>(lv_mem_realloc(group->objs, sizeof(lv_obj_t *) * (group->obj_cnt + 1)));
+  group->objs[group->obj_cnt++] = obj;
+  obj->group_p = group;
+  // The first object gets the focus
+  if (group->obj_cnt == 1) focus(group, obj);
+}
+
+void lv_group_remove_obj(lv_obj_t *obj) {
+  lv_group_t *group = obj->group_p;
+  if (group == nullptr) return;
+  if (group->obj_focus == obj) {
+    lv_obj_clear_state(obj, LV_STATE_FOCUSED | LV_STATE_FOCUS_KEY);
+    group->obj_focus = nullptr;
+  }
+  for (uint32_t i = 0; i < group->obj_cnt; i++) {
+    if (group->objs[i] != obj) continue;
+    memmove(&group->objs[i], &group->objs[i + 1], sizeof(lv_obj_t *) * (group->obj_cnt - i - 1));
+    group->obj_cnt--;
+    break;
+  }
+  obj->group_p = nullptr;
+  if (group->obj_focus == nullptr && group->obj_cnt > 0) focus(group, group->objs[0]);
+}
+
+void lv_lite_group_forget_obj(lv_obj_t *obj) { lv_group_remove_obj(obj); }
+
+void lv_group_focus_obj(lv_obj_t *obj) {
+  if (obj == nullptr || obj->group_p == nullptr) return;
+  focus(obj->group_p, obj);
+}
+
+// Next or previous object that isn't hidden, wrapping around if the group does
+static void focus_step(lv_group_t *group, int step) {
+  if (group->obj_cnt == 0) return;
+  int32_t count = (int32_t) group->obj_cnt;
+  int32_t index = -1;
+  for (int32_t i = 0; i < count; i++) {
+    if (group->objs[i] == group->obj_focus) index = i;
+  }
+  for (int32_t tries = 0; tries < count; tries++) {
+    if (index < 0) {
+      index = step > 0 ? 0 : count - 1;
+    } else {
+      index += step;
+      if (index >= count || index < 0) {
+        if (!group->wrap) return;
+        index = (index + count) % count;
+      }
+    }
+    if (!lv_obj_has_flag(group->objs[index], LV_OBJ_FLAG_HIDDEN)) {
+      focus(group, group->objs[index]);
+      return;
+    }
+  }
+}
+
+void lv_group_focus_next(lv_group_t *group) { focus_step(group, 1); }
+void lv_group_focus_prev(lv_group_t *group) { focus_step(group, -1); }
+void lv_group_set_wrap(lv_group_t *group, bool en) { group->wrap = en ? 1 : 0; }
+lv_obj_t *lv_group_get_focused(const lv_group_t *group) { return group == nullptr ? nullptr : group->obj_focus; }
+uint32_t lv_group_get_obj_count(lv_group_t *group) { return group->obj_cnt; }
+
+/*********************
+ * Input devices
+ *********************/
+
+void lv_indev_drv_init(lv_indev_drv_t *driver) {
+  memset(driver, 0, sizeof(*driver));
+  driver->type = LV_INDEV_TYPE_NONE;
+}
+
+lv_indev_t *lv_indev_drv_register(lv_indev_drv_t *driver) {
+  if (driver->disp == nullptr) driver->disp = lv_disp_get_default();
+  auto *indev = static_cast<lv_indev_t *>(lv_mem_alloc(sizeof(lv_indev_t)));
+  memset(indev, 0, sizeof(*indev));
+  indev->driver = driver;
+  driver->read_timer = lv_timer_create(lv_indev_read_timer_cb, LV_INDEV_DEF_READ_PERIOD, indev);
+
+  lv_indev_t **tail = &indev_head;
+  while (*tail != nullptr) tail = &(*tail)->next;
+  *tail = indev;
+  return indev;
+}
+
+void lv_lite_indev_reset(void) { indev_head = nullptr; }
+
+lv_indev_t *lv_indev_get_next(lv_indev_t *indev) { return indev == nullptr ? indev_head : indev->next; }
+lv_indev_type_t lv_indev_get_type(const lv_indev_t *indev) { return indev->driver->type; }
+void lv_indev_set_group(lv_indev_t *indev, lv_group_t *group) { indev->group = group; }
+
+// Encoder: steps move the focus, a press and release clicks the focused object
+static void encoder_proc(lv_indev_t *indev, const lv_indev_data_t *data) {
+  lv_group_t *group = indev->group;
+  if (group == nullptr) return;
+
+  for (int16_t i = 0; i < data->enc_diff; i++) lv_group_focus_next(group);
+  for (int16_t i = 0; i > data->enc_diff; i--) lv_group_focus_prev(group);
+
+  lv_obj_t *focused = group->obj_focus;
+  if (data->state == LV_INDEV_STATE_PRESSED && indev->last_state == LV_INDEV_STATE_RELEASED) {
+    indev->pr_timestamp = lv_tick_get();
+    indev->long_pr_sent = 0;
+    if (focused != nullptr) {
+      lv_obj_add_state(focused, LV_STATE_PRESSED);
+      lv_event_send(focused, LV_EVENT_PRESSED, nullptr);
+    }
+  } else if (data->state == LV_INDEV_STATE_PRESSED) {
+    if (!indev->long_pr_sent && lv_tick_elaps(indev->pr_timestamp) >= LV_INDEV_DEF_LONG_PRESS_TIME) {
+      indev->long_pr_sent = 1;
+      if (focused != nullptr) lv_event_send(focused, LV_EVENT_LONG_PRESSED, nullptr);
+    }
+  } else if (indev->last_state == LV_INDEV_STATE_PRESSED) {
+    if (focused != nullptr) {
+      lv_obj_clear_state(focused, LV_STATE_PRESSED);
+      lv_event_send(focused, LV_EVENT_RELEASED, nullptr);
+      if (!indev->long_pr_sent) {
+        lv_event_send(focused, LV_EVENT_SHORT_CLICKED, nullptr);
+        lv_event_send(focused, LV_EVENT_CLICKED, nullptr);
+      }
+    }
+  }
+  indev->last_state = data->state;
+}
+
+void lv_indev_read_timer_cb(lv_timer_t *timer) {
+  auto *indev = static_cast<lv_indev_t *>(timer->user_data);
+  lv_indev_data_t data;
+  do {
+    memset(&data, 0, sizeof(data));
+    data.state = indev->last_state;
+    indev->driver->read_cb(indev->driver, &data);
+    if (data.enc_diff != 0 || data.state != indev->last_state) {
+      lv_disp_t *disp = indev->driver->disp;
+      if (disp != nullptr) disp->last_activity_time = lv_tick_get();
+    }
+    if (indev->driver->type == LV_INDEV_TYPE_ENCODER) encoder_proc(indev, &data);
+  } while (data.continue_reading);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file lv_lite_private.h
+ * @brief Internals shared by the LVGL subset's modules
+ */
+#pragma once
+
+#include "lvgl.h"
+
+// Style properties the subset knows
+enum lv_lite_prop_t : uint16_t {
+  LITE_PROP_BG_COLOR,
+  LITE_PROP_BG_OPA,
+  LITE_PROP_BORDER_COLOR,
+  LITE_PROP_BORDER_WIDTH,
+  LITE_PROP_BORDER_OPA,
+  LITE_PROP_RADIUS,
+  LITE_PROP_CLIP_CORNER,
+  LITE_PROP_SHADOW_WIDTH,
+  LITE_PROP_SHADOW_COLOR,
+  LITE_PROP_SHADOW_OPA,
+  LITE_PROP_OUTLINE_WIDTH,
+  LITE_PROP_OUTLINE_COLOR,
+  LITE_PROP_OUTLINE_PAD,
+  LITE_PROP_PAD_TOP,
+  LITE_PROP_PAD_BOTTOM,
+  LITE_PROP_PAD_LEFT,
+  LITE_PROP_PAD_RIGHT,
+  LITE_PROP_TEXT_COLOR,
+  LITE_PROP_TEXT_FONT,
+  LITE_PROP_TEXT_ALIGN,
+  LITE_PROP_ARC_COLOR,
+  LITE_PROP_ARC_WIDTH,
+  LITE_PROP_ARC_OPA,
+  LITE_PROP_ARC_ROUNDED,
+  LITE_PROP_OPA,
+  LITE_PROP_IMG_OPA,
+  LITE_PROP_IMG_RECOLOR,
+  LITE_PROP_IMG_RECOLOR_OPA,
+};
+
+typedef struct {
+  char *text;
+  uint8_t static_txt;
+  lv_label_long_mode_t long_mode;
+} lv_lite_label_t;
+
+typedef struct {
+  uint16_t rotation;
+  uint16_t bg_start;
+  uint16_t bg_end;
+  uint16_t ind_start;
+  uint16_t ind_end;
+  int16_t value;
+  int16_t min;
+  int16_t max;
+} lv_lite_arc_t;
+
+typedef struct {
+  const void *src;
+} lv_lite_img_t;
+
+// Styles (lv_obj.cpp)
+int32_t lv_lite_style_num(const lv_obj_t *obj, lv_part_t part, lv_lite_prop_t prop);
+const void *lv_lite_style_ptr(const lv_obj_t *obj, lv_part_t part, lv_lite_prop_t prop);
+static inline lv_color_t lv_lite_style_color(const lv_obj_t *obj, lv_part_t part, lv_lite_prop_t prop) {
+  lv_color_t color;
+  color.full = (uint16_t) lv_lite_style_num(obj, part, prop);
+  return color;
+}
+// How far the drawing reaches out of the coordinates (shadow, outline, knob)
+lv_coord_t lv_lite_ext_draw_size(const lv_obj_t *obj);
+// Width of a text in a font, without wrapping
+lv_coord_t lv_lite_text_width(const char *text, const lv_font_t *font);
+// Next UTF-8 code point of *text, advancing it; 0 at the end
+uint32_t lv_lite_next_letter(const char **text);
+lv_coord_t lv_lite_letter_width(uint32_t letter, const lv_font_t *font);
+
+// Screen creation and teardown hooks (lv_disp.cpp)
+void lv_lite_disp_add_screen(lv_disp_t *disp, lv_obj_t *scr);
+void lv_lite_disp_remove_screen(lv_disp_t *disp, lv_obj_t *scr);
+
+// Renders one area of the active screen into draw_buf->buf_act (lv_draw.cpp)
+void lv_lite_draw_area(lv_disp_t *disp, const lv_area_t *area, lv_color_t *buf);
+
+// Indev list (lv_group.cpp)
+void lv_lite_indev_reset(void);
+void lv_lite_group_forget_obj(lv_obj_t *obj);
@@ -0,0 +1,897 @@
+/**
+ * @file lv_obj.cpp
+ * @brief Objects, styles, geometry, events and the widgets dial_menu uses
+ */
+
+#include "lv_lite_private.h"
+#include <cstring>
+
+const lv_obj_class_t lv_obj_class = {nullptr, "obj"};
+const lv_obj_class_t lv_btn_class = {&lv_obj_class, "btn"};
+const lv_obj_class_t lv_label_class = {&lv_obj_class, "label"};
+const lv_obj_class_t lv_arc_class = {&lv_obj_class, "arc"};
+const lv_obj_class_t lv_img_class = {&lv_obj_class, "img"};
+
+// Line heights and base lines of LVGL's Montserrat builds
+const lv_font_t lv_font_montserrat_14 = {16, 3, 8, nullptr, nullptr, nullptr};
+const lv_font_t lv_font_montserrat_18 = {20, 4, 10, nullptr, nullptr, nullptr};
+const lv_font_t lv_font_montserrat_28 = {30, 5, 16, nullptr, nullptr, nullptr};
+const lv_font_t lv_font_montserrat_48 = {49, 9, 28, nullptr, nullptr, nullptr};
+
+// LV_DPX() of the default theme at 130 dpi
+static lv_coord_t dpx(lv_coord_t n) { return (lv_coord_t) ((n * 130 + 80) / 160); }
+
+static const uint32_t PALETTE_BLUE = 0x2196F3;
+static const uint32_t PALETTE_GREY = 0xE0E0E0;
+static const uint32_t TEXT_DARK = 0x212121;
+
+/*********************
+ * Text
+ *********************/
+
+uint32_t lv_lite_next_letter(const char **text) {
+  auto *s = reinterpret_cast<const uint8_t *>(*text);
+  if (*s == 0) return 0;
+  uint32_t letter;
+  int extra;
+  if (s[0] < 0x80) {
+    letter = s[0];
+    extra = 0;
+  } else if ((s[0] & 0xE0) == 0xC0) {
+    letter = s[0] & 0x1F;
+    extra = 1;
+  } else if ((s[0] & 0xF0) == 0xE0) {
+    letter = s[0] & 0x0F;
+    extra = 2;
+  } else {
+    letter = s[0] & 0x07;
+    extra = 3;
+  }
+  int used = 1;
+  for (int i = 0; i < extra && (s[used] & 0xC0) == 0x80; i++) letter = (letter << 6) | (s[used++] & 0x3F);
+  *text += used;
+  return letter;
+}
+
+lv_coord_t lv_lite_letter_width(uint32_t letter, const lv_font_t *font) {
+  if (letter == ' ') return (lv_coord_t) (font->glyph_width / 2);
+  // Symbols (FontAwesome's private use area) are square
+  if (letter >= 0xF000 && letter <= 0xF8FF) return font->line_height;
+  return font->glyph_width;
+}
+
+lv_coord_t lv_lite_text_width(const char *text, const lv_font_t *font) {
+  if (text == nullptr) return 0;
+  lv_coord_t width = 0;
+  lv_coord_t line = 0;
+  uint32_t letter;
+  while ((letter = lv_lite_next_letter(&text)) != 0) {
+    if (letter == '\n') {
+      if (line > width) width = line;
+      line = 0;
+      continue;
+    }
+    line = (lv_coord_t) (line + lv_lite_letter_width(letter, font));
+  }
+  return line > width ? line : width;
+}
+
+static uint32_t text_line_count(const char *text) {
+  if (text == nullptr) return 1;
+  uint32_t lines = 1;
+  for (const char *c = text; *c != 0; c++) {
+    if (*c == '\n') lines++;
+  }
+  return lines;
+}
+
+/*********************
+ * Styles
+ *********************/
+
+static bool prop_inherits(lv_lite_prop_t prop) {
+  return prop == LITE_PROP_TEXT_COLOR || prop == LITE_PROP_TEXT_FONT || prop == LITE_PROP_TEXT_ALIGN;
+}
+
+static int32_t prop_default_num(lv_lite_prop_t prop) {
+  switch (prop) {
+    case LITE_PROP_OPA:
+    case LITE_PROP_IMG_OPA:
+    case LITE_PROP_ARC_OPA:
+    case LITE_PROP_BORDER_OPA:
+      return LV_OPA_COVER;
+    case LITE_PROP_BG_COLOR:
+      return lv_color_white().full;
+    case LITE_PROP_SHADOW_OPA:
+      return LV_OPA_COVER;
+    case LITE_PROP_ARC_WIDTH:
+      return 0;
+    default:
+      return 0;
+  }
+}
+
+static const _lv_obj_style_t *find_style(const lv_obj_t *obj, lv_part_t part, lv_lite_prop_t prop) {
+  const _lv_obj_style_t *found = nullptr;
+  for (uint32_t i = 0; i < obj->style_cnt; i++) {
+    const _lv_obj_style_t *style = &obj->styles[i];
+    if (style->prop != prop || (style->selector & LV_PART_ANY) != part) continue;
+    lv_state_t state = (lv_state_t) (style->selector & 0xFFFF);
+    if ((state & ~obj->state) != 0) continue;
+    // Local values over the theme, state specific over the default state
+    if (found == nullptr || (found->is_theme && !style->is_theme) ||
+        (found->is_theme == style->is_theme && state != 0)) {
+      found = style;
+    }
+  }
+  return found;
+}
+
+int32_t lv_lite_style_num(const lv_obj_t *obj, lv_part_t part, lv_lite_prop_t prop) {
+  for (const lv_obj_t *o = obj; o != nullptr; o = o->parent) {
+    const _lv_obj_style_t *style = find_style(o, o == obj ? part : LV_PART_MAIN, prop);
+    if (style != nullptr) return style->num;
+    if (!prop_inherits(prop)) break;
+  }
+  if (prop == LITE_PROP_TEXT_COLOR) return lv_color_hex(TEXT_DARK).full;
+  return prop_default_num(prop);
+}
+
+const void *lv_lite_style_ptr(const lv_obj_t *obj, lv_part_t part, lv_lite_prop_t prop) {
+  for (const lv_obj_t *o = obj; o != nullptr; o = o->parent) {
+    const _lv_obj_style_t *style = find_style(o, o == obj ? part : LV_PART_MAIN, prop);
+    if (style != nullptr) return style->ptr;
+    if (!prop_inherits(prop)) break;
+  }
+  return prop == LITE_PROP_TEXT_FONT ? LV_FONT_DEFAULT : nullptr;
+}
+
+lv_coord_t lv_lite_ext_draw_size(const lv_obj_t *obj) {
+  lv_coord_t size = 0;
+  lv_coord_t shadow = (lv_coord_t) lv_lite_style_num(obj, LV_PART_MAIN, LITE_PROP_SHADOW_WIDTH);
+  if (shadow > 0 && lv_lite_style_num(obj, LV_PART_MAIN, LITE_PROP_SHADOW_OPA) > LV_OPA_TRANSP) {
+    size = (lv_coord_t) (shadow / 2 + 1);
+  }
+  lv_coord_t outline = (lv_coord_t) lv_lite_style_num(obj, LV_PART_MAIN, LITE_PROP_OUTLINE_WIDTH);
+  if (outline > 0) {
+    outline = (lv_coord_t) (outline + lv_lite_style_num(obj, LV_PART_MAIN, LITE_PROP_OUTLINE_PAD));
+    if (outline > size) size = outline;
+  }
+  if (obj->class_p == &lv_arc_class && lv_lite_style_num(obj, LV_PART_KNOB, LITE_PROP_BG_OPA) > LV_OPA_TRANSP) {
+    lv_coord_t knob = (lv_coord_t) lv_lite_style_num(obj, LV_PART_KNOB, LITE_PROP_PAD_LEFT);
+    if (knob > size) size = knob;
+  }
+  return size;
+}
+
+static void refresh_coords(lv_obj_t *obj);
+
+static bool prop_changes_layout(lv_lite_prop_t prop) {
+  switch (prop) {
+    case LITE_PROP_PAD_TOP:
+    case LITE_PROP_PAD_BOTTOM:
+    case LITE_PROP_PAD_LEFT:
+    case LITE_PROP_PAD_RIGHT:
+    case LITE_PROP_BORDER_WIDTH:
+    case LITE_PROP_TEXT_FONT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static void set_style(lv_obj_t *obj, lv_style_selector_t selector, lv_lite_prop_t prop, int32_t num, const void *ptr,
+                      bool is_theme) {
+  _lv_obj_style_t *slot = nullptr;
+  for (uint32_t i = 0; i < obj->style_cnt; i++) {
+    _lv_obj_style_t *style = &obj->styles[i];
+    if (style->prop == prop && style->selector == selector && style->is_theme == is_theme) {
+      slot = style;
+      break;
+    }
+  }
+  // Like LVGL, setting a style redraws the object even if the value is the same:
+  // before and after, the change may shrink or grow what the object covers. The
+  // theme is applied while the object is created, before it is placed.
+  if (!is_theme) lv_obj_invalidate(obj);
+  if (slot == nullptr) {
+    obj->styles = static_cast<_lv_obj_style_t *>(
+        lv_mem_realloc(obj->styles, sizeof(_lv_obj_style_t) * (obj->style_cnt + 1)));
+    slot = &obj->styles[obj->style_cnt++];
+    slot->selector = selector;
+    slot->prop = prop;
+    slot->is_theme = is_theme;
+  }
+  slot->num = num;
+  slot->ptr = ptr;
+  if (is_theme) return;
+  if (prop_changes_layout(prop) || prop_inherits(prop)) refresh_coords(obj);
+  lv_obj_invalidate(obj);
+}
+
+static void set_theme(lv_obj_t *obj, lv_style_selector_t selector, lv_lite_prop_t prop, int32_t num) {
+  set_style(obj, selector, prop, num, nullptr, true);
+}
+
+#define LITE_STYLE_SETTER(name, type, prop) \
+  void lv_obj_set_style_##name(lv_obj_t *obj, type value, lv_style_selector_t selector) { \
+    set_style(obj, selector, prop, (int32_t) value, nullptr, false); \
+  }
+#define LITE_STYLE_COLOR_SETTER(name, prop) \
+  void lv_obj_set_style_##name(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector) { \
+    set_style(obj, selector, prop, value.full, nullptr, false); \
+  }
+
+LITE_STYLE_COLOR_SETTER(bg_color, LITE_PROP_BG_COLOR)
+LITE_STYLE_SETTER(bg_opa, lv_opa_t, LITE_PROP_BG_OPA)
+LITE_STYLE_COLOR_SETTER(border_color, LITE_PROP_BORDER_COLOR)
+LITE_STYLE_SETTER(border_width, lv_coord_t, LITE_PROP_BORDER_WIDTH)
+LITE_STYLE_SETTER(border_opa, lv_opa_t, LITE_PROP_BORDER_OPA)
+LITE_STYLE_SETTER(radius, lv_coord_t, LITE_PROP_RADIUS)
+LITE_STYLE_SETTER(clip_corner, bool, LITE_PROP_CLIP_CORNER)
+LITE_STYLE_SETTER(shadow_width, lv_coord_t, LITE_PROP_SHADOW_WIDTH)
+LITE_STYLE_COLOR_SETTER(shadow_color, LITE_PROP_SHADOW_COLOR)
+LITE_STYLE_SETTER(shadow_opa, lv_opa_t, LITE_PROP_SHADOW_OPA)
+LITE_STYLE_SETTER(outline_width, lv_coord_t, LITE_PROP_OUTLINE_WIDTH)
+LITE_STYLE_COLOR_SETTER(outline_color, LITE_PROP_OUTLINE_COLOR)
+LITE_STYLE_SETTER(outline_pad, lv_coord_t, LITE_PROP_OUTLINE_PAD)
+LITE_STYLE_SETTER(pad_top, lv_coord_t, LITE_PROP_PAD_TOP)
+LITE_STYLE_SETTER(pad_bottom, lv_coord_t, LITE_PROP_PAD_BOTTOM)
+LITE_STYLE_SETTER(pad_left, lv_coord_t, LITE_PROP_PAD_LEFT)
+LITE_STYLE_SETTER(pad_right, lv_coord_t, LITE_PROP_PAD_RIGHT)
+LITE_STYLE_COLOR_SETTER(text_color, LITE_PROP_TEXT_COLOR)
+LITE_STYLE_SETTER(text_align, lv_text_align_t, LITE_PROP_TEXT_ALIGN)
+LITE_STYLE_COLOR_SETTER(arc_color, LITE_PROP_ARC_COLOR)
+LITE_STYLE_SETTER(arc_width, lv_coord_t, LITE_PROP_ARC_WIDTH)
+LITE_STYLE_SETTER(arc_opa, lv_opa_t, LITE_PROP_ARC_OPA)
+LITE_STYLE_SETTER(arc_rounded, bool, LITE_PROP_ARC_ROUNDED)
+LITE_STYLE_SETTER(opa, lv_opa_t, LITE_PROP_OPA)
+LITE_STYLE_SETTER(img_opa, lv_opa_t, LITE_PROP_IMG_OPA)
+LITE_STYLE_COLOR_SETTER(img_recolor, LITE_PROP_IMG_RECOLOR)
+LITE_STYLE_SETTER(img_recolor_opa, lv_opa_t, LITE_PROP_IMG_RECOLOR_OPA)
+
+void lv_obj_set_style_text_font(lv_obj_t *obj, const lv_font_t *value, lv_style_selector_t selector) {
+  set_style(obj, selector, LITE_PROP_TEXT_FONT, 0, value, false);
+}
+
+void lv_obj_remove_style(lv_obj_t *obj, lv_style_t *style, lv_style_selector_t selector) {
+  // Only NULL (every style of the selector) is supported, nothing adds lv_style_t
+  if (style != nullptr) return;
+  lv_part_t part = selector & LV_PART_ANY;
+  lv_state_t state = (lv_state_t) (selector & 0xFFFF);
+  lv_obj_invalidate(obj);
+  uint32_t kept = 0;
+  for (uint32_t i = 0; i < obj->style_cnt; i++) {
+    _lv_obj_style_t *entry = &obj->styles[i];
+    bool part_match = part == LV_PART_ANY || (entry->selector & LV_PART_ANY) == part;
+    bool state_match = state == LV_STATE_ANY || (entry->selector & 0xFFFF) == state;
+    if (part_match && state_match) continue;
+    obj->styles[kept++] = *entry;
+  }
+  obj->style_cnt = kept;
+  refresh_coords(obj);
+  lv_obj_invalidate(obj);
+}
+
+void lv_obj_remove_style_all(lv_obj_t *obj) { lv_obj_remove_style(obj, nullptr, (lv_style_selector_t) LV_PART_ANY | LV_STATE_ANY); }
+
+/*********************
+ * Creation and tree
+ *********************/
+
+static lv_obj_t *obj_create(const lv_obj_class_t *class_p, lv_obj_t *parent) {
+  auto *obj = static_cast<lv_obj_t *>(lv_mem_alloc(sizeof(lv_obj_t)));
+  memset(obj, 0, sizeof(*obj));
+  obj->class_p = class_p;
+  obj->parent = parent;
+  obj->flags = LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ELASTIC |
+               LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_CHAIN_HOR | LV_OBJ_FLAG_SCROLL_CHAIN_VER |
+               LV_OBJ_FLAG_SCROLL_ON_FOCUS | LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_PRESS_LOCK |
+               LV_OBJ_FLAG_CLICK_FOCUSABLE;
+
+  if (parent == nullptr) {
+    lv_disp_t *disp = lv_disp_get_default();
+    obj->disp = disp;
+    if (disp != nullptr) {
+      lv_lite_disp_add_screen(disp, obj);
+      obj->coords.x2 = (lv_coord_t) (disp->driver->hor_res - 1);
+      obj->coords.y2 = (lv_coord_t) (disp->driver->ver_res - 1);
+    }
+    obj->w_set = (lv_coord_t) (obj->coords.x2 + 1);
+    obj->h_set = (lv_coord_t) (obj->coords.y2 + 1);
+    // Default theme, light mode
+    set_theme(obj, LV_PART_MAIN, LITE_PROP_BG_COLOR, lv_color_white().full);
+    set_theme(obj, LV_PART_MAIN, LITE_PROP_BG_OPA, LV_OPA_COVER);
+    set_theme(obj, LV_PART_MAIN, LITE_PROP_TEXT_COLOR, lv_color_hex(TEXT_DARK).full);
+    return obj;
+  }
+
+  parent->children = static_cast<lv_obj_t **>(
+      lv_mem_realloc(parent->children, sizeof(lv_obj_t *) * (parent->child_cnt + 1)));
+  parent->children[parent->child_cnt++] = obj;
+  obj->w_set = dpx(100);
+  obj->h_set = dpx(100);
+  return obj;
+}
+
+// Placed and drawn once the widget's defaults are in
+static lv_obj_t *obj_created(lv_obj_t *obj) {
+  if (obj->parent != nullptr) {
+    refresh_coords(obj);
+    lv_obj_invalidate(obj);
+  }
+  return obj;
+}
+
+static void card_theme(lv_obj_t *obj) {
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_BG_COLOR, lv_color_white().full);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_BG_OPA, LV_OPA_COVER);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_BORDER_COLOR, lv_color_hex(PALETTE_GREY).full);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_BORDER_WIDTH, dpx(2));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_RADIUS, dpx(12));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_PAD_TOP, dpx(24));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_PAD_BOTTOM, dpx(24));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_PAD_LEFT, dpx(24));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_PAD_RIGHT, dpx(24));
+}
+
+lv_obj_t *lv_obj_create(lv_obj_t *parent) {
+  lv_obj_t *obj = obj_create(&lv_obj_class, parent);
+  if (parent != nullptr) card_theme(obj);
+  return obj_created(obj);
+}
+
+lv_obj_t *lv_btn_create(lv_obj_t *parent) {
+  lv_obj_t *obj = obj_create(&lv_btn_class, parent);
+  obj->flags &= ~LV_OBJ_FLAG_SCROLLABLE;
+  obj->flags |= LV_OBJ_FLAG_SCROLL_ON_FOCUS;
+  obj->w_set = LV_SIZE_CONTENT;
+  obj->h_set = LV_SIZE_CONTENT;
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_BG_COLOR, lv_color_hex(PALETTE_BLUE).full);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_BG_OPA, LV_OPA_COVER);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_RADIUS, dpx(12));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_SHADOW_WIDTH, dpx(3));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_SHADOW_OPA, LV_OPA_50);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_SHADOW_COLOR, lv_color_hex(0x9E9E9E).full);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_TEXT_COLOR, lv_color_white().full);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_PAD_TOP, dpx(14));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_PAD_BOTTOM, dpx(14));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_PAD_LEFT, dpx(24));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_PAD_RIGHT, dpx(24));
+  return obj_created(obj);
+}
+
+static void free_ext(lv_obj_t *obj) {
+  if (obj->class_p == &lv_label_class) {
+    auto *label = static_cast<lv_lite_label_t *>(obj->ext);
+    if (label != nullptr && !label->static_txt) lv_mem_free(label->text);
+  }
+  lv_mem_free(obj->ext);
+  obj->ext = nullptr;
+}
+
+void lv_obj_del(lv_obj_t *obj) {
+  lv_obj_invalidate(obj);
+  lv_event_send(obj, LV_EVENT_DELETE, nullptr);
+  while (obj->child_cnt > 0) lv_obj_del(obj->children[obj->child_cnt - 1]);
+  lv_lite_group_forget_obj(obj);
+
+  if (obj->parent != nullptr) {
+    lv_obj_t *parent = obj->parent;
+    for (uint32_t i = 0; i < parent->child_cnt; i++) {
+      if (parent->children[i] != obj) continue;
+      memmove(&parent->children[i], &parent->children[i + 1], sizeof(lv_obj_t *) * (parent->child_cnt - i - 1));
+      parent->child_cnt--;
+      break;
+    }
+  } else if (obj->disp != nullptr) {
+    lv_lite_disp_remove_screen(obj->disp, obj);
+  }
+
+  free_ext(obj);
+  lv_mem_free(obj->children);
+  lv_mem_free(obj->styles);
+  lv_mem_free(obj->event_dsc);
+  lv_mem_free(obj);
+}
+
+void lv_obj_clean(lv_obj_t *obj) {
+  lv_obj_invalidate(obj);
+  while (obj->child_cnt > 0) lv_obj_del(obj->children[obj->child_cnt - 1]);
+}
+
+lv_obj_t *lv_obj_get_parent(const lv_obj_t *obj) { return obj->parent; }
+
+lv_obj_t *lv_obj_get_screen(const lv_obj_t *obj) {
+  while (obj->parent != nullptr) obj = obj->parent;
+  return const_cast<lv_obj_t *>(obj);
+}
+
+lv_disp_t *lv_obj_get_disp(const lv_obj_t *obj) { return lv_obj_get_screen(obj)->disp; }
+
+lv_obj_t *lv_obj_get_child(const lv_obj_t *obj, int32_t id) {
+  if (id < 0) id += (int32_t) obj->child_cnt;
+  if (id < 0 || (uint32_t) id >= obj->child_cnt) return nullptr;
+  return obj->children[id];
+}
+
+uint32_t lv_obj_get_child_cnt(const lv_obj_t *obj) { return obj->child_cnt; }
+
+bool lv_obj_check_type(const lv_obj_t *obj, const lv_obj_class_t *class_p) {
+  return obj != nullptr && obj->class_p == class_p;
+}
+
+bool lv_obj_has_class(const lv_obj_t *obj, const lv_obj_class_t *class_p) {
+  for (const lv_obj_class_t *c = obj->class_p; c != nullptr; c = c->base_class) {
+    if (c == class_p) return true;
+  }
+  return false;
+}
+
+/*********************
+ * Flags and states
+ *********************/
+
+void lv_obj_add_flag(lv_obj_t *obj, lv_obj_flag_t f) {
+  bool was_hidden = lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN);
+  if ((f & LV_OBJ_FLAG_HIDDEN) && !was_hidden) lv_obj_invalidate(obj);
+  obj->flags |= f;
+}
+
+void lv_obj_clear_flag(lv_obj_t *obj, lv_obj_flag_t f) {
+  bool was_hidden = lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN);
+  obj->flags &= ~f;
+  if ((f & LV_OBJ_FLAG_HIDDEN) && was_hidden) lv_obj_invalidate(obj);
+}
+
+bool lv_obj_has_flag(const lv_obj_t *obj, lv_obj_flag_t f) { return (obj->flags & f) == f; }
+
+static void set_state(lv_obj_t *obj, lv_state_t state) {
+  if (obj->state == state) return;
+  lv_obj_invalidate(obj);
+  obj->state = state;
+  lv_obj_invalidate(obj);
+}
+
+void lv_obj_add_state(lv_obj_t *obj, lv_state_t state) { set_state(obj, (lv_state_t) (obj->state | state)); }
+void lv_obj_clear_state(lv_obj_t *obj, lv_state_t state) { set_state(obj, (lv_state_t) (obj->state & ~state)); }
+lv_state_t lv_obj_get_state(const lv_obj_t *obj) { return obj->state; }
+bool lv_obj_has_state(const lv_obj_t *obj, lv_state_t state) { return (obj->state & state) == state; }
+
+/*********************
+ * Geometry
+ *********************/
+
+static lv_coord_t pad(const lv_obj_t *obj, lv_lite_prop_t prop) {
+  return (lv_coord_t) lv_lite_style_num(obj, LV_PART_MAIN, prop);
+}
+
+static lv_coord_t border(const lv_obj_t *obj) { return pad(obj, LITE_PROP_BORDER_WIDTH); }
+
+static const lv_img_dsc_t *img_dsc(const lv_obj_t *obj) {
+  if (obj->class_p != &lv_img_class || obj->ext == nullptr) return nullptr;
+  const void *src = static_cast<lv_lite_img_t *>(obj->ext)->src;
+  // Symbol sources (UTF-8 text) start with a byte >= 0x80, descriptors with the header
+  if (src == nullptr || (*static_cast<const uint8_t *>(src) & 0x80) != 0) return nullptr;
+  return static_cast<const lv_img_dsc_t *>(src);
+}
+
+// Size from the content, for LV_SIZE_CONTENT
+static lv_coord_t self_width(const lv_obj_t *obj) {
+  lv_coord_t frame = (lv_coord_t) (pad(obj, LITE_PROP_PAD_LEFT) + pad(obj, LITE_PROP_PAD_RIGHT) + 2 * border(obj));
+  if (obj->class_p == &lv_label_class) {
+    auto *label = static_cast<lv_lite_label_t *>(obj->ext);
+    auto *font = static_cast<const lv_font_t *>(lv_lite_style_ptr(obj, LV_PART_MAIN, LITE_PROP_TEXT_FONT));
+    return (lv_coord_t) (lv_lite_text_width(label != nullptr ? label->text : nullptr, font) + frame);
+  }
+  if (obj->class_p == &lv_img_class) {
+    const lv_img_dsc_t *dsc = img_dsc(obj);
+    return (lv_coord_t) (dsc != nullptr ? dsc->header.w : 0);
+  }
+  lv_coord_t width = 0;
+  for (uint32_t i = 0; i < obj->child_cnt; i++) {
+    lv_coord_t child = lv_obj_get_width(obj->children[i]);
+    if (child > width) width = child;
+  }
+  return (lv_coord_t) (width + frame);
+}
+
+static lv_coord_t self_height(const lv_obj_t *obj, lv_coord_t width) {
+  lv_coord_t frame = (lv_coord_t) (pad(obj, LITE_PROP_PAD_TOP) + pad(obj, LITE_PROP_PAD_BOTTOM) + 2 * border(obj));
+  if (obj->class_p == &lv_label_class) {
+    auto *label = static_cast<lv_lite_label_t *>(obj->ext);
+    auto *font = static_cast<const lv_font_t *>(lv_lite_style_ptr(obj, LV_PART_MAIN, LITE_PROP_TEXT_FONT));
+    const char *text = label != nullptr ? label->text : nullptr;
+    uint32_t lines = text_line_count(text);
+    // Wrapped to a fixed width
+    if (label != nullptr && label->long_mode == LV_LABEL_LONG_WRAP && obj->w_set != LV_SIZE_CONTENT) {
+      lv_coord_t inner = (lv_coord_t) (width - frame);
+      lv_coord_t text_w = lv_lite_text_width(text, font);
+      if (inner > 0 && text_w > inner) lines = (uint32_t) ((text_w + inner - 1) / inner);
+    }
+    return (lv_coord_t) (lines * font->line_height + frame);
+  }
+  if (obj->class_p == &lv_img_class) {
+    const lv_img_dsc_t *dsc = img_dsc(obj);
+    return (lv_coord_t) (dsc != nullptr ? dsc->header.h : 0);
+  }
+  lv_coord_t height = 0;
+  for (uint32_t i = 0; i < obj->child_cnt; i++) {
+    lv_coord_t child = lv_obj_get_height(obj->children[i]);
+    if (child > height) height = child;
+  }
+  return (lv_coord_t) (height + frame);
+}
+
+// Coordinates from the set geometry and the parent's content area, children included
+static void refresh_coords(lv_obj_t *obj) {
+  lv_obj_t *parent = obj->parent;
+  if (parent != nullptr) {
+    lv_coord_t w = obj->w_set == LV_SIZE_CONTENT ? self_width(obj) : obj->w_set;
+    lv_coord_t h = obj->h_set == LV_SIZE_CONTENT ? self_height(obj, w) : obj->h_set;
+
+    lv_coord_t pb = border(parent);
+    lv_coord_t cx = (lv_coord_t) (parent->coords.x1 + pad(parent, LITE_PROP_PAD_LEFT) + pb);
+    lv_coord_t cy = (lv_coord_t) (parent->coords.y1 + pad(parent, LITE_PROP_PAD_TOP) + pb);
+    lv_coord_t cw = (lv_coord_t) (lv_area_get_width(&parent->coords) - pad(parent, LITE_PROP_PAD_LEFT) -
+                                  pad(parent, LITE_PROP_PAD_RIGHT) - 2 * pb);
+    lv_coord_t ch = (lv_coord_t) (lv_area_get_height(&parent->coords) - pad(parent, LITE_PROP_PAD_TOP) -
+                                  pad(parent, LITE_PROP_PAD_BOTTOM) - 2 * pb);
+
+    lv_coord_t x = obj->x_set;
+    lv_coord_t y = obj->y_set;
+    switch (obj->align) {
+      case LV_ALIGN_TOP_MID:
+        x = (lv_coord_t) (x + cw / 2 - w / 2);
+        break;
+      case LV_ALIGN_TOP_RIGHT:
+        x = (lv_coord_t) (x + cw - w);
+        break;
+      case LV_ALIGN_BOTTOM_LEFT:
+        y = (lv_coord_t) (y + ch - h);
+        break;
+      case LV_ALIGN_BOTTOM_MID:
+        x = (lv_coord_t) (x + cw / 2 - w / 2);
+        y = (lv_coord_t) (y + ch - h);
+        break;
+      case LV_ALIGN_BOTTOM_RIGHT:
+        x = (lv_coord_t) (x + cw - w);
+        y = (lv_coord_t) (y + ch - h);
+        break;
+      case LV_ALIGN_LEFT_MID:
+        y = (lv_coord_t) (y + ch / 2 - h / 2);
+        break;
+      case LV_ALIGN_RIGHT_MID:
+        x = (lv_coord_t) (x + cw - w);
+        y = (lv_coord_t) (y + ch / 2 - h / 2);
+        break;
+      case LV_ALIGN_CENTER:
+        x = (lv_coord_t) (x + cw / 2 - w / 2);
+        y = (lv_coord_t) (y + ch / 2 - h / 2);
+        break;
+      default:
+        break;
+    }
+    obj->coords.x1 = (lv_coord_t) (cx + x);
+    obj->coords.y1 = (lv_coord_t) (cy + y);
+    obj->coords.x2 = (lv_coord_t) (obj->coords.x1 + w - 1);
+    obj->coords.y2 = (lv_coord_t) (obj->coords.y1 + h - 1);
+  }
+  for (uint32_t i = 0; i < obj->child_cnt; i++) refresh_coords(obj->children[i]);
+}
+
+// The parent may size itself to its content
+static void geometry_changed(lv_obj_t *obj) {
+  lv_obj_t *top = obj;
+  while (top->parent != nullptr && top->parent->parent != nullptr &&
+         (top->parent->w_set == LV_SIZE_CONTENT || top->parent->h_set == LV_SIZE_CONTENT)) {
+    top = top->parent;
+  }
+  lv_obj_invalidate(top);
+  refresh_coords(top);
+  lv_obj_invalidate(top);
+}
+
+void lv_obj_set_pos(lv_obj_t *obj, lv_coord_t x, lv_coord_t y) {
+  if (obj->x_set == x && obj->y_set == y) return;
+  obj->x_set = x;
+  obj->y_set = y;
+  geometry_changed(obj);
+}
+
+void lv_obj_set_x(lv_obj_t *obj, lv_coord_t x) { lv_obj_set_pos(obj, x, obj->y_set); }
+void lv_obj_set_y(lv_obj_t *obj, lv_coord_t y) { lv_obj_set_pos(obj, obj->x_set, y); }
+
+void lv_obj_set_size(lv_obj_t *obj, lv_coord_t w, lv_coord_t h) {
+  if (obj->parent == nullptr || (obj->w_set == w && obj->h_set == h)) return;
+  obj->w_set = w;
+  obj->h_set = h;
+  geometry_changed(obj);
+}
+
+void lv_obj_set_width(lv_obj_t *obj, lv_coord_t w) { lv_obj_set_size(obj, w, obj->h_set); }
+void lv_obj_set_height(lv_obj_t *obj, lv_coord_t h) { lv_obj_set_size(obj, obj->w_set, h); }
+
+void lv_obj_set_align(lv_obj_t *obj, lv_align_t align) {
+  if (obj->align == align) return;
+  obj->align = align;
+  geometry_changed(obj);
+}
+
+void lv_obj_align(lv_obj_t *obj, lv_align_t align, lv_coord_t x_ofs, lv_coord_t y_ofs) {
+  if (obj->align == align && obj->x_set == x_ofs && obj->y_set == y_ofs) return;
+  obj->align = align;
+  obj->x_set = x_ofs;
+  obj->y_set = y_ofs;
+  geometry_changed(obj);
+}
+
+void lv_obj_center(lv_obj_t *obj) { lv_obj_align(obj, LV_ALIGN_CENTER, 0, 0); }
+
+void lv_obj_set_ext_click_area(lv_obj_t *obj, lv_coord_t size) { obj->ext_click_pad = size; }
+
+void lv_obj_update_layout(const lv_obj_t *obj) {}
+
+void lv_obj_get_coords(const lv_obj_t *obj, lv_area_t *coords) { *coords = obj->coords; }
+
+lv_coord_t lv_obj_get_x(const lv_obj_t *obj) {
+  return obj->parent == nullptr ? obj->coords.x1 : (lv_coord_t) (obj->coords.x1 - obj->parent->coords.x1);
+}
+
+lv_coord_t lv_obj_get_y(const lv_obj_t *obj) {
+  return obj->parent == nullptr ? obj->coords.y1 : (lv_coord_t) (obj->coords.y1 - obj->parent->coords.y1);
+}
+
+lv_coord_t lv_obj_get_width(const lv_obj_t *obj) { return lv_area_get_width(&obj->coords); }
+lv_coord_t lv_obj_get_height(const lv_obj_t *obj) { return lv_area_get_height(&obj->coords); }
+
+/*********************
+ * Invalidation
+ *********************/
+
+// Clipped to the parents, nothing if hidden or not on the loaded screen (or a layer)
+static bool area_is_visible(const lv_obj_t *obj, lv_area_t *area) {
+  const lv_obj_t *scr = lv_obj_get_screen(obj);
+  lv_disp_t *disp = scr->disp;
+  if (disp == nullptr) return false;
+  if (scr != disp->act_scr && scr != disp->top_layer && scr != disp->sys_layer) return false;
+
+  for (const lv_obj_t *o = obj; o != nullptr; o = o->parent) {
+    if (lv_obj_has_flag(o, LV_OBJ_FLAG_HIDDEN)) return false;
+    if (o != obj && !lv_obj_has_flag(o, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+      if (!_lv_area_intersect(area, area, &o->coords)) return false;
+    }
+  }
+  return true;
+}
+
+void lv_obj_invalidate_area(const lv_obj_t *obj, const lv_area_t *area) {
+  lv_area_t clipped = *area;
+  if (!area_is_visible(obj, &clipped)) return;
+  _lv_inv_area(lv_obj_get_disp(obj), &clipped);
+}
+
+void lv_obj_invalidate(const lv_obj_t *obj) {
+  lv_area_t area = obj->coords;
+  lv_coord_t ext = lv_lite_ext_draw_size(obj);
+  area.x1 = (lv_coord_t) (area.x1 - ext);
+  area.y1 = (lv_coord_t) (area.y1 - ext);
+  area.x2 = (lv_coord_t) (area.x2 + ext);
+  area.y2 = (lv_coord_t) (area.y2 + ext);
+  lv_obj_invalidate_area(obj, &area);
+}
+
+bool lv_obj_is_visible(const lv_obj_t *obj) {
+  lv_area_t area = obj->coords;
+  return area_is_visible(obj, &area);
+}
+
+/*********************
+ * Events
+ *********************/
+
+lv_event_dsc_t *lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t event_cb, lv_event_code_t filter, void *user_data) {
+  obj->event_dsc = static_cast<lv_event_dsc_t *>(
+      lv_mem_realloc(obj->event_dsc, sizeof(lv_event_dsc_t) * (obj->event_dsc_cnt + 1)));
+  lv_event_dsc_t *dsc = &obj->event_dsc[obj->event_dsc_cnt++];
+  dsc->cb = event_cb;
+  dsc->filter = filter;
+  dsc->user_data = user_data;
+  return dsc;
+}
+
+lv_res_t lv_event_send(lv_obj_t *obj, lv_event_code_t event_code, void *param) {
+  lv_event_t e;
+  e.target = obj;
+  e.code = event_code;
+  e.param = param;
+  for (lv_obj_t *current = obj; current != nullptr; current = current->parent) {
+    e.current_target = current;
+    for (uint32_t i = 0; i < current->event_dsc_cnt; i++) {
+      lv_event_dsc_t *dsc = &current->event_dsc[i];
+      if (dsc->filter != LV_EVENT_ALL && dsc->filter != event_code) continue;
+      e.user_data = dsc->user_data;
+      dsc->cb(&e);
+    }
+    if (!lv_obj_has_flag(current, LV_OBJ_FLAG_EVENT_BUBBLE)) break;
+  }
+  return LV_RES_OK;
+}
+
+lv_obj_t *lv_event_get_target(lv_event_t *e) { return e->target; }
+lv_obj_t *lv_event_get_current_target(lv_event_t *e) { return e->current_target; }
+lv_event_code_t lv_event_get_code(lv_event_t *e) { return e->code; }
+void *lv_event_get_user_data(lv_event_t *e) { return e->user_data; }
+void *lv_event_get_param(lv_event_t *e) { return e->param; }
+
+/*********************
+ * Label
+ *********************/
+
+lv_obj_t *lv_label_create(lv_obj_t *parent) {
+  lv_obj_t *obj = obj_create(&lv_label_class, parent);
+  obj->flags &= ~(LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICK_FOCUSABLE);
+  obj->w_set = LV_SIZE_CONTENT;
+  obj->h_set = LV_SIZE_CONTENT;
+  auto *label = static_cast<lv_lite_label_t *>(lv_mem_alloc(sizeof(lv_lite_label_t)));
+  memset(label, 0, sizeof(*label));
+  label->long_mode = LV_LABEL_LONG_WRAP;
+  label->text = static_cast<char *>(lv_mem_alloc(sizeof("Text")));
+  memcpy(label->text, "Text", sizeof("Text"));
+  obj->ext = label;
+  return obj_created(obj);
+}
+
+static void label_text_changed(lv_obj_t *obj) {
+  if (obj->w_set == LV_SIZE_CONTENT || obj->h_set == LV_SIZE_CONTENT) {
+    geometry_changed(obj);
+  } else {
+    lv_obj_invalidate(obj);
+  }
+}
+
+void lv_label_set_text(lv_obj_t *obj, const char *text) {
+  auto *label = static_cast<lv_lite_label_t *>(obj->ext);
+  if (text != nullptr && text != label->text) {
+    size_t len = strlen(text) + 1;
+    if (label->static_txt) label->text = nullptr;
+    label->text = static_cast<char *>(lv_mem_realloc(label->text, len));
+    memcpy(label->text, text, len);
+    label->static_txt = 0;
+  }
+  label_text_changed(obj);
+}
+
+void lv_label_set_text_static(lv_obj_t *obj, const char *text) {
+  auto *label = static_cast<lv_lite_label_t *>(obj->ext);
+  if (!label->static_txt) lv_mem_free(label->text);
+  label->text = const_cast<char *>(text);
+  label->static_txt = 1;
+  label_text_changed(obj);
+}
+
+char *lv_label_get_text(const lv_obj_t *obj) { return static_cast<lv_lite_label_t *>(obj->ext)->text; }
+
+void lv_label_set_long_mode(lv_obj_t *obj, lv_label_long_mode_t long_mode) {
+  static_cast<lv_lite_label_t *>(obj->ext)->long_mode = long_mode;
+  label_text_changed(obj);
+}
+
+/*********************
+ * Arc
+ *********************/
+
+static lv_lite_arc_t *arc_ext(const lv_obj_t *obj) { return static_cast<lv_lite_arc_t *>(obj->ext); }
+
+lv_obj_t *lv_arc_create(lv_obj_t *parent) {
+  lv_obj_t *obj = obj_create(&lv_arc_class, parent);
+  obj->flags &= ~LV_OBJ_FLAG_SCROLLABLE;
+  auto *arc = static_cast<lv_lite_arc_t *>(lv_mem_alloc(sizeof(lv_lite_arc_t)));
+  memset(arc, 0, sizeof(*arc));
+  arc->rotation = 0;
+  arc->bg_start = 135;
+  arc->bg_end = 45;
+  arc->ind_start = 135;
+  arc->ind_end = 135;
+  arc->min = 0;
+  arc->max = 100;
+  arc->value = 0;
+  obj->ext = arc;
+  obj->w_set = dpx(150);
+  obj->h_set = dpx(150);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_ARC_COLOR, lv_color_hex(PALETTE_GREY).full);
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_ARC_WIDTH, dpx(15));
+  set_theme(obj, LV_PART_MAIN, LITE_PROP_ARC_ROUNDED, 1);
+  set_theme(obj, LV_PART_INDICATOR, LITE_PROP_ARC_COLOR, lv_color_hex(PALETTE_BLUE).full);
+  set_theme(obj, LV_PART_INDICATOR, LITE_PROP_ARC_WIDTH, dpx(15));
+  set_theme(obj, LV_PART_INDICATOR, LITE_PROP_ARC_ROUNDED, 1);
+  set_theme(obj, LV_PART_KNOB, LITE_PROP_BG_COLOR, lv_color_hex(PALETTE_BLUE).full);
+  set_theme(obj, LV_PART_KNOB, LITE_PROP_BG_OPA, LV_OPA_COVER);
+  set_theme(obj, LV_PART_KNOB, LITE_PROP_RADIUS, LV_RADIUS_CIRCLE);
+  set_theme(obj, LV_PART_KNOB, LITE_PROP_PAD_LEFT, dpx(5));
+  return obj_created(obj);
+}
+
+static void arc_value_to_angles(lv_obj_t *obj) {
+  lv_lite_arc_t *arc = arc_ext(obj);
+  int32_t bg_span = arc->bg_end >= arc->bg_start ? arc->bg_end - arc->bg_start : arc->bg_end + 360 - arc->bg_start;
+  int32_t range = arc->max - arc->min;
+  int32_t span = range > 0 ? (int32_t) (arc->value - arc->min) * bg_span / range : 0;
+  uint16_t ind_start = arc->bg_start;
+  uint16_t ind_end = (uint16_t) ((arc->bg_start + span) % 360);
+  if (ind_start == arc->ind_start && ind_end == arc->ind_end) return;
+  arc->ind_start = ind_start;
+  arc->ind_end = ind_end;
+  lv_obj_invalidate(obj);
+}
+
+void lv_arc_set_value(lv_obj_t *obj, int16_t value) {
+  lv_lite_arc_t *arc = arc_ext(obj);
+  if (value < arc->min) value = arc->min;
+  if (value > arc->max) value = arc->max;
+  arc->value = value;
+  arc_value_to_angles(obj);
+}
+
+void lv_arc_set_range(lv_obj_t *obj, int16_t min, int16_t max) {
+  lv_lite_arc_t *arc = arc_ext(obj);
+  if (arc->min == min && arc->max == max) return;
+  arc->min = min;
+  arc->max = max;
+  lv_arc_set_value(obj, arc->value);
+}
+
+void lv_arc_set_rotation(lv_obj_t *obj, uint16_t rotation) {
+  lv_lite_arc_t *arc = arc_ext(obj);
+  arc->rotation = rotation;
+  lv_obj_invalidate(obj);
+}
+
+void lv_arc_set_bg_angles(lv_obj_t *obj, uint16_t start, uint16_t end) {
+  lv_lite_arc_t *arc = arc_ext(obj);
+  arc->bg_start = (uint16_t) (start % 360);
+  arc->bg_end = (uint16_t) (end % 360);
+  lv_obj_invalidate(obj);
+  arc_value_to_angles(obj);
+}
+
+void lv_arc_set_angles(lv_obj_t *obj, uint16_t start, uint16_t end) {
+  lv_lite_arc_t *arc = arc_ext(obj);
+  start = (uint16_t) (start % 360);
+  end = (uint16_t) (end % 360);
+  if (arc->ind_start == start && arc->ind_end == end) return;
+  arc->ind_start = start;
+  arc->ind_end = end;
+  lv_obj_invalidate(obj);
+}
+
+int16_t lv_arc_get_value(const lv_obj_t *obj) { return arc_ext(obj)->value; }
+
+/*********************
+ * Image
+ *********************/
+
+lv_obj_t *lv_img_create(lv_obj_t *parent) {
+  lv_obj_t *obj = obj_create(&lv_img_class, parent);
+  obj->flags &= ~(LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  obj->w_set = LV_SIZE_CONTENT;
+  obj->h_set = LV_SIZE_CONTENT;
+  auto *img = static_cast<lv_lite_img_t *>(lv_mem_alloc(sizeof(lv_lite_img_t)));
+  img->src = nullptr;
+  obj->ext = img;
+  return obj_created(obj);
+}
+
+void lv_img_set_src(lv_obj_t *obj, const void *src) {
+  static_cast<lv_lite_img_t *>(obj->ext)->src = src;
+  if (obj->w_set == LV_SIZE_CONTENT || obj->h_set == LV_SIZE_CONTENT) {
+    geometry_changed(obj);
+  } else {
+    lv_obj_invalidate(obj);
+  }
+}
+
+const void *lv_img_get_src(lv_obj_t *obj) { return static_cast<lv_lite_img_t *>(obj->ext)->src; }
+
+// Nothing is cached, images are drawn from their descriptor
+void lv_img_cache_invalidate_src(const void *src) {}
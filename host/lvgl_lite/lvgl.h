@@ -0,0 +1,776 @@
+/**
+ * @file lvgl.h
+ * @brief LVGL 8 subset for host builds without an LVGL checkout
+ *
+ * Same names, types and signatures as LVGL 8.4 for the part of the API that
+ * dial_menu and the host display use, so the components compile unchanged
+ * against either. Behaviour follows LVGL where the tests look at it:
+ * - objects invalidate what they cover (shadow and outline included) when a
+ *   style, text, value, flag or geometry changes, and only on a loaded screen
+ * - _lv_inv_area() collects areas like LVGL (clipped, rounded, deduplicated,
+ *   the whole screen once LV_INV_BUF_SIZE is exceeded); the refresh timer
+ *   joins them and renders each in bands of the draw buffer, one flush_cb
+ *   call per band, and pauses itself until the next invalidation
+ * - lv_refr_now() runs the refresh timer callback with the timer, the
+ *   display being its user data
+ * - groups focus with FOCUSED / DEFOCUSED events, an encoder indev moves the
+ *   focus and clicks the focused object
+ *
+ * Drawing is simplified (rounded rectangles, borders, outlines, a halo for
+ * shadows, arcs, A8 and RGB565 images, text as glyph boxes), so frame times
+ * are of the same order as LVGL's software renderer but not the same.
+ * Animations, scrolling, layouts and themes beyond a few defaults are left out.
+ */
+#ifndef LVGL_H
+#define LVGL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_conf.h"
+#endif
+
+#define LVGL_VERSION_MAJOR 8
+#define LVGL_VERSION_MINOR 4
+#define LVGL_VERSION_PATCH 0
+// Tells host code it runs on the subset (e.g. to relax timing checks)
+#define LVGL_LITE 1
+
+#ifndef LV_MEM_SIZE
+#define LV_MEM_SIZE (48U * 1024U)
+#endif
+#ifndef LV_DISP_DEF_REFR_PERIOD
+#define LV_DISP_DEF_REFR_PERIOD 30
+#endif
+#ifndef LV_INDEV_DEF_READ_PERIOD
+#define LV_INDEV_DEF_READ_PERIOD 30
+#endif
+#ifndef LV_INDEV_DEF_LONG_PRESS_TIME
+#define LV_INDEV_DEF_LONG_PRESS_TIME 400
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ * Basic types
+ *********************/
+
+typedef int16_t lv_coord_t;
+typedef uint8_t lv_opa_t;
+typedef uint8_t lv_res_t;
+
+#define LV_RES_INV 0
+#define LV_RES_OK 1
+
+#define LV_COORD_MAX ((lv_coord_t) 0x1FFF)
+#define LV_COORD_MIN (-LV_COORD_MAX)
+#define _LV_COORD_TYPE_SPEC (1 << 13)
+#define LV_COORD_SET_SPEC(x) ((x) | _LV_COORD_TYPE_SPEC)
+#define LV_SIZE_CONTENT LV_COORD_SET_SPEC(2001)
+#define LV_RADIUS_CIRCLE 0x7FFF
+
+enum {
+  LV_OPA_TRANSP = 0,
+  LV_OPA_0 = 0,
+  LV_OPA_10 = 25,
+  LV_OPA_20 = 51,
+  LV_OPA_30 = 76,
+  LV_OPA_40 = 102,
+  LV_OPA_50 = 127,
+  LV_OPA_60 = 153,
+  LV_OPA_70 = 178,
+  LV_OPA_80 = 204,
+  LV_OPA_90 = 229,
+  LV_OPA_100 = 255,
+  LV_OPA_COVER = 255,
+};
+
+typedef struct {
+  lv_coord_t x;
+  lv_coord_t y;
+} lv_point_t;
+
+typedef struct {
+  lv_coord_t x1;
+  lv_coord_t y1;
+  lv_coord_t x2;
+  lv_coord_t y2;
+} lv_area_t;
+
+static inline lv_coord_t lv_area_get_width(const lv_area_t *area) { return (lv_coord_t) (area->x2 - area->x1 + 1); }
+static inline lv_coord_t lv_area_get_height(const lv_area_t *area) { return (lv_coord_t) (area->y2 - area->y1 + 1); }
+static inline uint32_t lv_area_get_size(const lv_area_t *area) {
+  return (uint32_t) (area->x2 - area->x1 + 1) * (uint32_t) (area->y2 - area->y1 + 1);
+}
+void lv_area_set(lv_area_t *area, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2);
+bool _lv_area_intersect(lv_area_t *res, const lv_area_t *a1, const lv_area_t *a2);
+void _lv_area_join(lv_area_t *res, const lv_area_t *a1, const lv_area_t *a2);
+bool _lv_area_is_on(const lv_area_t *a1, const lv_area_t *a2);
+bool _lv_area_is_in(const lv_area_t *ain, const lv_area_t *aholder, lv_coord_t radius);
+
+/*********************
+ * Colors (LV_COLOR_DEPTH 16)
+ *********************/
+
+typedef union {
+  struct {
+    uint16_t blue : 5;
+    uint16_t green : 6;
+    uint16_t red : 5;
+  } ch;
+  uint16_t full;
+} lv_color16_t;
+typedef lv_color16_t lv_color_t;
+
+static inline lv_color_t lv_color_make(uint8_t r, uint8_t g, uint8_t b) {
+  lv_color_t color;
+  color.full = (uint16_t) (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+  return color;
+}
+static inline lv_color_t lv_color_hex(uint32_t c) {
+  return lv_color_make((uint8_t) ((c >> 16) & 0xFF), (uint8_t) ((c >> 8) & 0xFF), (uint8_t) (c & 0xFF));
+}
+static inline uint32_t lv_color_to32(lv_color_t color) {
+  uint32_t r = (color.ch.red * 263 + 7) >> 5;
+  uint32_t g = (color.ch.green * 259 + 3) >> 6;
+  uint32_t b = (color.ch.blue * 263 + 7) >> 5;
+  return 0xFF000000u | (r << 16) | (g << 8) | b;
+}
+static inline lv_color_t lv_color_white(void) { return lv_color_make(0xFF, 0xFF, 0xFF); }
+static inline lv_color_t lv_color_black(void) { return lv_color_make(0x00, 0x00, 0x00); }
+lv_color_t lv_color_mix(lv_color_t c1, lv_color_t c2, uint8_t mix);
+
+/*********************
+ * Memory
+ *********************/
+
+typedef struct {
+  uint32_t total_size;
+  uint32_t free_cnt;
+  uint32_t free_size;
+  uint32_t free_biggest_size;
+  uint32_t used_cnt;
+  uint32_t max_used;
+  uint8_t used_pct;
+  uint8_t frag_pct;
+} lv_mem_monitor_t;
+
+void *lv_mem_alloc(size_t size);
+void lv_mem_free(void *data);
+void *lv_mem_realloc(void *data_p, size_t new_size);
+void lv_mem_monitor(lv_mem_monitor_t *mon_p);
+
+/*********************
+ * Timers
+ *********************/
+
+struct _lv_timer_t;
+typedef void (*lv_timer_cb_t)(struct _lv_timer_t *);
+
+typedef struct _lv_timer_t {
+  uint32_t period;
+  uint32_t last_run;
+  lv_timer_cb_t timer_cb;
+  void *user_data;
+  int32_t repeat_count;
+  uint32_t paused : 1;
+} lv_timer_t;
+
+#define LV_NO_TIMER_READY 0xFFFFFFFF
+
+uint32_t lv_tick_get(void);
+void lv_tick_inc(uint32_t tick_period);
+uint32_t lv_tick_elaps(uint32_t prev_tick);
+lv_timer_t *lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void *user_data);
+void lv_timer_del(lv_timer_t *timer);
+void lv_timer_pause(lv_timer_t *timer);
+void lv_timer_resume(lv_timer_t *timer);
+void lv_timer_set_period(lv_timer_t *timer, uint32_t period);
+void lv_timer_set_cb(lv_timer_t *timer, lv_timer_cb_t timer_cb);
+void lv_timer_ready(lv_timer_t *timer);
+void lv_timer_reset(lv_timer_t *timer);
+uint32_t lv_timer_handler(void);
+lv_timer_t *lv_timer_get_next(lv_timer_t *timer);
+
+/*********************
+ * Fonts and symbols
+ *********************/
+
+typedef struct _lv_font_t {
+  lv_coord_t line_height;
+  lv_coord_t base_line;
+  // Subset only: advance of an average glyph, glyphs are drawn as boxes
+  lv_coord_t glyph_width;
+  const void *dsc;
+  const struct _lv_font_t *fallback;
+  void *user_data;
+} lv_font_t;
+
+extern const lv_font_t lv_font_montserrat_14;
+extern const lv_font_t lv_font_montserrat_18;
+extern const lv_font_t lv_font_montserrat_28;
+extern const lv_font_t lv_font_montserrat_48;
+#define LV_FONT_DEFAULT (&lv_font_montserrat_14)
+
+#define LV_SYMBOL_AUDIO "\xEF\x80\x81"
+#define LV_SYMBOL_VIDEO "\xEF\x80\x88"
+#define LV_SYMBOL_LIST "\xEF\x80\x8B"
+#define LV_SYMBOL_OK "\xEF\x80\x8C"
+#define LV_SYMBOL_CLOSE "\xEF\x80\x8D"
+#define LV_SYMBOL_POWER "\xEF\x80\x91"
+#define LV_SYMBOL_SETTINGS "\xEF\x80\x93"
+#define LV_SYMBOL_HOME "\xEF\x80\x95"
+#define LV_SYMBOL_DOWNLOAD "\xEF\x80\x99"
+#define LV_SYMBOL_DRIVE "\xEF\x80\x9C"
+#define LV_SYMBOL_REFRESH "\xEF\x80\xA1"
+#define LV_SYMBOL_MUTE "\xEF\x80\xA6"
+#define LV_SYMBOL_VOLUME_MID "\xEF\x80\xA7"
+#define LV_SYMBOL_VOLUME_MAX "\xEF\x80\xA8"
+#define LV_SYMBOL_IMAGE "\xEF\x80\xBE"
+#define LV_SYMBOL_TINT "\xEF\x81\x83"
+#define LV_SYMBOL_PREV "\xEF\x81\x88"
+#define LV_SYMBOL_PLAY "\xEF\x81\x8B"
+#define LV_SYMBOL_PAUSE "\xEF\x81\x8C"
+#define LV_SYMBOL_STOP "\xEF\x81\x8D"
+#define LV_SYMBOL_NEXT "\xEF\x81\x91"
+#define LV_SYMBOL_EJECT "\xEF\x81\x92"
+#define LV_SYMBOL_LEFT "\xEF\x81\x93"
+#define LV_SYMBOL_RIGHT "\xEF\x81\x94"
+#define LV_SYMBOL_PLUS "\xEF\x81\xA7"
+#define LV_SYMBOL_MINUS "\xEF\x81\xA8"
+#define LV_SYMBOL_EYE_OPEN "\xEF\x81\xAE"
+#define LV_SYMBOL_EYE_CLOSE "\xEF\x81\xB0"
+#define LV_SYMBOL_WARNING "\xEF\x81\xB1"
+#define LV_SYMBOL_SHUFFLE "\xEF\x81\xB4"
+#define LV_SYMBOL_UP "\xEF\x81\xB7"
+#define LV_SYMBOL_DOWN "\xEF\x81\xB8"
+#define LV_SYMBOL_LOOP "\xEF\x81\xB9"
+#define LV_SYMBOL_DIRECTORY "\xEF\x81\xBB"
+#define LV_SYMBOL_UPLOAD "\xEF\x82\x93"
+#define LV_SYMBOL_CALL "\xEF\x82\x95"
+#define LV_SYMBOL_CUT "\xEF\x83\x84"
+#define LV_SYMBOL_COPY "\xEF\x83\x85"
+#define LV_SYMBOL_SAVE "\xEF\x83\x87"
+#define LV_SYMBOL_BARS "\xEF\x83\x89"
+#define LV_SYMBOL_ENVELOPE "\xEF\x83\xA0"
+#define LV_SYMBOL_CHARGE "\xEF\x83\xA7"
+#define LV_SYMBOL_PASTE "\xEF\x83\xAA"
+#define LV_SYMBOL_BELL "\xEF\x83\xB3"
+#define LV_SYMBOL_KEYBOARD "\xEF\x84\x9C"
+#define LV_SYMBOL_GPS "\xEF\x84\xA4"
+#define LV_SYMBOL_FILE "\xEF\x85\x9B"
+#define LV_SYMBOL_WIFI "\xEF\x87\xAB"
+#define LV_SYMBOL_BATTERY_FULL "\xEF\x89\x80"
+#define LV_SYMBOL_BATTERY_EMPTY "\xEF\x89\x84"
+#define LV_SYMBOL_USB "\xEF\x8A\x87"
+#define LV_SYMBOL_BLUETOOTH "\xEF\x8A\x93"
+#define LV_SYMBOL_TRASH "\xEF\x8B\xAD"
+#define LV_SYMBOL_EDIT "\xEF\x8C\x84"
+#define LV_SYMBOL_BACKSPACE "\xEF\x95\x9A"
+#define LV_SYMBOL_SD_CARD "\xEF\x9F\x82"
+#define LV_SYMBOL_NEW_LINE "\xEF\xA2\xA2"
+#define LV_SYMBOL_DUMMY "\xEF\xA3\xBF"
+#define LV_SYMBOL_BULLET "\xE2\x80\xA2"
+
+/*********************
+ * Images
+ *********************/
+
+typedef uint8_t lv_img_cf_t;
+enum {
+  LV_IMG_CF_UNKNOWN = 0,
+  LV_IMG_CF_RAW,
+  LV_IMG_CF_RAW_ALPHA,
+  LV_IMG_CF_RAW_CHROMA_KEYED,
+  LV_IMG_CF_TRUE_COLOR,
+  LV_IMG_CF_TRUE_COLOR_ALPHA,
+  LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED,
+  LV_IMG_CF_INDEXED_1BIT,
+  LV_IMG_CF_INDEXED_2BIT,
+  LV_IMG_CF_INDEXED_4BIT,
+  LV_IMG_CF_INDEXED_8BIT,
+  LV_IMG_CF_ALPHA_1BIT,
+  LV_IMG_CF_ALPHA_2BIT,
+  LV_IMG_CF_ALPHA_4BIT,
+  LV_IMG_CF_ALPHA_8BIT,
+};
+
+typedef struct {
+  uint32_t cf : 5;
+  uint32_t always_zero : 3;
+  uint32_t reserved : 2;
+  uint32_t w : 11;
+  uint32_t h : 11;
+} lv_img_header_t;
+
+typedef struct {
+  lv_img_header_t header;
+  uint32_t data_size;
+  const uint8_t *data;
+} lv_img_dsc_t;
+
+void lv_img_cache_invalidate_src(const void *src);
+
+/*********************
+ * Objects and styles
+ *********************/
+
+struct _lv_obj_t;
+struct _lv_disp_t;
+struct _lv_group_t;
+struct _lv_event_t;
+
+typedef struct _lv_obj_class_t {
+  const struct _lv_obj_class_t *base_class;
+  const char *name;
+} lv_obj_class_t;
+
+extern const lv_obj_class_t lv_obj_class;
+extern const lv_obj_class_t lv_btn_class;
+extern const lv_obj_class_t lv_label_class;
+extern const lv_obj_class_t lv_arc_class;
+extern const lv_obj_class_t lv_img_class;
+
+typedef uint32_t lv_part_t;
+typedef uint16_t lv_state_t;
+typedef uint32_t lv_style_selector_t;
+typedef uint32_t lv_obj_flag_t;
+
+enum {
+  LV_PART_MAIN = 0x000000,
+  LV_PART_SCROLLBAR = 0x010000,
+  LV_PART_INDICATOR = 0x020000,
+  LV_PART_KNOB = 0x030000,
+  LV_PART_SELECTED = 0x040000,
+  LV_PART_ITEMS = 0x050000,
+  LV_PART_ANY = 0x0F0000,
+};
+
+enum {
+  LV_STATE_DEFAULT = 0x0000,
+  LV_STATE_CHECKED = 0x0001,
+  LV_STATE_FOCUSED = 0x0002,
+  LV_STATE_FOCUS_KEY = 0x0004,
+  LV_STATE_EDITED = 0x0008,
+  LV_STATE_HOVERED = 0x0010,
+  LV_STATE_PRESSED = 0x0020,
+  LV_STATE_SCROLLED = 0x0040,
+  LV_STATE_DISABLED = 0x0080,
+  LV_STATE_ANY = 0xFFFF,
+};
+
+enum {
+  LV_OBJ_FLAG_HIDDEN = (1L << 0),
+  LV_OBJ_FLAG_CLICKABLE = (1L << 1),
+  LV_OBJ_FLAG_CLICK_FOCUSABLE = (1L << 2),
+  LV_OBJ_FLAG_CHECKABLE = (1L << 3),
+  LV_OBJ_FLAG_SCROLLABLE = (1L << 4),
+  LV_OBJ_FLAG_SCROLL_ELASTIC = (1L << 5),
+  LV_OBJ_FLAG_SCROLL_MOMENTUM = (1L << 6),
+  LV_OBJ_FLAG_SCROLL_ONE = (1L << 7),
+  LV_OBJ_FLAG_SCROLL_CHAIN_HOR = (1L << 8),
+  LV_OBJ_FLAG_SCROLL_CHAIN_VER = (1L << 9),
+  LV_OBJ_FLAG_SCROLL_ON_FOCUS = (1L << 10),
+  LV_OBJ_FLAG_SCROLL_WITH_ARROW = (1L << 11),
+  LV_OBJ_FLAG_SNAPPABLE = (1L << 12),
+  LV_OBJ_FLAG_PRESS_LOCK = (1L << 13),
+  LV_OBJ_FLAG_EVENT_BUBBLE = (1L << 14),
+  LV_OBJ_FLAG_GESTURE_BUBBLE = (1L << 15),
+  LV_OBJ_FLAG_ADV_HITTEST = (1L << 16),
+  LV_OBJ_FLAG_IGNORE_LAYOUT = (1L << 17),
+  LV_OBJ_FLAG_FLOATING = (1L << 18),
+  LV_OBJ_FLAG_OVERFLOW_VISIBLE = (1L << 19),
+};
+
+typedef uint8_t lv_align_t;
+enum {
+  LV_ALIGN_DEFAULT = 0,
+  LV_ALIGN_TOP_LEFT,
+  LV_ALIGN_TOP_MID,
+  LV_ALIGN_TOP_RIGHT,
+  LV_ALIGN_BOTTOM_LEFT,
+  LV_ALIGN_BOTTOM_MID,
+  LV_ALIGN_BOTTOM_RIGHT,
+  LV_ALIGN_LEFT_MID,
+  LV_ALIGN_RIGHT_MID,
+  LV_ALIGN_CENTER,
+};
+
+typedef uint8_t lv_text_align_t;
+enum {
+  LV_TEXT_ALIGN_AUTO,
+  LV_TEXT_ALIGN_LEFT,
+  LV_TEXT_ALIGN_CENTER,
+  LV_TEXT_ALIGN_RIGHT,
+};
+
+typedef struct {
+  // Not used by the subset, lv_obj_remove_style() accepts NULL (all styles)
+  void *values_and_props;
+  uint16_t prop1;
+  uint8_t has_group;
+  uint8_t prop_cnt;
+} lv_style_t;
+
+// Local style values of an object (the subset keeps them unpacked)
+typedef struct {
+  lv_style_selector_t selector;
+  uint16_t prop;
+  uint8_t is_theme;
+  int32_t num;
+  const void *ptr;
+} _lv_obj_style_t;
+
+typedef struct _lv_obj_t {
+  const lv_obj_class_t *class_p;
+  struct _lv_obj_t *parent;
+  struct _lv_obj_t **children;
+  uint32_t child_cnt;
+  _lv_obj_style_t *styles;
+  uint32_t style_cnt;
+  void *user_data;
+  lv_area_t coords;
+  lv_obj_flag_t flags;
+  lv_state_t state;
+  lv_coord_t ext_click_pad;
+  // Geometry as set (position / alignment / size), coords are derived from it
+  lv_coord_t x_set;
+  lv_coord_t y_set;
+  lv_coord_t w_set;
+  lv_coord_t h_set;
+  lv_align_t align;
+  struct _lv_event_dsc_t *event_dsc;
+  uint8_t event_dsc_cnt;
+  struct _lv_group_t *group_p;
+  struct _lv_disp_t *disp;  // Screens only
+  void *ext;                // Widget data (label text, arc values, image source)
+} lv_obj_t;
+
+lv_obj_t *lv_obj_create(lv_obj_t *parent);
+void lv_obj_del(lv_obj_t *obj);
+void lv_obj_clean(lv_obj_t *obj);
+lv_obj_t *lv_obj_get_parent(const lv_obj_t *obj);
+lv_obj_t *lv_obj_get_screen(const lv_obj_t *obj);
+struct _lv_disp_t *lv_obj_get_disp(const lv_obj_t *obj);
+lv_obj_t *lv_obj_get_child(const lv_obj_t *obj, int32_t id);
+uint32_t lv_obj_get_child_cnt(const lv_obj_t *obj);
+bool lv_obj_check_type(const lv_obj_t *obj, const lv_obj_class_t *class_p);
+bool lv_obj_has_class(const lv_obj_t *obj, const lv_obj_class_t *class_p);
+
+void lv_obj_add_flag(lv_obj_t *obj, lv_obj_flag_t f);
+void lv_obj_clear_flag(lv_obj_t *obj, lv_obj_flag_t f);
+bool lv_obj_has_flag(const lv_obj_t *obj, lv_obj_flag_t f);
+void lv_obj_add_state(lv_obj_t *obj, lv_state_t state);
+void lv_obj_clear_state(lv_obj_t *obj, lv_state_t state);
+lv_state_t lv_obj_get_state(const lv_obj_t *obj);
+bool lv_obj_has_state(const lv_obj_t *obj, lv_state_t state);
+
+static inline void lv_obj_set_user_data(lv_obj_t *obj, void *user_data) { obj->user_data = user_data; }
+static inline void *lv_obj_get_user_data(lv_obj_t *obj) { return obj->user_data; }
+
+void lv_obj_set_pos(lv_obj_t *obj, lv_coord_t x, lv_coord_t y);
+void lv_obj_set_x(lv_obj_t *obj, lv_coord_t x);
+void lv_obj_set_y(lv_obj_t *obj, lv_coord_t y);
+void lv_obj_set_size(lv_obj_t *obj, lv_coord_t w, lv_coord_t h);
+void lv_obj_set_width(lv_obj_t *obj, lv_coord_t w);
+void lv_obj_set_height(lv_obj_t *obj, lv_coord_t h);
+void lv_obj_set_align(lv_obj_t *obj, lv_align_t align);
+void lv_obj_align(lv_obj_t *obj, lv_align_t align, lv_coord_t x_ofs, lv_coord_t y_ofs);
+void lv_obj_center(lv_obj_t *obj);
+void lv_obj_set_ext_click_area(lv_obj_t *obj, lv_coord_t size);
+void lv_obj_update_layout(const lv_obj_t *obj);
+void lv_obj_get_coords(const lv_obj_t *obj, lv_area_t *coords);
+lv_coord_t lv_obj_get_x(const lv_obj_t *obj);
+lv_coord_t lv_obj_get_y(const lv_obj_t *obj);
+lv_coord_t lv_obj_get_width(const lv_obj_t *obj);
+lv_coord_t lv_obj_get_height(const lv_obj_t *obj);
+void lv_obj_invalidate(const lv_obj_t *obj);
+void lv_obj_invalidate_area(const lv_obj_t *obj, const lv_area_t *area);
+bool lv_obj_is_visible(const lv_obj_t *obj);
+
+void lv_obj_remove_style(lv_obj_t *obj, lv_style_t *style, lv_style_selector_t selector);
+void lv_obj_remove_style_all(lv_obj_t *obj);
+
+void lv_obj_set_style_bg_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector);
+void lv_obj_set_style_bg_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+void lv_obj_set_style_border_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector);
+void lv_obj_set_style_border_width(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_obj_set_style_border_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+void lv_obj_set_style_radius(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_obj_set_style_clip_corner(lv_obj_t *obj, bool value, lv_style_selector_t selector);
+void lv_obj_set_style_shadow_width(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_obj_set_style_shadow_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector);
+void lv_obj_set_style_shadow_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+void lv_obj_set_style_outline_width(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_obj_set_style_outline_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector);
+void lv_obj_set_style_outline_pad(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_obj_set_style_pad_top(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_obj_set_style_pad_bottom(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_obj_set_style_pad_left(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_obj_set_style_pad_right(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+static inline void lv_obj_set_style_pad_all(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector) {
+  lv_obj_set_style_pad_left(obj, value, selector);
+  lv_obj_set_style_pad_right(obj, value, selector);
+  lv_obj_set_style_pad_top(obj, value, selector);
+  lv_obj_set_style_pad_bottom(obj, value, selector);
+}
+void lv_obj_set_style_text_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector);
+void lv_obj_set_style_text_font(lv_obj_t *obj, const lv_font_t *value, lv_style_selector_t selector);
+void lv_obj_set_style_text_align(lv_obj_t *obj, lv_text_align_t value, lv_style_selector_t selector);
+void lv_obj_set_style_arc_color(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector);
+void lv_obj_set_style_arc_width(lv_obj_t *obj, lv_coord_t value, lv_style_selector_t selector);
+void lv_obj_set_style_arc_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+void lv_obj_set_style_arc_rounded(lv_obj_t *obj, bool value, lv_style_selector_t selector);
+void lv_obj_set_style_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+void lv_obj_set_style_img_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+void lv_obj_set_style_img_recolor(lv_obj_t *obj, lv_color_t value, lv_style_selector_t selector);
+void lv_obj_set_style_img_recolor_opa(lv_obj_t *obj, lv_opa_t value, lv_style_selector_t selector);
+
+/*********************
+ * Events
+ *********************/
+
+typedef enum {
+  LV_EVENT_ALL = 0,
+  LV_EVENT_PRESSED,
+  LV_EVENT_PRESSING,
+  LV_EVENT_PRESS_LOST,
+  LV_EVENT_SHORT_CLICKED,
+  LV_EVENT_LONG_PRESSED,
+  LV_EVENT_LONG_PRESSED_REPEAT,
+  LV_EVENT_CLICKED,
+  LV_EVENT_RELEASED,
+  LV_EVENT_SCROLL_BEGIN,
+  LV_EVENT_SCROLL_END,
+  LV_EVENT_SCROLL,
+  LV_EVENT_GESTURE,
+  LV_EVENT_KEY,
+  LV_EVENT_FOCUSED,
+  LV_EVENT_DEFOCUSED,
+  LV_EVENT_LEAVE,
+  LV_EVENT_HIT_TEST,
+  LV_EVENT_VALUE_CHANGED = 28,
+  LV_EVENT_DELETE = 33,
+  LV_EVENT_SCREEN_UNLOAD_START = 37,
+  LV_EVENT_SCREEN_LOAD_START,
+  LV_EVENT_SCREEN_LOADED,
+  LV_EVENT_SCREEN_UNLOADED,
+  _LV_EVENT_LAST = 45,
+} lv_event_code_t;
+
+typedef struct _lv_event_t lv_event_t;
+typedef void (*lv_event_cb_t)(lv_event_t *e);
+
+struct _lv_event_t {
+  lv_obj_t *target;
+  lv_obj_t *current_target;
+  lv_event_code_t code;
+  void *user_data;
+  void *param;
+};
+
+typedef struct _lv_event_dsc_t {
+  lv_event_cb_t cb;
+  void *user_data;
+  lv_event_code_t filter;
+} lv_event_dsc_t;
+
+lv_event_dsc_t *lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t event_cb, lv_event_code_t filter, void *user_data);
+lv_res_t lv_event_send(lv_obj_t *obj, lv_event_code_t event_code, void *param);
+lv_obj_t *lv_event_get_target(lv_event_t *e);
+lv_obj_t *lv_event_get_current_target(lv_event_t *e);
+lv_event_code_t lv_event_get_code(lv_event_t *e);
+void *lv_event_get_user_data(lv_event_t *e);
+void *lv_event_get_param(lv_event_t *e);
+
+/*********************
+ * Widgets
+ *********************/
+
+lv_obj_t *lv_btn_create(lv_obj_t *parent);
+
+typedef uint8_t lv_label_long_mode_t;
+enum {
+  LV_LABEL_LONG_WRAP,
+  LV_LABEL_LONG_DOT,
+  LV_LABEL_LONG_SCROLL,
+  LV_LABEL_LONG_SCROLL_CIRCULAR,
+  LV_LABEL_LONG_CLIP,
+};
+
+lv_obj_t *lv_label_create(lv_obj_t *parent);
+void lv_label_set_text(lv_obj_t *obj, const char *text);
+void lv_label_set_text_static(lv_obj_t *obj, const char *text);
+char *lv_label_get_text(const lv_obj_t *obj);
+void lv_label_set_long_mode(lv_obj_t *obj, lv_label_long_mode_t long_mode);
+
+lv_obj_t *lv_arc_create(lv_obj_t *parent);
+void lv_arc_set_value(lv_obj_t *obj, int16_t value);
+void lv_arc_set_range(lv_obj_t *obj, int16_t min, int16_t max);
+void lv_arc_set_rotation(lv_obj_t *obj, uint16_t rotation);
+void lv_arc_set_bg_angles(lv_obj_t *obj, uint16_t start, uint16_t end);
+void lv_arc_set_angles(lv_obj_t *obj, uint16_t start, uint16_t end);
+int16_t lv_arc_get_value(const lv_obj_t *obj);
+
+lv_obj_t *lv_img_create(lv_obj_t *parent);
+void lv_img_set_src(lv_obj_t *obj, const void *src);
+const void *lv_img_get_src(lv_obj_t *obj);
+
+/*********************
+ * Groups and input devices
+ *********************/
+
+typedef struct _lv_group_t {
+  lv_obj_t **objs;
+  uint32_t obj_cnt;
+  lv_obj_t *obj_focus;
+  uint8_t wrap : 1;
+  uint8_t editing : 1;
+} lv_group_t;
+
+lv_group_t *lv_group_create(void);
+void lv_group_del(lv_group_t *group);
+void lv_group_set_default(lv_group_t *group);
+lv_group_t *lv_group_get_default(void);
+void lv_group_add_obj(lv_group_t *group, lv_obj_t *obj);
+void lv_group_remove_obj(lv_obj_t *obj);
+void lv_group_focus_obj(lv_obj_t *obj);
+void lv_group_focus_next(lv_group_t *group);
+void lv_group_focus_prev(lv_group_t *group);
+void lv_group_set_wrap(lv_group_t *group, bool en);
+lv_obj_t *lv_group_get_focused(const lv_group_t *group);
+uint32_t lv_group_get_obj_count(lv_group_t *group);
+
+typedef enum {
+  LV_INDEV_TYPE_NONE,
+  LV_INDEV_TYPE_POINTER,
+  LV_INDEV_TYPE_KEYPAD,
+  LV_INDEV_TYPE_BUTTON,
+  LV_INDEV_TYPE_ENCODER,
+} lv_indev_type_t;
+
+typedef enum {
+  LV_INDEV_STATE_RELEASED = 0,
+  LV_INDEV_STATE_PRESSED,
+} lv_indev_state_t;
+
+typedef struct {
+  lv_point_t point;
+  uint32_t key;
+  uint32_t btn_id;
+  int16_t enc_diff;
+  lv_indev_state_t state;
+  bool continue_reading;
+} lv_indev_data_t;
+
+struct _lv_indev_drv_t;
+typedef struct _lv_indev_drv_t {
+  lv_indev_type_t type;
+  void (*read_cb)(struct _lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
+  struct _lv_disp_t *disp;
+  lv_timer_t *read_timer;
+  void *user_data;
+} lv_indev_drv_t;
+
+typedef struct _lv_indev_t {
+  lv_indev_drv_t *driver;
+  lv_group_t *group;
+  lv_indev_state_t last_state;
+  uint32_t pr_timestamp;
+  uint8_t long_pr_sent;
+  struct _lv_indev_t *next;
+} lv_indev_t;
+
+void lv_indev_drv_init(lv_indev_drv_t *driver);
+lv_indev_t *lv_indev_drv_register(lv_indev_drv_t *driver);
+lv_indev_t *lv_indev_get_next(lv_indev_t *indev);
+lv_indev_type_t lv_indev_get_type(const lv_indev_t *indev);
+void lv_indev_set_group(lv_indev_t *indev, lv_group_t *group);
+void lv_indev_read_timer_cb(lv_timer_t *timer);
+
+/*********************
+ * Displays
+ *********************/
+
+#define LV_INV_BUF_SIZE 32
+
+typedef struct _lv_disp_draw_buf_t {
+  void *buf1;
+  void *buf2;
+  void *buf_act;
+  uint32_t size;  // In pixels
+  volatile int flushing;
+  volatile int flushing_last;
+  volatile uint32_t last_area : 1;
+  volatile uint32_t last_part : 1;
+} lv_disp_draw_buf_t;
+
+struct _lv_disp_drv_t;
+typedef struct _lv_disp_drv_t {
+  lv_coord_t hor_res;
+  lv_coord_t ver_res;
+  lv_disp_draw_buf_t *draw_buf;
+  uint32_t direct_mode : 1;
+  uint32_t full_refresh : 1;
+  uint32_t sw_rotate : 1;
+  uint32_t antialiasing : 1;
+  void (*flush_cb)(struct _lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+  void (*rounder_cb)(struct _lv_disp_drv_t *disp_drv, lv_area_t *area);
+  void (*monitor_cb)(struct _lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
+  uint32_t dpi;
+  void *user_data;
+} lv_disp_drv_t;
+
+typedef struct _lv_disp_t {
+  lv_disp_drv_t *driver;
+  lv_timer_t *refr_timer;
+  lv_obj_t **screens;
+  lv_obj_t *act_scr;
+  lv_obj_t *prev_scr;
+  lv_obj_t *top_layer;
+  lv_obj_t *sys_layer;
+  uint32_t screen_cnt;
+  lv_area_t inv_areas[LV_INV_BUF_SIZE];
+  uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+  uint16_t inv_p;
+  uint32_t last_activity_time;
+  struct _lv_disp_t *next;
+} lv_disp_t;
+
+void lv_disp_drv_init(lv_disp_drv_t *driver);
+void lv_disp_draw_buf_init(lv_disp_draw_buf_t *draw_buf, void *buf1, void *buf2, uint32_t size_in_px_cnt);
+lv_disp_t *lv_disp_drv_register(lv_disp_drv_t *driver);
+void lv_disp_remove(lv_disp_t *disp);
+void lv_disp_set_default(lv_disp_t *disp);
+lv_disp_t *lv_disp_get_default(void);
+lv_disp_t *lv_disp_get_next(lv_disp_t *disp);
+lv_coord_t lv_disp_get_hor_res(lv_disp_t *disp);
+lv_coord_t lv_disp_get_ver_res(lv_disp_t *disp);
+void lv_disp_flush_ready(lv_disp_drv_t *disp_drv);
+bool lv_disp_flush_is_last(lv_disp_drv_t *disp_drv);
+lv_obj_t *lv_disp_get_scr_act(lv_disp_t *disp);
+void lv_disp_load_scr(lv_obj_t *scr);
+void _lv_inv_area(lv_disp_t *disp, const lv_area_t *area_p);
+void _lv_disp_refr_timer(lv_timer_t *timer);
+void lv_refr_now(lv_disp_t *disp);
+
+static inline lv_obj_t *lv_scr_act(void) { return lv_disp_get_scr_act(lv_disp_get_default()); }
+static inline void lv_scr_load(lv_obj_t *scr) { lv_disp_load_scr(scr); }
+
+/*********************
+ * Init
+ *********************/
+
+void lv_init(void);
+void lv_deinit(void);
+bool lv_is_initialized(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // LVGL_H
@@ -0,0 +1,89 @@
+/**
+ * @file api_server.cpp
+ * @brief Host build: recorded subscriptions and actions
+ */
+
+#include "api_server.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace api {
+
+static const char *const TAG = "api";
+
+APIServer *global_api_server = nullptr;
+
+APIServer::APIServer() { global_api_server = this; }
+
+std::string SentAction::get(const std::string &key) const {
+  for (const auto &kv : this->data) {
+    if (kv.first == key) return kv.second;
+  }
+  return std::string();
+}
+
+void APIServer::subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
+                                               std::function<void(StringRef)> f) {
+  this->subscriptions_.push_back(Subscription{std::move(entity_id), attribute.value_or(""), std::move(f)});
+}
+
+void APIServer::get_home_assistant_state(std::string entity_id, optional<std::string> attribute,
+                                         std::function<void(StringRef)> f) {
+  this->requests_.push_back(Subscription{std::move(entity_id), attribute.value_or(""), std::move(f)});
+  this->state_requests_++;
+}
+
+APIServer::State *APIServer::find_state_(const std::string &entity_id, const std::string &attribute) {
+  for (auto &state : this->states_) {
+    if (state.entity_id == entity_id && state.attribute == attribute) return &state;
+  }
+  return nullptr;
+}
+
+void APIServer::loop() {
+  // Answered one at a time: a callback may request again
+  for (size_t i = 0; i < this->requests_.size();) {
+    const State *state = this->find_state_(this->requests_[i].entity_id, this->requests_[i].attribute);
+    if (state == nullptr) {
+      i++;
+      continue;
+    }
+    std::string answer = state->value;
+    auto callback = std::move(this->requests_[i].callback);
+    this->requests_.erase(this->requests_.begin() + i);
+    callback(StringRef(answer));
+  }
+}
+
+size_t APIServer::inject_state(const std::string &entity_id, const std::string &attribute, const std::string &value) {
+  State *state = this->find_state_(entity_id, attribute);
+  if (state != nullptr) {
+    state->value = value;
+  } else {
+    this->states_.push_back(State{entity_id, attribute, value});
+  }
+
+  size_t delivered = 0;
+  // A callback may subscribe again: index, not iterators
+  for (size_t i = 0; i < this->subscriptions_.size(); i++) {
+    if (this->subscriptions_[i].entity_id != entity_id || this->subscriptions_[i].attribute != attribute) continue;
+    this->subscriptions_[i].callback(StringRef(value));
+    delivered++;
+  }
+  return delivered;
+}
+
+void APIServer::send_homeassistant_action(const HomeassistantActionRequest &call) {
+  SentAction action;
+  action.service = call.service.str();
+  for (const auto &kv : call.data) {
+    action.data.emplace_back(kv.key.str(), kv.value.str());
+  }
+  action.time_us = micros();
+  ESP_LOGD(TAG, "Action %s (%u fields)", action.service.c_str(), (unsigned) action.data.size());
+  this->sent_.push_back(std::move(action));
+}
+
+}  // namespace api
+}  // namespace esphome
@@ -0,0 +1,96 @@
+/**
+ * @file api_server.h
+ * @brief Host build: the API server as seen by the mirrors, driven by the test
+ *
+ * subscribe_home_assistant_state() records the subscription; the test plays
+ * Home Assistant with inject_state(). get_home_assistant_state() is answered
+ * once, from the loop, with the last value injected (or the next one). Actions sent to HA are kept in order
+ * with their send time, so a test can check what a UI interaction produced
+ * and how long it took.
+ */
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/string_ref.h"
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+namespace api {
+
+struct HomeassistantServiceMap {
+  StringRef key;
+  StringRef value;
+};
+
+struct HomeassistantActionRequest {
+  StringRef service;
+  FixedVector<HomeassistantServiceMap> data;
+  FixedVector<HomeassistantServiceMap> data_template;
+  FixedVector<HomeassistantServiceMap> variables;
+  bool is_event{false};
+};
+
+// What send_homeassistant_action() received, copied out of the request
+struct SentAction {
+  std::string service;
+  std::vector<std::pair<std::string, std::string>> data;
+  uint32_t time_us;
+
+  // Value of a data key, empty if absent
+  std::string get(const std::string &key) const;
+};
+
+class APIServer : public Component {
+ public:
+  APIServer();
+  void loop() override;
+
+  void subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
+                                      std::function<void(StringRef)> f);
+  void get_home_assistant_state(std::string entity_id, optional<std::string> attribute,
+                                std::function<void(StringRef)> f);
+  void send_homeassistant_action(const HomeassistantActionRequest &call);
+  bool is_connected() const { return this->connected_; }
+
+  // Host side: Home Assistant
+  void set_connected(bool connected) { this->connected_ = connected; }
+  // Deliver a state (attribute empty) or an attribute; returns the number of subscribers called
+  size_t inject_state(const std::string &entity_id, const std::string &attribute, const std::string &value);
+  size_t get_subscription_count() const { return this->subscriptions_.size(); }
+  // get_home_assistant_state() requests so far
+  uint32_t get_state_requests() const { return this->state_requests_; }
+  const std::vector<SentAction> &get_sent_actions() const { return this->sent_; }
+  void clear_sent_actions() { this->sent_.clear(); }
+
+ protected:
+  struct Subscription {
+    std::string entity_id;
+    std::string attribute;  // Empty: the state
+    std::function<void(StringRef)> callback;
+  };
+  // Last value of each state and attribute
+  struct State {
+    std::string entity_id;
+    std::string attribute;
+    std::string value;
+  };
+  State *find_state_(const std::string &entity_id, const std::string &attribute);
+
+  std::vector<Subscription> subscriptions_;
+  // One-shot requests, dropped once answered
+  std::vector<Subscription> requests_;
+  // Updated in place: once every value has been seen, inject_state() does not allocate
+  std::vector<State> states_;
+  uint32_t state_requests_{0};
+  std::vector<SentAction> sent_;
+  bool connected_{true};
+};
+
+extern APIServer *global_api_server;
+
+}  // namespace api
+}  // namespace esphome
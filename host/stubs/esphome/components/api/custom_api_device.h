@@ -0,0 +1,7 @@
+/**
+ * @file custom_api_device.h
+ * @brief Host build: the header the mirrors include for the API server
+ */
+#pragma once
+
+#include "api_server.h"
@@ -0,0 +1,54 @@
+/**
+ * @file climate.cpp
+ * @brief Host build: climate calls go straight to control()
+ */
+
+#include "climate.h"
+
+namespace esphome {
+namespace climate {
+
+const char *climate_mode_to_string(ClimateMode mode) {
+  switch (mode) {
+    case CLIMATE_MODE_OFF:
+      return "OFF";
+    case CLIMATE_MODE_HEAT_COOL:
+      return "HEAT_COOL";
+    case CLIMATE_MODE_COOL:
+      return "COOL";
+    case CLIMATE_MODE_HEAT:
+      return "HEAT";
+    case CLIMATE_MODE_FAN_ONLY:
+      return "FAN_ONLY";
+    case CLIMATE_MODE_DRY:
+      return "DRY";
+    case CLIMATE_MODE_AUTO:
+      return "AUTO";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+const char *climate_action_to_string(ClimateAction action) {
+  switch (action) {
+    case CLIMATE_ACTION_OFF:
+      return "OFF";
+    case CLIMATE_ACTION_COOLING:
+      return "COOLING";
+    case CLIMATE_ACTION_HEATING:
+      return "HEATING";
+    case CLIMATE_ACTION_IDLE:
+      return "IDLE";
+    case CLIMATE_ACTION_DRYING:
+      return "DRYING";
+    case CLIMATE_ACTION_FAN:
+      return "FAN";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+void ClimateCall::perform() { this->parent_->control(*this); }
+
+}  // namespace climate
+}  // namespace esphome
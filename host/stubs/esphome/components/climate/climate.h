@@ -0,0 +1,130 @@
+/**
+ * @file climate.h
+ * @brief Host build: climate entity, calls and traits
+ */
+#pragma once
+
+#include "esphome/core/entity_base.h"
+#include "esphome/core/optional.h"
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <vector>
+
+namespace esphome {
+namespace climate {
+
+enum ClimateMode : uint8_t {
+  CLIMATE_MODE_OFF = 0,
+  CLIMATE_MODE_HEAT_COOL = 1,
+  CLIMATE_MODE_COOL = 2,
+  CLIMATE_MODE_HEAT = 3,
+  CLIMATE_MODE_FAN_ONLY = 4,
+  CLIMATE_MODE_DRY = 5,
+  CLIMATE_MODE_AUTO = 6,
+};
+
+enum ClimateAction : uint8_t {
+  CLIMATE_ACTION_OFF = 0,
+  CLIMATE_ACTION_COOLING = 2,
+  CLIMATE_ACTION_HEATING = 3,
+  CLIMATE_ACTION_IDLE = 4,
+  CLIMATE_ACTION_DRYING = 5,
+  CLIMATE_ACTION_FAN = 6,
+};
+
+enum ClimateFeature : uint32_t {
+  CLIMATE_SUPPORTS_CURRENT_TEMPERATURE = 1 << 0,
+  CLIMATE_SUPPORTS_TWO_POINT_TARGET_TEMPERATURE = 1 << 1,
+  CLIMATE_REQUIRES_TWO_POINT_TARGET_TEMPERATURE = 1 << 2,
+  CLIMATE_SUPPORTS_CURRENT_HUMIDITY = 1 << 3,
+  CLIMATE_SUPPORTS_TARGET_HUMIDITY = 1 << 4,
+  CLIMATE_SUPPORTS_ACTION = 1 << 5,
+};
+
+const char *climate_mode_to_string(ClimateMode mode);
+const char *climate_action_to_string(ClimateAction action);
+
+class ClimateTraits {
+ public:
+  void add_supported_mode(ClimateMode mode) { this->supported_modes_.insert(mode); }
+  void set_supported_modes(std::set<ClimateMode> modes) { this->supported_modes_ = std::move(modes); }
+  const std::set<ClimateMode> &get_supported_modes() const { return this->supported_modes_; }
+  bool supports_mode(ClimateMode mode) const { return this->supported_modes_.count(mode) > 0; }
+
+  void add_feature_flags(uint32_t flags) { this->feature_flags_ |= flags; }
+  bool has_feature_flags(uint32_t flags) const { return (this->feature_flags_ & flags) == flags; }
+  uint32_t get_feature_flags() const { return this->feature_flags_; }
+
+  float get_visual_min_temperature() const { return this->visual_min_temperature_; }
+  void set_visual_min_temperature(float min) { this->visual_min_temperature_ = min; }
+  float get_visual_max_temperature() const { return this->visual_max_temperature_; }
+  void set_visual_max_temperature(float max) { this->visual_max_temperature_ = max; }
+  float get_visual_target_temperature_step() const { return this->visual_target_temperature_step_; }
+  void set_visual_temperature_step(float step) {
+    this->visual_target_temperature_step_ = step;
+    this->visual_current_temperature_step_ = step;
+  }
+  void set_visual_target_temperature_step(float step) { this->visual_target_temperature_step_ = step; }
+
+ protected:
+  std::set<ClimateMode> supported_modes_{CLIMATE_MODE_OFF};
+  uint32_t feature_flags_{0};
+  float visual_min_temperature_{10};
+  float visual_max_temperature_{30};
+  float visual_target_temperature_step_{0.1f};
+  float visual_current_temperature_step_{0.1f};
+};
+
+class Climate;
+
+class ClimateCall {
+ public:
+  explicit ClimateCall(Climate *parent) : parent_(parent) {}
+
+  ClimateCall &set_mode(ClimateMode mode) {
+    this->mode_ = mode;
+    return *this;
+  }
+  ClimateCall &set_target_temperature(float target_temperature) {
+    this->target_temperature_ = target_temperature;
+    return *this;
+  }
+  void perform();
+
+  const optional<ClimateMode> &get_mode() const { return this->mode_; }
+  const optional<float> &get_target_temperature() const { return this->target_temperature_; }
+
+ protected:
+  Climate *parent_;
+  optional<ClimateMode> mode_;
+  optional<float> target_temperature_;
+};
+
+class Climate : public EntityBase {
+ public:
+  ClimateCall make_call() { return ClimateCall(this); }
+  ClimateTraits get_traits() { return this->traits(); }
+  void add_on_state_callback(std::function<void(Climate &)> &&callback) {
+    this->callbacks_.push_back(std::move(callback));
+  }
+  void publish_state() {
+    for (auto &callback : this->callbacks_) callback(*this);
+  }
+
+  ClimateMode mode{CLIMATE_MODE_OFF};
+  ClimateAction action{CLIMATE_ACTION_OFF};
+  float current_temperature{NAN};
+  float target_temperature{NAN};
+
+ protected:
+  friend ClimateCall;
+  virtual ClimateTraits traits() = 0;
+  virtual void control(const ClimateCall &call) = 0;
+
+  std::vector<std::function<void(Climate &)>> callbacks_;
+};
+
+}  // namespace climate
+}  // namespace esphome
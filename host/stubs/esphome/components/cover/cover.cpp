@@ -0,0 +1,30 @@
+/**
+ * @file cover.cpp
+ * @brief Host build: cover calls go straight to control()
+ */
+
+#include "cover.h"
+
+namespace esphome {
+namespace cover {
+
+const float COVER_OPEN = 1.0f;
+const float COVER_CLOSED = 0.0f;
+
+const char *cover_operation_to_str(CoverOperation op) {
+  switch (op) {
+    case COVER_OPERATION_IDLE:
+      return "IDLE";
+    case COVER_OPERATION_OPENING:
+      return "OPENING";
+    case COVER_OPERATION_CLOSING:
+      return "CLOSING";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+void CoverCall::perform() { this->parent_->control(*this); }
+
+}  // namespace cover
+}  // namespace esphome
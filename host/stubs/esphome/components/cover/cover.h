@@ -0,0 +1,114 @@
+/**
+ * @file cover.h
+ * @brief Host build: cover entity, calls and traits
+ */
+#pragma once
+
+#include "esphome/core/entity_base.h"
+#include "esphome/core/optional.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace esphome {
+namespace cover {
+
+extern const float COVER_OPEN;
+extern const float COVER_CLOSED;
+
+enum CoverOperation : uint8_t {
+  COVER_OPERATION_IDLE = 0,
+  COVER_OPERATION_OPENING,
+  COVER_OPERATION_CLOSING,
+};
+
+const char *cover_operation_to_str(CoverOperation op);
+
+class CoverTraits {
+ public:
+  bool get_is_assumed_state() const { return this->is_assumed_state_; }
+  void set_is_assumed_state(bool is_assumed_state) { this->is_assumed_state_ = is_assumed_state; }
+  bool get_supports_position() const { return this->supports_position_; }
+  void set_supports_position(bool supports_position) { this->supports_position_ = supports_position; }
+  bool get_supports_tilt() const { return this->supports_tilt_; }
+  void set_supports_tilt(bool supports_tilt) { this->supports_tilt_ = supports_tilt; }
+  bool get_supports_toggle() const { return this->supports_toggle_; }
+  void set_supports_toggle(bool supports_toggle) { this->supports_toggle_ = supports_toggle; }
+  bool get_supports_stop() const { return this->supports_stop_; }
+  void set_supports_stop(bool supports_stop) { this->supports_stop_ = supports_stop; }
+
+ protected:
+  bool is_assumed_state_{false};
+  bool supports_position_{false};
+  bool supports_tilt_{false};
+  bool supports_toggle_{false};
+  bool supports_stop_{false};
+};
+
+class Cover;
+
+class CoverCall {
+ public:
+  explicit CoverCall(Cover *parent) : parent_(parent) {}
+
+  CoverCall &set_command_open() { return this->set_position(COVER_OPEN); }
+  CoverCall &set_command_close() { return this->set_position(COVER_CLOSED); }
+  CoverCall &set_command_stop() {
+    this->stop_ = true;
+    return *this;
+  }
+  CoverCall &set_command_toggle() {
+    this->toggle_ = true;
+    return *this;
+  }
+  CoverCall &set_position(float position) {
+    this->position_ = position;
+    return *this;
+  }
+  CoverCall &set_tilt(float tilt) {
+    this->tilt_ = tilt;
+    return *this;
+  }
+  CoverCall &set_stop(bool stop) {
+    this->stop_ = stop;
+    return *this;
+  }
+  void perform();
+
+  const optional<float> &get_position() const { return this->position_; }
+  const optional<float> &get_tilt() const { return this->tilt_; }
+  bool get_stop() const { return this->stop_; }
+  const optional<bool> &get_toggle() const { return this->toggle_; }
+
+ protected:
+  Cover *parent_;
+  bool stop_{false};
+  optional<float> position_{};
+  optional<float> tilt_{};
+  optional<bool> toggle_{};
+};
+
+class Cover : public EntityBase {
+ public:
+  CoverCall make_call() { return CoverCall(this); }
+  void add_on_state_callback(std::function<void()> &&f) { this->callbacks_.push_back(std::move(f)); }
+  void publish_state(bool save = true) {
+    for (auto &callback : this->callbacks_) callback();
+  }
+  virtual CoverTraits get_traits() = 0;
+  bool is_fully_open() const { return this->position == COVER_OPEN; }
+  bool is_fully_closed() const { return this->position == COVER_CLOSED; }
+
+  CoverOperation current_operation{COVER_OPERATION_IDLE};
+  float position{COVER_OPEN};
+  float tilt{COVER_OPEN};
+
+ protected:
+  friend CoverCall;
+  virtual void control(const CoverCall &call) = 0;
+
+  std::vector<std::function<void()>> callbacks_;
+};
+
+}  // namespace cover
+}  // namespace esphome
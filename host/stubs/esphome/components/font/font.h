@@ -0,0 +1,22 @@
+/**
+ * @file font.h
+ * @brief Host build: a font is one of LVGL's built-in fonts
+ */
+#pragma once
+
+#include <lvgl.h>
+
+namespace esphome {
+namespace font {
+
+class Font {
+ public:
+  explicit Font(const lv_font_t *font) : font_(font) {}
+  const lv_font_t *get_lv_font() const { return this->font_; }
+
+ protected:
+  const lv_font_t *font_;
+};
+
+}  // namespace font
+}  // namespace esphome
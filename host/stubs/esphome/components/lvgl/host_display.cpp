@@ -0,0 +1,99 @@
+/**
+ * @file host_display.cpp
+ * @brief In-memory LVGL display and its refresh timing
+ */
+
+#include "host_display.h"
+#include "esphome/core/hal.h"
+#include <chrono>
+#include <cstdio>
+
+namespace esphome {
+namespace lvgl {
+
+HostDisplay::HostDisplay(uint16_t width, uint16_t height, uint16_t buffer_lines)
+    : width_(width), height_(height), buffer_lines_(buffer_lines) {
+  this->framebuffer_ = std::make_unique<lv_color_t[]>((size_t) width * height);
+  this->draw_buffer_ = std::make_unique<lv_color_t[]>((size_t) width * buffer_lines);
+}
+
+lv_disp_t *HostDisplay::init() {
+  if (this->disp_ != nullptr) return this->disp_;
+  uint32_t buffer_px = (uint32_t) this->width_ * this->buffer_lines_;
+  lv_disp_draw_buf_init(&this->draw_buf_, this->draw_buffer_.get(), nullptr, buffer_px);
+  lv_disp_drv_init(&this->driver_);
+  this->driver_.hor_res = this->width_;
+  this->driver_.ver_res = this->height_;
+  this->driver_.draw_buf = &this->draw_buf_;
+  this->driver_.flush_cb = HostDisplay::flush_cb_;
+  this->driver_.user_data = this;
+  this->disp_ = lv_disp_drv_register(&this->driver_);
+
+  // Timed like the render pacer does it: the refresh timer is the one whose user data
+  // is the display, and it stays so
+  lv_timer_t *timer = lv_timer_get_next(nullptr);
+  while (timer != nullptr && timer->user_data != this->disp_) timer = lv_timer_get_next(timer);
+  this->lvgl_refresh_cb_ = timer->timer_cb;
+  lv_timer_set_cb(timer, HostDisplay::refresh_cb_);
+  return this->disp_;
+}
+
+void HostDisplay::flush_cb_(lv_disp_drv_t *driver, const lv_area_t *area, lv_color_t *pixels) {
+  auto *self = static_cast<HostDisplay *>(driver->user_data);
+  lv_coord_t width = lv_area_get_width(area);
+  for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+    lv_color_t *row = &self->framebuffer_[(size_t) y * self->width_ + area->x1];
+    for (lv_coord_t x = 0; x < width; x++) {
+      row[x] = *pixels++;
+    }
+  }
+  uint32_t px = lv_area_get_size(area);
+  self->frame_px_ += px;
+  self->stats_.flushes++;
+  self->stats_.flushed_px += px;
+  if (self->flush_ns_per_px_ > 0) host::advance_us((uint64_t) px * self->flush_ns_per_px_ / 1000);
+  lv_disp_flush_ready(driver);
+}
+
+// Wall time, also when the test drives millis() with the manual clock
+static uint32_t wall_us() {
+  return (uint32_t) std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void HostDisplay::refresh_cb_(lv_timer_t *timer) {
+  // The user data is the display, also when the render pacer calls through or lv_refr_now() runs the refresh
+  auto *disp = static_cast<lv_disp_t *>(timer->user_data);
+  auto *self = static_cast<HostDisplay *>(disp->driver->user_data);
+
+  self->frame_px_ = 0;
+  uint32_t start_us = wall_us();
+  self->lvgl_refresh_cb_(timer);
+  uint32_t elapsed_us = wall_us() - start_us;
+  if (self->frame_px_ == 0) return;
+
+  FrameStats &stats = self->stats_;
+  stats.frames++;
+  stats.last_frame_px = self->frame_px_;
+  if (self->frame_px_ > stats.max_frame_px) stats.max_frame_px = self->frame_px_;
+  stats.last_frame_us = elapsed_us;
+  stats.total_frame_us += elapsed_us;
+  if (elapsed_us > stats.max_frame_us) stats.max_frame_us = elapsed_us;
+}
+
+bool HostDisplay::save_ppm(const char *path) const {
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr) return false;
+  fprintf(file, "P6\n%u %u\n255\n", (unsigned) this->width_, (unsigned) this->height_);
+  size_t count = (size_t) this->width_ * this->height_;
+  for (size_t i = 0; i < count; i++) {
+    uint32_t rgb = lv_color_to32(this->framebuffer_[i]);
+    uint8_t bytes[3] = {(uint8_t) (rgb >> 16), (uint8_t) (rgb >> 8), (uint8_t) rgb};
+    fwrite(bytes, 1, sizeof(bytes), file);
+  }
+  return fclose(file) == 0;
+}
+
+}  // namespace lvgl
+}  // namespace esphome
@@ -0,0 +1,74 @@
+/**
+ * @file host_display.h
+ * @brief In-memory LVGL display for the host build, with frame counters
+ *
+ * LVGL draws into a partial buffer like on the device; flush_cb copies each
+ * area into a full framebuffer that a test can read or save. The display's
+ * refresh timer is wrapped to time every refresh and count what it flushed,
+ * so render changes can be measured off-device.
+ */
+#pragma once
+
+#include <lvgl.h>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace lvgl {
+
+struct FrameStats {
+  uint32_t frames{0};         // Refreshes that flushed something
+  uint32_t flushes{0};        // flush_cb calls (several per frame with a partial buffer)
+  uint64_t flushed_px{0};     // Area flushed, all frames
+  uint32_t last_frame_px{0};
+  uint32_t max_frame_px{0};
+  uint32_t last_frame_us{0};  // Render and flush time of the last frame
+  uint32_t max_frame_us{0};
+  uint64_t total_frame_us{0};
+
+  uint32_t average_frame_us() const { return this->frames > 0 ? (uint32_t) (this->total_frame_us / this->frames) : 0; }
+};
+
+class HostDisplay {
+ public:
+  HostDisplay(uint16_t width, uint16_t height, uint16_t buffer_lines);
+
+  // Register with LVGL (lv_init() done), becomes the default display
+  lv_disp_t *init();
+  lv_disp_t *get_disp() const { return this->disp_; }
+  uint16_t get_width() const { return this->width_; }
+  uint16_t get_height() const { return this->height_; }
+
+  const FrameStats &get_stats() const { return this->stats_; }
+  void reset_stats() { this->stats_ = FrameStats(); }
+
+  // Framebuffer, row-major, width * height pixels
+  const lv_color_t *get_framebuffer() const { return this->framebuffer_.get(); }
+  lv_color_t get_pixel(uint16_t x, uint16_t y) const { return this->framebuffer_[(size_t) y * this->width_ + x]; }
+  // Binary PPM (P6) of the framebuffer; false if the file can't be written
+  bool save_ppm(const char *path) const;
+
+  // Transfer time of the panel: each flush advances the manual clock by this per pixel,
+  // so what reads micros() around a refresh sees a deterministic render time. 0 = none
+  void set_flush_ns_per_px(uint32_t ns) { this->flush_ns_per_px_ = ns; }
+
+ protected:
+  static void flush_cb_(lv_disp_drv_t *driver, const lv_area_t *area, lv_color_t *pixels);
+  static void refresh_cb_(lv_timer_t *timer);
+
+  uint16_t width_;
+  uint16_t height_;
+  uint16_t buffer_lines_;
+  std::unique_ptr<lv_color_t[]> framebuffer_;
+  std::unique_ptr<lv_color_t[]> draw_buffer_;
+  lv_disp_draw_buf_t draw_buf_{};
+  lv_disp_drv_t driver_{};
+  lv_disp_t *disp_{nullptr};
+  lv_timer_cb_t lvgl_refresh_cb_{nullptr};
+  uint32_t frame_px_{0};  // Flushed by the refresh in progress
+  uint32_t flush_ns_per_px_{0};
+  FrameStats stats_;
+};
+
+}  // namespace lvgl
+}  // namespace esphome
@@ -0,0 +1,44 @@
+/**
+ * @file lvgl_esphome.cpp
+ * @brief Host build: LVGL set up on the in-memory display
+ */
+
+#include "lvgl_esphome.h"
+#include "host_tick.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+extern "C" uint32_t host_tick_ms(void) { return esphome::millis(); }
+
+namespace esphome {
+namespace lvgl {
+
+static const char *const TAG = "lvgl";
+
+LvglComponent::LvglComponent(uint16_t width, uint16_t height, uint16_t buffer_lines)
+    : display_(width, height, buffer_lines) {}
+
+void LvglComponent::setup() {
+  if (!lv_is_initialized()) lv_init();
+  this->display_.init();
+  lv_indev_drv_init(&this->encoder_drv_);
+  this->encoder_drv_.type = LV_INDEV_TYPE_ENCODER;
+  this->encoder_drv_.read_cb = LvglComponent::encoder_read_cb_;
+  this->encoder_drv_.disp = this->display_.get_disp();
+  this->encoder_drv_.user_data = this;
+  lv_indev_drv_register(&this->encoder_drv_);
+  ESP_LOGCONFIG(TAG, "LVGL %d.%d.%d on a %ux%u memory display", LVGL_VERSION_MAJOR, LVGL_VERSION_MINOR,
+                LVGL_VERSION_PATCH, (unsigned) this->display_.get_width(), (unsigned) this->display_.get_height());
+}
+
+void LvglComponent::loop() { lv_timer_handler(); }
+
+void LvglComponent::encoder_read_cb_(lv_indev_drv_t *driver, lv_indev_data_t *data) {
+  auto *self = static_cast<LvglComponent *>(driver->user_data);
+  data->enc_diff = (int16_t) self->encoder_steps_;
+  data->state = self->encoder_pressed_ ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+  self->encoder_steps_ = 0;
+}
+
+}  // namespace lvgl
+}  // namespace esphome
@@ -0,0 +1,45 @@
+/**
+ * @file lvgl_esphome.h
+ * @brief Host build: the lvgl component, on an in-memory display
+ *
+ * With a rotary encoder registered as an LVGL encoder indev, like the
+ * `encoders:` entry of the lvgl config: a test turns and presses it.
+ */
+#pragma once
+
+#include "esphome/core/component.h"
+#include "host_display.h"
+#include <lvgl.h>
+
+namespace esphome {
+namespace lvgl {
+
+class LvglComponent : public PollingComponent {
+ public:
+  // buffer_lines: height of LVGL's draw buffer, a frame is flushed in bands of that many rows
+  LvglComponent(uint16_t width = 240, uint16_t height = 240, uint16_t buffer_lines = 24);
+
+  void setup() override;
+  // lv_timer_handler(): input, animations, refreshes
+  void loop() override;
+  void update() override {}
+  float get_setup_priority() const override { return setup_priority::PROCESSOR; }
+
+  lv_disp_t *get_disp() { return this->display_.get_disp(); }
+  HostDisplay &get_display() { return this->display_; }
+
+  // Read by LVGL's indev timer (every LV_INDEV_DEF_READ_PERIOD ms in loop())
+  void rotate_encoder(int steps) { this->encoder_steps_ += steps; }
+  void set_encoder_pressed(bool pressed) { this->encoder_pressed_ = pressed; }
+
+ protected:
+  static void encoder_read_cb_(lv_indev_drv_t *driver, lv_indev_data_t *data);
+
+  HostDisplay display_;
+  lv_indev_drv_t encoder_drv_{};
+  int encoder_steps_{0};
+  bool encoder_pressed_{false};
+};
+
+}  // namespace lvgl
+}  // namespace esphome
@@ -0,0 +1,70 @@
+/**
+ * @file online_image.h
+ * @brief Host build: an online_image whose downloads the test completes or fails
+ *
+ * update() only records the request; the test plays the HTTP server with
+ * finish() (a decoded RGB565 frame of one colour) or fail().
+ */
+#pragma once
+
+#include "esphome/components/lvgl/lvgl_esphome.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace online_image {
+
+class OnlineImage {
+ public:
+  void set_url(const std::string &url) { this->url_ = url; }
+  void update() {
+    this->requests_++;
+    this->pending_ = true;
+  }
+  void release() {
+    this->data_.clear();
+    this->dsc_.data = nullptr;
+    this->dsc_.data_size = 0;
+  }
+  void add_on_finished_callback(std::function<void(bool)> &&callback) {
+    this->finished_.push_back(std::move(callback));
+  }
+  void add_on_error_callback(std::function<void()> &&callback) { this->error_.push_back(std::move(callback)); }
+  lv_img_dsc_t *get_lv_img_dsc() { return &this->dsc_; }
+
+  // Host side: the download in flight
+  bool is_pending() const { return this->pending_; }
+  const std::string &get_url() const { return this->url_; }
+  uint32_t get_requests() const { return this->requests_; }
+  void finish(uint16_t width, uint16_t height, uint16_t color) {
+    this->data_.assign((size_t) width * height * 2, 0);
+    for (size_t i = 0; i < this->data_.size(); i += 2) {
+      this->data_[i] = color & 0xFF;
+      this->data_[i + 1] = color >> 8;
+    }
+    this->dsc_.header.cf = LV_IMG_CF_TRUE_COLOR;
+    this->dsc_.header.w = width;
+    this->dsc_.header.h = height;
+    this->dsc_.data_size = this->data_.size();
+    this->dsc_.data = this->data_.data();
+    this->pending_ = false;
+    for (auto &callback : this->finished_) callback(false);
+  }
+  void fail() {
+    this->pending_ = false;
+    for (auto &callback : this->error_) callback();
+  }
+
+ protected:
+  std::string url_;
+  bool pending_{false};
+  uint32_t requests_{0};
+  std::vector<uint8_t> data_;
+  lv_img_dsc_t dsc_{};
+  std::vector<std::function<void(bool)>> finished_;
+  std::vector<std::function<void()>> error_;
+};
+
+}  // namespace online_image
+}  // namespace esphome
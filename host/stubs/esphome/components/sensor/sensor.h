@@ -0,0 +1,38 @@
+/**
+ * @file sensor.h
+ * @brief Host build: a sensor keeps its last published state
+ */
+#pragma once
+
+#include "esphome/core/entity_base.h"
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace esphome {
+namespace sensor {
+
+class Sensor : public EntityBase {
+ public:
+  void publish_state(float state) {
+    this->state = state;
+    this->has_state_ = true;
+    this->publishes_++;
+    for (auto &callback : this->callbacks_) callback(state);
+  }
+  void add_on_state_callback(std::function<void(float)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  float get_state() const { return this->state; }
+  bool has_state() const { return this->has_state_; }
+  // Host build: number of publish_state() calls
+  uint32_t get_publish_count() const { return this->publishes_; }
+
+  float state{NAN};
+
+ protected:
+  std::vector<std::function<void(float)>> callbacks_;
+  bool has_state_{false};
+  uint32_t publishes_{0};
+};
+
+}  // namespace sensor
+}  // namespace esphome
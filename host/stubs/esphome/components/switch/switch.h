@@ -0,0 +1,34 @@
+/**
+ * @file switch.h
+ * @brief Host build: switch entity, write_state() is up to the subclass
+ */
+#pragma once
+
+#include "esphome/core/entity_base.h"
+#include <functional>
+#include <vector>
+
+namespace esphome {
+namespace switch_ {
+
+class Switch : public EntityBase {
+ public:
+  void turn_on() { this->write_state(true); }
+  void turn_off() { this->write_state(false); }
+  void toggle() { this->write_state(!this->state); }
+  void publish_state(bool state) {
+    this->state = state;
+    for (auto &callback : this->callbacks_) callback(state);
+  }
+  void add_on_state_callback(std::function<void(bool)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+
+  bool state{false};
+
+ protected:
+  virtual void write_state(bool state) = 0;
+
+  std::vector<std::function<void(bool)>> callbacks_;
+};
+
+}  // namespace switch_
+}  // namespace esphome
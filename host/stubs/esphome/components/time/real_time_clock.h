@@ -0,0 +1,37 @@
+/**
+ * @file real_time_clock.h
+ * @brief Host build: wall clock of the machine, or a fixed time set by the test
+ */
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/time.h"
+#include <ctime>
+
+namespace esphome {
+namespace time {
+
+class RealTimeClock : public PollingComponent {
+ public:
+  ESPTime now() {
+    if (this->fixed_) return this->fixed_time_;
+    time_t t = ::time(nullptr);
+    struct tm c_tm;
+    localtime_r(&t, &c_tm);
+    return ESPTime::from_c_tm(&c_tm, t);
+  }
+  void update() override {}
+
+  // Host build: freeze the clock (a rendering test wants the same idle screen every run)
+  void set_fixed_time(const ESPTime &time) {
+    this->fixed_time_ = time;
+    this->fixed_ = true;
+  }
+
+ protected:
+  ESPTime fixed_time_{};
+  bool fixed_{false};
+};
+
+}  // namespace time
+}  // namespace esphome
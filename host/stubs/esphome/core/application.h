@@ -0,0 +1,72 @@
+/**
+ * @file application.h
+ * @brief Host build: the App singleton, its component list and scheduler
+ */
+#pragma once
+
+#include "component.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace esphome {
+
+class Scheduler {
+ public:
+  void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
+  void set_timeout(Component *component, const char *name, uint32_t timeout, std::function<void()> func) {
+    this->set_timeout(component, std::string(name), timeout, std::move(func));
+  }
+  bool cancel_timeout(Component *component, const std::string &name);
+  bool cancel_timeout(Component *component, const char *name) {
+    return this->cancel_timeout(component, std::string(name));
+  }
+  void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> func);
+  bool cancel_interval(Component *component, const std::string &name);
+
+  // Run what is due; returns the number of items run
+  size_t call();
+  // Milliseconds until the next item is due, UINT32_MAX if none
+  uint32_t next_due_in() const;
+
+ protected:
+  struct Item {
+    Component *component;
+    std::string name;  // Empty: anonymous, never replaced
+    uint32_t next_ms;
+    uint32_t interval_ms;  // 0 for a timeout
+    std::function<void()> func;
+    bool removed;
+  };
+  void add_(Component *component, const std::string &name, uint32_t delay, uint32_t interval,
+            std::function<void()> &&func);
+  bool cancel_(Component *component, const std::string &name, bool interval);
+
+  std::vector<Item> items_;
+};
+
+class Application {
+ public:
+  void register_component(Component *component);
+  // setup() of every component, by decreasing setup priority
+  void setup();
+  // One pass: scheduler, then loop() of the components that did not disable it
+  void loop();
+  void dump_config();
+  // Loop until the scheduler and components have run for `ms` (host time)
+  void run_for(uint32_t ms);
+
+  const std::vector<Component *> &get_components() const { return this->components_; }
+  uint32_t get_loop_count() const { return this->loop_count_; }
+
+  Scheduler scheduler;
+
+ protected:
+  std::vector<Component *> components_;
+  uint32_t loop_count_{0};
+};
+
+extern Application App;
+
+}  // namespace esphome
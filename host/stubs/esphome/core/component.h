@@ -0,0 +1,78 @@
+/**
+ * @file component.h
+ * @brief Host build: Component and PollingComponent, scheduled by App
+ */
+#pragma once
+
+#include "optional.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace esphome {
+
+namespace setup_priority {
+extern const float BUS;
+extern const float IO;
+extern const float HARDWARE;
+extern const float DATA;
+extern const float PROCESSOR;
+extern const float WIFI;
+extern const float BEFORE_CONNECTION;
+extern const float AFTER_WIFI;
+extern const float AFTER_CONNECTION;
+extern const float LATE;
+}  // namespace setup_priority
+
+class Component {
+ public:
+  virtual ~Component() = default;
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual float get_setup_priority() const { return setup_priority::DATA; }
+  virtual float get_loop_priority() const { return 0.0f; }
+
+  void mark_failed() { this->failed_ = true; }
+  bool is_failed() const { return this->failed_; }
+  // Stop / resume calling loop(), setup() and the scheduler are not affected
+  void disable_loop() { this->loop_enabled_ = false; }
+  void enable_loop() { this->loop_enabled_ = true; }
+  bool is_loop_enabled() const { return this->loop_enabled_; }
+
+  // Called by App
+  void call_setup();
+  void call_loop();
+  void call_dump_config() { this->dump_config(); }
+  bool is_setup() const { return this->setup_done_; }
+
+ protected:
+  void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);
+  void set_timeout(uint32_t timeout, std::function<void()> &&f);
+  bool cancel_timeout(const std::string &name);
+  void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);
+  void set_interval(uint32_t interval, std::function<void()> &&f);
+  bool cancel_interval(const std::string &name);
+  void defer(std::function<void()> &&f);
+  void defer(const std::string &name, std::function<void()> &&f);
+
+  bool failed_{false};
+  bool loop_enabled_{true};
+  bool setup_done_{false};
+};
+
+class PollingComponent : public Component {
+ public:
+  PollingComponent() = default;
+  explicit PollingComponent(uint32_t update_interval) : update_interval_(update_interval) {}
+  virtual void update() = 0;
+  void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
+  uint32_t get_update_interval() const { return this->update_interval_; }
+  // Starts the update interval after setup()
+  void start_poller();
+
+ protected:
+  uint32_t update_interval_{0};
+};
+
+}  // namespace esphome
@@ -0,0 +1,15 @@
+/**
+ * @file defines.h
+ * @brief Host build: what codegen would define for a dial with every app
+ */
+#pragma once
+
+#define USE_API
+#define USE_LVGL
+#define USE_DIAL_MENU_CLIMATE
+#define USE_DIAL_MENU_COVER
+#define USE_DIAL_MENU_COVER_HA
+#define USE_DIAL_MENU_LIGHT
+#define USE_DIAL_MENU_MEDIA_PLAYER
+#define USE_DIAL_MENU_ALBUM_ART
+#define USE_DIAL_MENU_NUMBER
@@ -0,0 +1,20 @@
+/**
+ * @file entity_base.h
+ * @brief Host build: name of an entity
+ */
+#pragma once
+
+#include "string_ref.h"
+
+namespace esphome {
+
+class EntityBase {
+ public:
+  void set_name(const char *name) { this->name_ = StringRef(name); }
+  const StringRef &get_name() const { return this->name_; }
+
+ protected:
+  StringRef name_;
+};
+
+}  // namespace esphome
@@ -0,0 +1,24 @@
+/**
+ * @file hal.h
+ * @brief Host build: time base, real or driven by the test
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void yield();
+
+namespace host {
+
+// Manual clock: millis() / micros() only move with advance_us(), the scheduler becomes deterministic
+void set_manual_clock(bool manual);
+void advance_us(uint64_t us);
+inline void advance_ms(uint32_t ms) { advance_us((uint64_t) ms * 1000); }
+
+}  // namespace host
+}  // namespace esphome
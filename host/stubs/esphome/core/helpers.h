@@ -0,0 +1,126 @@
+/**
+ * @file helpers.h
+ * @brief Host build: the ESPHome helpers the components use
+ */
+#pragma once
+
+#include "optional.h"
+#include "string_ref.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define ONOFF(b) ((b) ? "ON" : "OFF")
+#define YESNO(b) ((b) ? "YES" : "NO")
+#define TRUEFALSE(b) ((b) ? "TRUE" : "FALSE")
+
+namespace esphome {
+
+using std::clamp;
+using std::to_string;
+
+// 32-bit FNV-1 hash, as ESPHome uses for preference keys
+inline uint32_t fnv1_hash(const char *str) {
+  uint32_t hash = 2166136261UL;
+  for (; str != nullptr && *str != '\0'; str++) {
+    hash *= 16777619UL;
+    hash ^= (uint8_t) *str;
+  }
+  return hash;
+}
+inline uint32_t fnv1_hash(const std::string &str) { return fnv1_hash(str.c_str()); }
+
+template<typename T> optional<T> parse_number(const char *str);
+template<> inline optional<float> parse_number<float>(const char *str) {
+  char *end = nullptr;
+  float value = ::strtof(str, &end);
+  if (end == str || *end != '\0' || std::isnan(value)) return {};
+  return value;
+}
+template<> inline optional<int> parse_number<int>(const char *str) {
+  char *end = nullptr;
+  long value = ::strtol(str, &end, 10);
+  if (end == str || *end != '\0') return {};
+  return (int) value;
+}
+template<typename T> optional<T> parse_number(const std::string &str) { return parse_number<T>(str.c_str()); }
+template<typename T> optional<T> parse_number(StringRef str) { return parse_number<T>(str.str()); }
+
+inline bool str_equals_case_insensitive(const std::string &a, const std::string &b) {
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+           return std::tolower((unsigned char) x) == std::tolower((unsigned char) y);
+         });
+}
+
+template<typename... X> class CallbackManager;
+
+/// Callbacks registered with add(), all called by call()
+template<typename... Ts> class CallbackManager<void(Ts...)> {
+ public:
+  void add(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  void call(Ts... args) {
+    for (auto &callback : this->callbacks_) callback(args...);
+  }
+  size_t size() const { return this->callbacks_.size(); }
+  void operator()(Ts... args) { this->call(args...); }
+
+ protected:
+  std::vector<std::function<void(Ts...)>> callbacks_;
+};
+
+/// Vector sized once with init(), as used by the API messages
+template<typename T> class FixedVector {
+ public:
+  void init(size_t capacity) {
+    this->data_ = std::make_unique<T[]>(capacity);
+    this->capacity_ = capacity;
+    this->size_ = 0;
+  }
+  T &emplace_back() { return this->data_[this->size_++]; }
+  void push_back(const T &value) { this->data_[this->size_++] = value; }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  T &operator[](size_t i) { return this->data_[i]; }
+  const T &operator[](size_t i) const { return this->data_[i]; }
+  T *begin() { return this->data_.get(); }
+  T *end() { return this->data_.get() + this->size_; }
+  const T *begin() const { return this->data_.get(); }
+  const T *end() const { return this->data_.get() + this->size_; }
+
+ protected:
+  std::unique_ptr<T[]> data_;
+  size_t capacity_{0};
+  size_t size_{0};
+};
+
+/// Mutex as in ESPHome (a FreeRTOS semaphore on ESP32), std::mutex here
+class Mutex {
+ public:
+  Mutex() = default;
+  Mutex(const Mutex &) = delete;
+  Mutex &operator=(const Mutex &) = delete;
+  void lock() { this->mutex_.lock(); }
+  bool try_lock() { return this->mutex_.try_lock(); }
+  void unlock() { this->mutex_.unlock(); }
+
+ protected:
+  std::mutex mutex_;
+};
+
+/// Holds a Mutex for its scope
+class LockGuard {
+ public:
+  explicit LockGuard(Mutex &mutex) : mutex_(mutex) { this->mutex_.lock(); }
+  ~LockGuard() { this->mutex_.unlock(); }
+
+ protected:
+  Mutex &mutex_;
+};
+
+}  // namespace esphome
@@ -0,0 +1,253 @@
+/**
+ * @file host_core.cpp
+ * @brief Host build: clock, logging, preferences, scheduler and App
+ */
+
+#include "application.h"
+#include "component.h"
+#include "hal.h"
+#include "log.h"
+#include "preferences.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace esphome {
+
+// ---- Clock ----
+
+static bool manual_clock = false;
+static uint64_t manual_us = 0;
+
+static uint64_t now_us() {
+  if (manual_clock) return manual_us;
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t millis() { return (uint32_t) (now_us() / 1000); }
+uint32_t micros() { return (uint32_t) now_us(); }
+void yield() { std::this_thread::yield(); }
+void delay(uint32_t ms) {
+  if (manual_clock) {
+    manual_us += (uint64_t) ms * 1000;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+namespace host {
+void set_manual_clock(bool manual) {
+  if (manual && !manual_clock) manual_us = now_us();
+  manual_clock = manual;
+}
+void advance_us(uint64_t us) { manual_us += us; }
+}  // namespace host
+
+// ---- Logging ----
+
+static int log_level = ESPHOME_LOG_LEVEL_INFO;
+static const char LEVEL_LETTERS[] = "?EWICDVV";
+
+void esp_log_printf_(int level, const char *tag, int line, const char *format, ...) {
+  if (level > log_level) return;
+  va_list args;
+  va_start(args, format);
+  printf("[%c][%s:%03d]: ", LEVEL_LETTERS[level], tag, line);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+namespace host {
+void set_log_level(int level) { log_level = level; }
+}  // namespace host
+
+// ---- Preferences ----
+
+static std::map<uint32_t, std::vector<uint8_t>> preference_store;
+static uint32_t preference_writes = 0;
+static ESPPreferences host_preferences;
+ESPPreferences *global_preferences = &host_preferences;
+
+bool ESPPreferenceObject::save_(const void *src) {
+  if (this->size_ == 0) return false;
+  auto &slot = preference_store[this->key_];
+  const auto *bytes = static_cast<const uint8_t *>(src);
+  if (slot.size() == this->size_ && memcmp(slot.data(), bytes, this->size_) == 0) return true;
+  slot.assign(bytes, bytes + this->size_);
+  preference_writes++;
+  return true;
+}
+
+bool ESPPreferenceObject::load_(void *dest) {
+  auto it = preference_store.find(this->key_);
+  if (it == preference_store.end() || it->second.size() != this->size_) return false;
+  memcpy(dest, it->second.data(), this->size_);
+  return true;
+}
+
+namespace host {
+void clear_preferences() { preference_store.clear(); }
+uint32_t get_preference_writes() { return preference_writes; }
+}  // namespace host
+
+// ---- Components ----
+
+namespace setup_priority {
+const float BUS = 1000.0f;
+const float IO = 900.0f;
+const float HARDWARE = 800.0f;
+const float DATA = 600.0f;
+const float PROCESSOR = 400.0f;
+const float WIFI = 250.0f;
+const float BEFORE_CONNECTION = 220.0f;
+const float AFTER_WIFI = 200.0f;
+const float AFTER_CONNECTION = 100.0f;
+const float LATE = -100.0f;
+}  // namespace setup_priority
+
+void Component::call_setup() {
+  this->setup();
+  this->setup_done_ = true;
+}
+
+void Component::call_loop() {
+  if (this->loop_enabled_ && !this->failed_) this->loop();
+}
+
+void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {
+  App.scheduler.set_timeout(this, name, timeout, std::move(f));
+}
+void Component::set_timeout(uint32_t timeout, std::function<void()> &&f) {
+  App.scheduler.set_timeout(this, std::string(), timeout, std::move(f));
+}
+bool Component::cancel_timeout(const std::string &name) { return App.scheduler.cancel_timeout(this, name); }
+void Component::set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f) {
+  App.scheduler.set_interval(this, name, interval, std::move(f));
+}
+void Component::set_interval(uint32_t interval, std::function<void()> &&f) {
+  App.scheduler.set_interval(this, std::string(), interval, std::move(f));
+}
+bool Component::cancel_interval(const std::string &name) { return App.scheduler.cancel_interval(this, name); }
+void Component::defer(std::function<void()> &&f) { App.scheduler.set_timeout(this, std::string(), 0, std::move(f)); }
+void Component::defer(const std::string &name, std::function<void()> &&f) {
+  App.scheduler.set_timeout(this, name, 0, std::move(f));
+}
+
+void PollingComponent::start_poller() {
+  if (this->update_interval_ == 0) return;
+  this->set_interval("update", this->update_interval_, [this]() { this->update(); });
+}
+
+// ---- Scheduler ----
+
+void Scheduler::add_(Component *component, const std::string &name, uint32_t delay, uint32_t interval,
+                     std::function<void()> &&func) {
+  if (!name.empty()) this->cancel_(component, name, interval != 0);
+  this->items_.push_back(Item{component, name, millis() + delay, interval, std::move(func), false});
+}
+
+bool Scheduler::cancel_(Component *component, const std::string &name, bool interval) {
+  bool found = false;
+  for (auto &item : this->items_) {
+    if (!item.removed && item.component == component && item.name == name && (item.interval_ms != 0) == interval) {
+      item.removed = true;
+      found = true;
+    }
+  }
+  return found;
+}
+
+void Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
+                            std::function<void()> func) {
+  this->add_(component, name, timeout, 0, std::move(func));
+}
+bool Scheduler::cancel_timeout(Component *component, const std::string &name) {
+  return this->cancel_(component, name, false);
+}
+void Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
+                             std::function<void()> func) {
+  this->add_(component, name, interval, interval, std::move(func));
+}
+bool Scheduler::cancel_interval(Component *component, const std::string &name) {
+  return this->cancel_(component, name, true);
+}
+
+size_t Scheduler::call() {
+  uint32_t now = millis();
+  size_t ran = 0;
+  // Items added while running wait for the next call, like on the device
+  size_t count = this->items_.size();
+  for (size_t i = 0; i < count; i++) {
+    if (this->items_[i].removed || (int32_t) (now - this->items_[i].next_ms) < 0) continue;
+    // The vector may grow while the callback runs: work on a copy of the function
+    std::function<void()> func = this->items_[i].func;
+    if (this->items_[i].interval_ms == 0) {
+      this->items_[i].removed = true;
+    } else {
+      this->items_[i].next_ms = now + this->items_[i].interval_ms;
+    }
+    func();
+    ran++;
+  }
+  this->items_.erase(std::remove_if(this->items_.begin(), this->items_.end(), [](const Item &item) { return item.removed; }),
+                     this->items_.end());
+  return ran;
+}
+
+uint32_t Scheduler::next_due_in() const {
+  uint32_t now = millis();
+  uint32_t next = UINT32_MAX;
+  for (const auto &item : this->items_) {
+    if (item.removed) continue;
+    int32_t due = (int32_t) (item.next_ms - now);
+    next = std::min<uint32_t>(next, due < 0 ? 0 : (uint32_t) due);
+  }
+  return next;
+}
+
+// ---- Application ----
+
+Application App;
+
+void Application::register_component(Component *component) { this->components_.push_back(component); }
+
+void Application::setup() {
+  std::stable_sort(this->components_.begin(), this->components_.end(), [](Component *a, Component *b) {
+    return a->get_setup_priority() > b->get_setup_priority();
+  });
+  for (auto *component : this->components_) {
+    component->call_setup();
+    // Components set up earlier keep running while the later ones are set up
+    this->scheduler.call();
+  }
+}
+
+void Application::loop() {
+  this->scheduler.call();
+  for (auto *component : this->components_) {
+    component->call_loop();
+  }
+  this->loop_count_++;
+}
+
+void Application::dump_config() {
+  for (auto *component : this->components_) {
+    component->call_dump_config();
+  }
+}
+
+void Application::run_for(uint32_t ms) {
+  uint32_t start = millis();
+  while (millis() - start < ms) {
+    this->loop();
+    delay(1);
+  }
+}
+
+}  // namespace esphome
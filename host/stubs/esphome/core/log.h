@@ -0,0 +1,43 @@
+/**
+ * @file log.h
+ * @brief Host build: ESPHome's log macros, printed to stdout
+ */
+#pragma once
+
+#include <cstdarg>
+
+namespace esphome {
+
+static const int ESPHOME_LOG_LEVEL_NONE = 0;
+static const int ESPHOME_LOG_LEVEL_ERROR = 1;
+static const int ESPHOME_LOG_LEVEL_WARN = 2;
+static const int ESPHOME_LOG_LEVEL_INFO = 3;
+static const int ESPHOME_LOG_LEVEL_CONFIG = 4;
+static const int ESPHOME_LOG_LEVEL_DEBUG = 5;
+static const int ESPHOME_LOG_LEVEL_VERBOSE = 6;
+static const int ESPHOME_LOG_LEVEL_VERY_VERBOSE = 7;
+
+void esp_log_printf_(int level, const char *tag, int line, const char *format, ...)
+    __attribute__((format(printf, 4, 5)));
+
+namespace host {
+
+// Messages above this level are dropped (default: ESPHOME_LOG_LEVEL_INFO)
+void set_log_level(int level);
+
+}  // namespace host
+}  // namespace esphome
+
+#define ESP_LOGE(tag, ...) ::esphome::esp_log_printf_(::esphome::ESPHOME_LOG_LEVEL_ERROR, tag, __LINE__, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) ::esphome::esp_log_printf_(::esphome::ESPHOME_LOG_LEVEL_WARN, tag, __LINE__, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) ::esphome::esp_log_printf_(::esphome::ESPHOME_LOG_LEVEL_INFO, tag, __LINE__, __VA_ARGS__)
+#define ESP_LOGCONFIG(tag, ...) \
+  ::esphome::esp_log_printf_(::esphome::ESPHOME_LOG_LEVEL_CONFIG, tag, __LINE__, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) ::esphome::esp_log_printf_(::esphome::ESPHOME_LOG_LEVEL_DEBUG, tag, __LINE__, __VA_ARGS__)
+#define ESP_LOGV(tag, ...) \
+  ::esphome::esp_log_printf_(::esphome::ESPHOME_LOG_LEVEL_VERBOSE, tag, __LINE__, __VA_ARGS__)
+#define ESP_LOGVV(tag, ...) \
+  ::esphome::esp_log_printf_(::esphome::ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, __LINE__, __VA_ARGS__)
+
+#define LOG_STR(s) (s)
+#define LOG_STR_ARG(s) (s)
@@ -0,0 +1,15 @@
+/**
+ * @file optional.h
+ * @brief Host build: ESPHome's optional is std::optional here
+ */
+#pragma once
+
+#include <optional>
+
+namespace esphome {
+
+template<typename T> using optional = std::optional<T>;
+using std::nullopt;
+using std::nullopt_t;
+
+}  // namespace esphome
@@ -0,0 +1,55 @@
+/**
+ * @file preferences.h
+ * @brief Host build: preferences kept in memory for the life of the process
+ *
+ * A test "reboots" by building new components against the same store; the
+ * store itself can be cleared with host::clear_preferences().
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+
+class ESPPreferenceObject {
+ public:
+  ESPPreferenceObject() = default;
+  ESPPreferenceObject(uint32_t key, size_t size) : key_(key), size_(size) {}
+
+  template<typename T> bool save(const T *src) {
+    if (this->size_ != sizeof(T)) return false;
+    return this->save_(src);
+  }
+  template<typename T> bool load(T *dest) {
+    if (this->size_ != sizeof(T)) return false;
+    return this->load_(dest);
+  }
+
+ protected:
+  bool save_(const void *src);
+  bool load_(void *dest);
+
+  uint32_t key_{0};
+  size_t size_{0};
+};
+
+class ESPPreferences {
+ public:
+  template<typename T> ESPPreferenceObject make_preference(uint32_t key, bool in_flash) {
+    return ESPPreferenceObject(key, sizeof(T));
+  }
+  template<typename T> ESPPreferenceObject make_preference(uint32_t key) { return ESPPreferenceObject(key, sizeof(T)); }
+  bool sync() { return true; }
+};
+
+extern ESPPreferences *global_preferences;
+
+namespace host {
+
+void clear_preferences();
+// Number of save() calls that changed the store
+uint32_t get_preference_writes();
+
+}  // namespace host
+}  // namespace esphome
@@ -0,0 +1,58 @@
+/**
+ * @file string_ref.h
+ * @brief Host build: non-owning string view, same interface as ESPHome's StringRef
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace esphome {
+
+class StringRef {
+ public:
+  using value_type = char;
+  using size_type = size_t;
+  using const_iterator = const char *;
+
+  constexpr StringRef() : base_(""), len_(0) {}
+  explicit StringRef(const std::string &s) : base_(s.c_str()), len_(s.size()) {}
+  explicit StringRef(const char *s) : base_(s), len_(strlen(s)) {}
+  constexpr StringRef(const char *s, size_t n) : base_(s), len_(n) {}
+
+  template<size_t N> static constexpr StringRef from_lit(const char (&s)[N]) { return StringRef(s, N - 1); }
+
+  constexpr const char *c_str() const { return this->base_; }
+  constexpr const char *data() const { return this->base_; }
+  constexpr size_t size() const { return this->len_; }
+  constexpr size_t length() const { return this->len_; }
+  constexpr bool empty() const { return this->len_ == 0; }
+  constexpr const_iterator begin() const { return this->base_; }
+  constexpr const_iterator end() const { return this->base_ + this->len_; }
+  constexpr char operator[](size_t i) const { return this->base_[i]; }
+
+  std::string str() const { return std::string(this->base_, this->len_); }
+  operator std::string() const { return this->str(); }
+
+ private:
+  const char *base_;
+  size_t len_;
+};
+
+inline bool operator==(const StringRef &lhs, const StringRef &rhs) {
+  return lhs.size() == rhs.size() && memcmp(lhs.c_str(), rhs.c_str(), lhs.size()) == 0;
+}
+inline bool operator==(const StringRef &lhs, const char *rhs) {
+  return lhs.size() == strlen(rhs) && memcmp(lhs.c_str(), rhs, lhs.size()) == 0;
+}
+inline bool operator==(const StringRef &lhs, const std::string &rhs) {
+  return lhs.size() == rhs.size() && memcmp(lhs.c_str(), rhs.c_str(), lhs.size()) == 0;
+}
+inline bool operator==(const char *lhs, const StringRef &rhs) { return rhs == lhs; }
+inline bool operator==(const std::string &lhs, const StringRef &rhs) { return rhs == lhs; }
+inline bool operator!=(const StringRef &lhs, const StringRef &rhs) { return !(lhs == rhs); }
+inline bool operator!=(const StringRef &lhs, const char *rhs) { return !(lhs == rhs); }
+inline bool operator!=(const StringRef &lhs, const std::string &rhs) { return !(lhs == rhs); }
+
+}  // namespace esphome
@@ -0,0 +1,47 @@
+/**
+ * @file time.h
+ * @brief Host build: broken-down time, as ESPHome's ESPTime
+ */
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+
+namespace esphome {
+
+struct ESPTime {
+  uint8_t second;
+  uint8_t minute;
+  uint8_t hour;
+  uint8_t day_of_week;   // 1 = Sunday
+  uint8_t day_of_month;  // 1-31
+  uint16_t day_of_year;  // 1-366
+  uint8_t month;         // 1-12
+  uint16_t year;
+  bool is_dst;
+  time_t timestamp;
+
+  bool is_valid() const { return this->year >= 2019 && this->fields_in_range(); }
+  bool fields_in_range() const {
+    return this->second < 61 && this->minute < 60 && this->hour < 24 && this->day_of_week > 0 &&
+           this->day_of_week < 8 && this->day_of_month > 0 && this->day_of_month < 32 && this->month > 0 &&
+           this->month < 13;
+  }
+
+  static ESPTime from_c_tm(const struct tm *c_tm, time_t c_time) {
+    ESPTime res{};
+    res.second = c_tm->tm_sec;
+    res.minute = c_tm->tm_min;
+    res.hour = c_tm->tm_hour;
+    res.day_of_week = c_tm->tm_wday + 1;
+    res.day_of_month = c_tm->tm_mday;
+    res.day_of_year = c_tm->tm_yday + 1;
+    res.month = c_tm->tm_mon + 1;
+    res.year = c_tm->tm_year + 1900;
+    res.is_dst = c_tm->tm_isdst > 0;
+    res.timestamp = c_time;
+    return res;
+  }
+};
+
+}  // namespace esphome
@@ -0,0 +1,49 @@
+/**
+ * @file host_test.h
+ * @brief Checks for the host tests: plain executables run by ctest
+ *
+ * A failed check prints where and what, the test carries on; main() returns
+ * host_test::result() so ctest sees the failures.
+ */
+#pragma once
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+namespace host_test {
+
+inline int &failures() {
+  static int count = 0;
+  return count;
+}
+
+inline bool check(bool ok, const char *expr, const char *file, int line, const std::string &detail = "") {
+  if (!ok) {
+    failures()++;
+    fprintf(stderr, "%s:%d: check failed: %s%s\n", file, line, expr, detail.c_str());
+  }
+  return ok;
+}
+
+template<typename A, typename B> std::string values(const A &a, const B &b) {
+  std::ostringstream out;
+  out << " (" << a << " vs " << b << ")";
+  return out.str();
+}
+
+inline int result() {
+  if (failures() > 0) {
+    fprintf(stderr, "%d check(s) failed\n", failures());
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
+
+}  // namespace host_test
+
+#define CHECK(cond) ::host_test::check((cond), #cond, __FILE__, __LINE__)
+#define CHECK_EQ(a, b) ::host_test::check((a) == (b), #a " == " #b, __FILE__, __LINE__, ::host_test::values((a), (b)))
+#define CHECK_LE(a, b) ::host_test::check((a) <= (b), #a " <= " #b, __FILE__, __LINE__, ::host_test::values((a), (b)))
+#define CHECK_GE(a, b) ::host_test::check((a) >= (b), #a " >= " #b, __FILE__, __LINE__, ::host_test::values((a), (b)))
@@ -0,0 +1,117 @@
+/**
+ * @file test_album_art.cpp
+ * @brief Album art: LRU by picture URL, failed downloads backed off
+ *
+ * On the manual clock, with the online_image stand-in playing the HTTP
+ * server: a failed URL is only requested again once its backoff (10 s, then
+ * doubled) has passed, and art kept in the cache is shown without a download.
+ */
+
+#include "host_test.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/components/api/api_server.h"
+#include "esphome/components/lvgl/lvgl_esphome.h"
+#include "esphome/components/online_image/online_image.h"
+#include "esphome/components/homeassistant_addon/homeassistant_media_player.h"
+#include "esphome/components/dial_menu/dial_menu_controller.h"
+#include "esphome/components/dial_menu/media_player_app.h"
+
+using namespace esphome;
+
+static const char *const ENTITY = "media_player.kitchen";
+static const char *const BASE_URL = "http://ha.local:8123";
+
+struct Setup {
+  Setup() : lvgl(240, 240) {
+    this->player.set_entity_id(ENTITY);
+    this->music.set_name("Music");
+    this->music.set_icon("music");
+    this->music.set_controller(&this->menu);
+    this->music.set_media_player(&this->player);
+    this->music.set_album_art_image(&this->image);
+    this->music.set_album_art_base_url(BASE_URL);
+    this->music.set_album_art_cache_size(2);
+    this->music.set_index(0);
+    this->music.set_position(0, -80);
+    this->menu.add_app(&this->music);
+    this->menu.set_lvgl(&this->lvgl);
+    // The retries take longer than the idle timeout
+    this->menu.set_idle_timeout(0);
+    for (Component *component : std::vector<Component *>{&this->api, &this->player, &this->lvgl, &this->menu}) {
+      App.register_component(component);
+    }
+  }
+
+  void picture(const char *path) {
+    this->api.inject_state(ENTITY, "entity_picture", path);
+    App.run_for(100);
+  }
+
+  api::APIServer api;
+  lvgl::LvglComponent lvgl;
+  homeassistant_addon::HomeassistantMediaPlayer player;
+  online_image::OnlineImage image;
+  dial_menu::DialMenuController menu;
+  dial_menu::MediaPlayerApp music;
+};
+
+int main() {
+  host::set_manual_clock(true);
+  Setup s;
+  App.setup();
+  App.run_for(1000);
+  s.api.inject_state(ENTITY, "", "playing");
+  s.picture("/api/media_player_proxy/a");
+
+  // Hidden: nothing downloaded until the app is opened
+  CHECK_EQ(s.image.get_requests(), 0u);
+  s.menu.select_app(0);
+  s.menu.on_button_click();
+  App.run_for(300);
+  CHECK_EQ(s.image.get_requests(), 1u);
+  CHECK(s.image.is_pending());
+  CHECK_EQ(s.image.get_url(), std::string(BASE_URL) + "/api/media_player_proxy/a");
+
+  // A failed download is not repeated on every update
+  s.image.fail();
+  App.run_for(100);
+  s.api.inject_state(ENTITY, "volume_level", "0.4");
+  s.api.inject_state(ENTITY, "", "paused");
+  App.run_for(5000);
+  CHECK_EQ(s.image.get_requests(), 1u);
+  // Retried once the 10 s backoff has passed, then after twice as long
+  App.run_for(6000);
+  CHECK_EQ(s.image.get_requests(), 2u);
+  s.image.fail();
+  App.run_for(15000);
+  CHECK_EQ(s.image.get_requests(), 2u);
+  App.run_for(6000);
+  CHECK_EQ(s.image.get_requests(), 3u);
+  CHECK_EQ(s.music.get_album_art_cache().get_failures(), 2u);
+
+  // Downloaded: kept in the cache, no more retries
+  s.image.finish(120, 120, 0xF800);
+  App.run_for(3000);
+  CHECK_EQ(s.image.get_requests(), 3u);
+
+  // Next track, then back: the first art comes from the cache
+  s.picture("/api/media_player_proxy/b");
+  CHECK_EQ(s.image.get_requests(), 4u);
+  s.image.finish(120, 120, 0x07E0);
+  App.run_for(100);
+  uint32_t hits = s.music.get_album_art_cache().get_hits();
+  s.picture("/api/media_player_proxy/a");
+  CHECK_EQ(s.image.get_requests(), 4u);
+  CHECK_EQ(s.music.get_album_art_cache().get_hits(), hits + 1);
+
+  // A third URL evicts the least recently used one (b)
+  s.picture("/api/media_player_proxy/c");
+  s.image.finish(120, 120, 0x001F);
+  App.run_for(100);
+  s.picture("/api/media_player_proxy/b");
+  CHECK_EQ(s.image.get_requests(), 6u);
+  CHECK(s.image.is_pending());
+
+  return host_test::result();
+}
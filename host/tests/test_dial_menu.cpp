@@ -0,0 +1,105 @@
+/**
+ * @file test_dial_menu.cpp
+ * @brief The runner's steps as checks on frames and the actions sent to Home Assistant
+ *
+ *   test_dial_menu [--render-task]
+ *
+ * Inline, the manual clock makes the timing exact and the frame counters are
+ * checked per step. With the render task LVGL runs in its own thread on the
+ * wall clock, so only the outcome (focus, actions) is checked.
+ */
+
+#include "../dial_fixture.h"
+#include "host_test.h"
+#include "esphome/core/hal.h"
+#include <cstring>
+
+using namespace esphome;
+
+static const uint32_t FULL_SCREEN_PX = 240 * 240;
+// CoverApp sends the target once the dial has rested this long
+static const uint32_t REST_DELAY_MS = 600;
+
+int main(int argc, char **argv) {
+  bool render_task = argc > 1 && strcmp(argv[1], "--render-task") == 0;
+  if (!render_task) host::set_manual_clock(true);
+
+  host::HostDial dial(240, 240, render_task);
+  lvgl::HostDisplay &display = dial.display();
+  dial.setup();
+  App.run_for(1000);
+
+  // Boot: the launcher is drawn once, whole
+  const dial_menu::BootTimeline &boot = dial.menu.get_boot_timeline();
+  // The manual clock stands still while LVGL draws
+  if (render_task) CHECK(boot.first_frame_us > 0);
+  CHECK(dial.api.get_subscription_count() > 0);
+  if (!render_task) CHECK_GE(display.get_stats().flushed_px, (uint64_t) FULL_SCREEN_PX);
+  display.reset_stats();
+
+  // The launcher shows no entity state: nothing to redraw
+  dial.answer_subscriptions();
+  App.run_for(200);
+  if (!render_task) CHECK_EQ(display.get_stats().frames, 0u);
+
+  // Each encoder step moves the focus to the next app and redraws only the two buttons
+  for (int i = 0; i < 3; i++) {
+    display.reset_stats();
+    dial.lvgl.rotate_encoder(1);
+    App.run_for(100);
+    CHECK_EQ(dial.menu.get_selected_index(), (i + 1) % 3);
+    if (render_task) continue;
+    CHECK_EQ(display.get_stats().frames, 1u);
+    CHECK(display.get_stats().last_frame_px > 0);
+    CHECK_LE(display.get_stats().last_frame_px, FULL_SCREEN_PX / 4);
+  }
+
+  // Opening an app loads its page
+  display.reset_stats();
+  dial.menu.select_app(1);
+  dial.menu.on_button_click();
+  App.run_for(300);
+  CHECK_EQ(dial.menu.get_selected_app(), (dial_menu::DialApp *) &dial.covers);
+  if (!render_task) CHECK_GE(display.get_stats().flushed_px, (uint64_t) FULL_SCREEN_PX);
+
+  // Dialling the target: feedback on every step, one call once the dial rests
+  dial.covers.next_mode();
+  App.run_for(100);
+  display.reset_stats();
+  dial.api.clear_sent_actions();
+  uint32_t last_step_us = 0;
+  for (int i = 0; i < 4; i++) {
+    last_step_us = micros();
+    dial.menu.on_encoder_rotate(-1);
+    App.run_for(30);
+  }
+  if (!render_task) {
+    CHECK_GE(display.get_stats().frames, 4u);
+    CHECK_LE(display.get_stats().max_frame_px, FULL_SCREEN_PX / 2);
+  }
+  CHECK(dial.api.get_sent_actions().empty());
+  App.run_for(2000);
+
+  const auto &actions = dial.api.get_sent_actions();
+  if (CHECK_EQ(actions.size(), (size_t) 1)) {
+    CHECK_EQ(actions[0].service, std::string("cover.set_cover_position"));
+    CHECK_EQ(actions[0].get("entity_id"), std::string("cover.living_room"));
+    CHECK_EQ(actions[0].get("position"), std::string("80"));
+    uint32_t after_ms = (actions[0].time_us - last_step_us) / 1000;
+    CHECK_GE(after_ms, REST_DELAY_MS);
+    if (!render_task) CHECK_LE(after_ms, REST_DELAY_MS + 50);
+  }
+
+  // Back to the launcher, then the idle screen: each a full redraw, nothing sent
+  display.reset_stats();
+  dial.api.clear_sent_actions();
+  dial.menu.on_long_press();
+  App.run_for(300);
+  if (!render_task) CHECK_GE(display.get_stats().flushed_px, (uint64_t) FULL_SCREEN_PX);
+  dial.menu.show_idle_screen();
+  App.run_for(300);
+  if (!render_task) CHECK(display.get_stats().frames > 0);
+  CHECK(dial.api.get_sent_actions().empty());
+
+  return host_test::result();
+}
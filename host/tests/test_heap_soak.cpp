@@ -0,0 +1,163 @@
+/**
+ * @file test_heap_soak.cpp
+ * @brief 100k media player updates on a flat heap
+ *
+ * operator new and delete are counted here. Once every title has been seen,
+ * the mirror's updates (state, volume, titles longer than their buffers)
+ * must not allocate at all, and with the media player app open the bytes
+ * in use must end where they started.
+ */
+
+#include "host_test.h"
+#include "esphome/core/application.h"
+#include "esphome/components/api/api_server.h"
+#include "esphome/components/lvgl/lvgl_esphome.h"
+#include "esphome/components/homeassistant_addon/homeassistant_media_player.h"
+#include "esphome/components/dial_menu/dial_menu_controller.h"
+#include "esphome/components/dial_menu/media_player_app.h"
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+#include <string>
+#include <vector>
+
+static size_t heap_in_use = 0;
+static size_t heap_peak = 0;
+static uint64_t heap_allocations = 0;
+
+void *operator new(size_t size) {
+  void *ptr = malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) throw std::bad_alloc();
+  heap_in_use += malloc_usable_size(ptr);
+  if (heap_in_use > heap_peak) heap_peak = heap_in_use;
+  heap_allocations++;
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+// GCC can't tell that operator new above comes from malloc()
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr) return;
+  heap_in_use -= malloc_usable_size(ptr);
+  free(ptr);
+}
+#pragma GCC diagnostic pop
+void operator delete[](void *ptr) noexcept { operator delete(ptr); }
+void operator delete(void *ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { operator delete(ptr); }
+
+using namespace esphome;
+
+static const char *const ENTITY = "media_player.kitchen";
+// Built once: inject_state() takes std::string, this one would allocate on every call
+static const std::string ENTITY_ID(ENTITY);
+static const uint32_t UPDATES = 100000;
+
+// Titles and artists of every length, some over the buffers' capacity and multi-byte
+struct Tracks {
+  Tracks() {
+    const char *words[] = {"Blue", "Tränen", "Nocturne", "東京", "Ωmega", "Rain"};
+    for (int i = 0; i < 24; i++) {
+      std::string title, artist;
+      for (int w = 0; w <= i * 2; w++) title += std::string(words[(i + w) % 6]) + " ";
+      for (int w = 0; w <= i; w++) artist += std::string(words[(i * 3 + w) % 6]) + " ";
+      this->titles.push_back(title);
+      this->artists.push_back(artist);
+    }
+  }
+  std::vector<std::string> titles, artists;
+  std::vector<std::string> states{"playing", "paused", "buffering", "playing"};
+  std::vector<std::string> volumes{"0.1", "0.25", "0.5", "0.75"};
+};
+
+struct Setup {
+  Setup() : lvgl(240, 240) {
+    this->player.set_entity_id(ENTITY);
+    this->music.set_name("Music");
+    this->music.set_icon("music");
+    this->music.set_controller(&this->menu);
+    this->music.set_media_player(&this->player);
+    this->music.set_index(0);
+    this->music.set_position(0, -80);
+    this->menu.add_app(&this->music);
+    this->menu.set_lvgl(&this->lvgl);
+    this->menu.set_idle_timeout(0);
+    for (Component *component : std::vector<Component *>{&this->api, &this->player, &this->lvgl, &this->menu}) {
+      App.register_component(component);
+    }
+  }
+
+  // One HA update, the track's fields in turn
+  void update(const Tracks &tracks, uint32_t i) {
+    size_t track = (i / 4) % tracks.titles.size();
+    switch (i % 4) {
+      case 0:
+        this->api.inject_state(ENTITY_ID, "media_title", tracks.titles[track]);
+        break;
+      case 1:
+        this->api.inject_state(ENTITY_ID, "media_artist", tracks.artists[track]);
+        break;
+      case 2:
+        this->api.inject_state(ENTITY_ID, "", tracks.states[track % tracks.states.size()]);
+        break;
+      default:
+        this->api.inject_state(ENTITY_ID, "volume_level", tracks.volumes[track % tracks.volumes.size()]);
+        break;
+    }
+  }
+
+  api::APIServer api;
+  lvgl::LvglComponent lvgl;
+  homeassistant_addon::HomeassistantMediaPlayer player;
+  dial_menu::DialMenuController menu;
+  dial_menu::MediaPlayerApp music;
+};
+
+int main() {
+  host::set_manual_clock(true);
+  Tracks tracks;
+  Setup s;
+  uint32_t notified = 0;
+  s.player.add_on_state_callback([&notified]() { notified++; });
+  App.setup();
+  App.run_for(1000);
+
+  // Every title once, so the API stand-in has room for each value
+  uint32_t cycle = tracks.titles.size() * 4;
+  for (uint32_t i = 0; i < cycle; i++) s.update(tracks, i);
+
+  // The mirror alone: app closed, its consumer not interested
+  uint64_t allocations = heap_allocations;
+  uint32_t before = notified;
+  for (uint32_t i = 0; i < UPDATES; i++) s.update(tracks, i);
+  allocations = heap_allocations - allocations;
+  CHECK_EQ(allocations, (uint64_t) 0);
+  CHECK(notified - before > UPDATES / 2);
+  // The longest titles were cut to the buffer
+  size_t title_size = s.player.get_media_title().size();
+  CHECK_LE(title_size, (size_t) HOMEASSISTANT_ADDON_MEDIA_TITLE_LENGTH);
+  CHECK_GE(title_size, (size_t) HOMEASSISTANT_ADDON_MEDIA_TITLE_LENGTH - 3);
+
+  // With the app open: labels and arc redrawn, the heap back where it was
+  s.menu.select_app(0);
+  s.menu.on_button_click();
+  App.run_for(300);
+  for (uint32_t i = 0; i < cycle; i++) s.update(tracks, i);
+  App.run_for(100);
+  size_t in_use = heap_in_use;
+  heap_peak = in_use;
+  for (uint32_t i = 0; i < UPDATES; i++) {
+    s.update(tracks, i);
+    if (i % 100 == 99) App.run_for(30);
+  }
+  App.run_for(100);
+  // Read before the checks, which allocate their messages
+  size_t after = heap_in_use, peak = heap_peak;
+  printf("Heap: %zu B in use before, %zu B after %u updates, peak %zu B\n", in_use, after, (unsigned) UPDATES, peak);
+  CHECK_EQ(after, in_use);
+  // A label's text is the most that may come and go
+  CHECK_LE(peak - in_use, (size_t) 1024);
+
+  return host_test::result();
+}
@@ -0,0 +1,164 @@
+/**
+ * @file test_latency.cpp
+ * @brief Command latency closed by the update that answers the command
+ *
+ * Each mirror sends a command, Home Assistant first reports something else
+ * (another attribute, a value still on its way), then the value the command
+ * set. Only that last report ends the measurement: the sample is the time
+ * from the command to it, the reports before are counted as unrelated.
+ */
+
+#include "host_test.h"
+#include "esphome/components/api/api_server.h"
+#include "esphome/components/homeassistant_addon/climate/homeassistant_climate.h"
+#include "esphome/components/homeassistant_addon/cover/homeassistant_cover.h"
+#include "esphome/components/homeassistant_addon/homeassistant_light.h"
+#include "esphome/components/homeassistant_addon/homeassistant_media_player.h"
+#include "esphome/components/homeassistant_addon/homeassistant_number.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+
+using namespace esphome;
+using homeassistant_addon::LatencyTracker;
+
+static api::APIServer api_server;
+
+// One sample of `ms`, after `unrelated` reports that were not the answer
+static void check_sample(const LatencyTracker &tracker, uint32_t ms, uint32_t unrelated) {
+  CHECK(!tracker.is_pending());
+  CHECK_EQ(tracker.get_count(), (size_t) 1);
+  CHECK_EQ(tracker.get_max(), ms);
+  CHECK_EQ(tracker.get_unrelated(), unrelated);
+}
+
+// A stop is answered by the cover at rest, not by the position it reports on the way
+static void cover_stop() {
+  homeassistant_addon::HomeassistantCover cover;
+  cover.set_entity_id("cover.kitchen");
+  cover.setup();
+  api_server.inject_state("cover.kitchen", "", "closing");
+  api_server.inject_state("cover.kitchen", "current_position", "80");
+
+  cover.make_call().set_command_stop().perform();
+  App.run_for(100);
+  api_server.inject_state("cover.kitchen", "current_position", "75");
+  App.run_for(150);
+  api_server.inject_state("cover.kitchen", "", "open");
+  check_sample(cover.get_latency_tracker(), 250, 1);
+}
+
+// A move is answered by the cover moving that way, or by the target position itself
+static void cover_position() {
+  homeassistant_addon::HomeassistantCover cover;
+  cover.set_entity_id("cover.office");
+  cover.setup();
+  api_server.inject_state("cover.office", "", "open");
+  api_server.inject_state("cover.office", "current_position", "100");
+
+  cover.make_call().set_position(0.3f).perform();
+  App.run_for(40);
+  api_server.inject_state("cover.office", "current_tilt_position", "50");
+  App.run_for(80);
+  api_server.inject_state("cover.office", "", "closing");
+  check_sample(cover.get_latency_tracker(), 120, 1);
+
+  // An instant cover skips "closing": the position closes it
+  cover.make_call().set_position(0.6f).perform();
+  App.run_for(60);
+  api_server.inject_state("cover.office", "current_position", "60");
+  CHECK_EQ(cover.get_latency_tracker().get_count(), (size_t) 2);
+  CHECK(!cover.get_latency_tracker().is_pending());
+}
+
+// The target temperature is answered by that temperature, not by the mode or another target
+static void climate_target() {
+  homeassistant_addon::HomeassistantClimate climate;
+  climate.set_entity_id("climate.hall");
+  climate.setup();
+  api_server.inject_state("climate.hall", "", "heat");
+  api_server.inject_state("climate.hall", "temperature", "20");
+
+  climate.make_call().set_target_temperature(21.5f).perform();
+  App.run_for(50);
+  api_server.inject_state("climate.hall", "", "cool");
+  api_server.inject_state("climate.hall", "temperature", "21");
+  App.run_for(250);
+  api_server.inject_state("climate.hall", "temperature", "21.5");
+  check_sample(climate.get_latency_tracker(), 300, 2);
+}
+
+// Volume and next track on a media player: other attributes do not count
+static void media_player() {
+  homeassistant_addon::HomeassistantMediaPlayer player;
+  player.set_entity_id("media_player.den");
+  player.setup();
+  api_server.inject_state("media_player.den", "", "paused");
+  api_server.inject_state("media_player.den", "volume_level", "0.2");
+  api_server.inject_state("media_player.den", "media_title", "First");
+
+  player.set_volume(0.45f);
+  App.run_for(30);
+  api_server.inject_state("media_player.den", "", "playing");
+  App.run_for(170);
+  api_server.inject_state("media_player.den", "volume_level", "0.45");
+  // The state change is reported as playback state and as power
+  check_sample(player.get_latency_tracker(), 200, 2);
+
+  // Any new title answers next_track, the same one sent again does not
+  player.next_track();
+  App.run_for(100);
+  api_server.inject_state("media_player.den", "volume_level", "0.5");
+  api_server.inject_state("media_player.den", "media_title", "First");
+  CHECK(player.get_latency_tracker().is_pending());
+  App.run_for(100);
+  api_server.inject_state("media_player.den", "media_title", "Second");
+  CHECK(!player.get_latency_tracker().is_pending());
+  CHECK_EQ(player.get_latency_tracker().get_count(), (size_t) 2);
+  CHECK_EQ(player.get_latency_tracker().get_max(), 200u);
+}
+
+// A brightness is answered by that level, not by the light turning on on the way
+static void light_brightness() {
+  homeassistant_addon::HomeassistantLight light;
+  light.set_entity_id("light.desk");
+  light.setup();
+  api_server.inject_state("light.desk", "", "off");
+
+  light.set_brightness(0.5f);
+  App.run_for(80);
+  api_server.inject_state("light.desk", "", "on");
+  api_server.inject_state("light.desk", "brightness", "255");
+  App.run_for(20);
+  api_server.inject_state("light.desk", "brightness", "128");
+  check_sample(light.get_latency_tracker(), 100, 2);
+}
+
+// A value is answered by that value, not by the range or an earlier value
+static void number_value() {
+  homeassistant_addon::HomeassistantNumber number;
+  number.set_entity_id("input_number.fan_speed");
+  number.setup();
+  api_server.inject_state("input_number.fan_speed", "", "3");
+  api_server.inject_state("input_number.fan_speed", "step", "0.5");
+
+  number.set_value(7.5f);
+  App.run_for(60);
+  api_server.inject_state("input_number.fan_speed", "max", "10");
+  api_server.inject_state("input_number.fan_speed", "", "5");
+  App.run_for(60);
+  api_server.inject_state("input_number.fan_speed", "", "7.5");
+  check_sample(number.get_latency_tracker(), 120, 1);
+}
+
+int main() {
+  host::set_manual_clock(true);
+  App.register_component(&api_server);
+  App.setup();
+  cover_stop();
+  cover_position();
+  climate_target();
+  media_player();
+  light_brightness();
+  number_value();
+  return host_test::result();
+}
@@ -0,0 +1,240 @@
+/**
+ * @file test_list_attribute.cpp
+ * @brief List attributes fuzzed against a model, a thousand sources parsed in one pass
+ *
+ * Lists in each of HA's forms (Python repr, JSON, comma-separated) and random
+ * bytes go through a small ListAttribute: what it keeps must be what a plain
+ * vector keeps, with the same items dropped. operator new is counted here, a
+ * list of 1000 sources must parse without allocating after the first update,
+ * and its time per item must not grow with the length of the list.
+ */
+
+#include "host_test.h"
+#include "esphome/components/api/api_server.h"
+#include "esphome/components/homeassistant_addon/homeassistant_media_player.h"
+#include "esphome/core/application.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+static uint64_t heap_allocations = 0;
+
+void *operator new(size_t size) {
+  void *ptr = malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) throw std::bad_alloc();
+  heap_allocations++;
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+// GCC can't tell that operator new above comes from malloc()
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void *ptr) noexcept { free(ptr); }
+#pragma GCC diagnostic pop
+void operator delete[](void *ptr) noexcept { operator delete(ptr); }
+void operator delete(void *ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { operator delete(ptr); }
+
+using namespace esphome;
+using homeassistant_addon::ListAttribute;
+
+static api::APIServer api_server;
+
+// What a ListAttribute of this capacity keeps of the items: first of each, while they fit
+struct Model {
+  Model(size_t max_items, size_t max_bytes) : max_items(max_items), max_bytes(max_bytes) {}
+  void add(const std::string &item) {
+    if (item.empty() || std::find(this->items.begin(), this->items.end(), item) != this->items.end()) return;
+    if (this->items.size() >= this->max_items || this->used + item.size() > this->max_bytes) {
+      this->dropped++;
+      return;
+    }
+    this->items.push_back(item);
+    this->used += item.size();
+  }
+  size_t max_items, max_bytes;
+  std::vector<std::string> items;
+  size_t used{0};
+  size_t dropped{0};
+};
+
+// The list holds exactly the model's items, each found at its own index
+static bool check_list(const ListAttribute &list, const Model &model) {
+  bool ok = CHECK_EQ(list.size(), model.items.size());
+  ok &= CHECK_EQ(list.get_used_bytes(), model.used);
+  ok &= CHECK_EQ(list.get_dropped(), model.dropped);
+  for (size_t i = 0; ok && i < model.items.size(); i++) {
+    ok &= CHECK_EQ(list.get(i).str(), model.items[i]);
+    ok &= CHECK_EQ(list.index_of(StringRef(model.items[i])), (int) i);
+  }
+  CHECK_EQ(list.index_of(StringRef("not in the list")), -1);
+  CHECK(list.get(list.size()).empty());
+  return ok;
+}
+
+// An item with quotes, backslashes, separators and UTF-8, often one already drawn
+static std::string random_item(std::mt19937 &rng, const std::vector<std::string> &drawn) {
+  if (!drawn.empty() && rng() % 4 == 0) return drawn[rng() % drawn.size()];
+  static const char *const PIECES[] = {"a", "Zone", " ", ",", "[", "]", "'", "\"", "\\", "é", "東", "-", "1"};
+  std::string item;
+  size_t length = rng() % 12;
+  for (size_t i = 0; i < length; i++) item += PIECES[rng() % 13];
+  return item;
+}
+
+// item as HA writes it in the list's form, and the slice the parser returns for it
+static std::string quote(const std::string &item, char form, std::string *slice) {
+  if (form == ',') {
+    // Plain text can't hold separators or quotes: keep the letters, the slice is the trimmed text
+    std::string bare;
+    for (char c : item) {
+      if (c != ',' && c != ']' && c != '[' && c != '\'' && c != '"' && c != ' ') bare += c;
+    }
+    *slice = bare;
+    return bare;
+  }
+  // Python's repr uses double quotes when the item holds a single one, JSON always does
+  char q = form == 'j' || item.find('\'') != std::string::npos ? '"' : '\'';
+  std::string escaped;
+  for (char c : item) {
+    if (c == '\\' || c == q) escaped += '\\';
+    escaped += c;
+  }
+  // Escapes are left as they are
+  *slice = escaped;
+  return q + escaped + q;
+}
+
+// Well-formed lists, random items in each form, against the model
+static void fuzz_forms() {
+  std::mt19937 rng(31);
+  ListAttribute list(12, 96);
+  for (int round = 0; round < 3000; round++) {
+    char form = "pj,"[round % 3];
+    std::vector<std::string> drawn;
+    std::string text = form == ',' ? "" : "[";
+    Model model(12, 96);
+    size_t count = rng() % 24;
+    for (size_t i = 0; i < count; i++) {
+      drawn.push_back(random_item(rng, drawn));
+      std::string slice;
+      std::string written = quote(drawn.back(), form, &slice);
+      if (i > 0) text += form == 'j' ? "," : ", ";
+      text += written;
+      model.add(slice);
+    }
+    if (form != ',') text += "]";
+    list.update(StringRef(text));
+    if (!check_list(list, model)) {
+      printf("  list: %s\n", text.c_str());
+      return;
+    }
+  }
+}
+
+// Random bytes, unbalanced quotes and trailing escapes: kept as the parser splits them
+static void fuzz_malformed() {
+  std::mt19937 rng(1000);
+  static const char BYTES[] = "[]'\",\\ \n\tab\xc3\xa9";
+  ListAttribute list(8, 40);
+  for (int round = 0; round < 20000; round++) {
+    std::string text;
+    size_t length = rng() % 64;
+    for (size_t i = 0; i < length; i++) text += BYTES[rng() % (sizeof(BYTES) - 1)];
+    Model model(8, 40);
+    homeassistant_addon::for_each_list_item(StringRef(text), [&model](StringRef item) { model.add(item.str()); });
+    list.update(StringRef(text));
+    if (!check_list(list, model)) {
+      printf("  text: %s\n", text.c_str());
+      return;
+    }
+    CHECK_LE(list.get_used_bytes(), list.get_max_bytes());
+  }
+}
+
+// "['Source 0000', 'Source 0001', ...]", `first` numbering the first source
+static std::string sources(size_t count, size_t first) {
+  std::string text = "[";
+  char item[24];
+  for (size_t i = 0; i < count; i++) {
+    snprintf(item, sizeof(item), "%s'Source %04u'", i > 0 ? ", " : "", (unsigned) (first + i));
+    text += item;
+  }
+  return text + "]";
+}
+
+// Best time of a list update, in nanoseconds per source; counts the updates' allocations
+static double parse_ns_per_item(ListAttribute &list, size_t count, uint64_t *allocations) {
+  std::string texts[2] = {sources(count, 0), sources(count, 1)};
+  double best = 1e9;
+  for (int run = 0; run < 50; run++) {
+    uint64_t before = heap_allocations;
+    auto start = std::chrono::steady_clock::now();
+    list.update(StringRef(texts[run % 2]));
+    auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    *allocations += heap_allocations - before;
+    best = std::min(best, ns / count);
+  }
+  return best;
+}
+
+// 1000 sources: kept whole, no allocation past the first update, linear time
+static void throughput() {
+  ListAttribute list(1000, 16000);
+  std::string text = sources(1000, 0);
+  list.update(StringRef(text));
+  CHECK_EQ(list.size(), (size_t) 1000);
+  CHECK_EQ(list.index_of(StringRef("Source 0999")), 999);
+
+  uint64_t allocations = 0;
+  double small = parse_ns_per_item(list, 100, &allocations);
+  double large = parse_ns_per_item(list, 1000, &allocations);
+  CHECK_EQ(allocations, (uint64_t) 0);
+  printf("source_list: %.0f ns per source at 100, %.0f ns at 1000\n", small, large);
+  // A scan per item for duplicates would make this ~10x
+  CHECK_LE(large, small * 3);
+  CHECK_LE(large * 1000, 5e6);
+
+  // Twice the same sources: stored once
+  text = sources(1000, 0);
+  text.back() = ',';
+  text += sources(1000, 0).substr(1);
+  list.update(StringRef(text));
+  CHECK_EQ(list.size(), (size_t) 1000);
+  CHECK_EQ(list.get_dropped(), (size_t) 0);
+}
+
+// The player's capacity comes from the YAML: by default 32 sources, the rest counted as dropped
+static void media_player() {
+  std::string text = sources(1000, 0);
+  homeassistant_addon::HomeassistantMediaPlayer small;
+  small.set_entity_id("media_player.small");
+  small.setup();
+  api_server.inject_state("media_player.small", "source_list", text);
+  CHECK_EQ(small.get_source_list().size(), (size_t) 32);
+  CHECK_EQ(small.get_source_list().get_dropped(), (size_t) 968);
+
+  homeassistant_addon::HomeassistantMediaPlayer large;
+  large.set_entity_id("media_player.large");
+  large.set_source_list_capacity(1000, 16000);
+  large.setup();
+  api_server.inject_state("media_player.large", "source_list", text);
+  CHECK_EQ(large.get_source_list().size(), (size_t) 1000);
+  CHECK_EQ(large.get_source_list().get_dropped(), (size_t) 0);
+  CHECK_EQ(large.get_source_list().index_of(StringRef("Source 0500")), 500);
+}
+
+int main() {
+  App.register_component(&api_server);
+  App.setup();
+  fuzz_forms();
+  fuzz_malformed();
+  throughput();
+  media_player();
+  return host_test::result();
+}
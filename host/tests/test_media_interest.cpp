@@ -0,0 +1,91 @@
+/**
+ * @file test_media_interest.cpp
+ * @brief Media player metadata deferred while hidden, listeners always notified
+ *
+ * A consumer's interest gates what it hears about; a callback added without
+ * a consumer keeps the mirror fully visible. Metadata arriving while nobody
+ * looks is not kept, it is read again from Home Assistant once a consumer
+ * becomes visible.
+ */
+
+#include "host_test.h"
+#include "esphome/components/api/api_server.h"
+#include "esphome/components/homeassistant_addon/homeassistant_media_player.h"
+#include "esphome/core/application.h"
+
+using namespace esphome;
+using homeassistant_addon::Interest;
+
+static const char *const ENTITY = "media_player.kitchen";
+
+struct Setup {
+  Setup() {
+    this->player.set_entity_id(ENTITY);
+    this->app = this->player.register_consumer(Interest::NONE, [this]() { this->app_calls++; });
+    App.register_component(&this->api);
+    App.register_component(&this->player);
+    App.setup();
+    this->api.inject_state(ENTITY, "", "playing");
+    this->api.inject_state(ENTITY, "media_title", "First");
+    App.loop();
+  }
+
+  api::APIServer api;
+  homeassistant_addon::HomeassistantMediaPlayer player;
+  size_t app{0};
+  uint32_t app_calls{0};
+};
+
+// Only a hidden consumer: metadata is dropped, then read again when it shows
+static void hidden_consumer(Setup &s) {
+  CHECK(s.player.get_media_title().empty());
+  CHECK(s.player.get_state() == homeassistant_addon::MediaPlayerState::PLAYING);
+  s.api.inject_state(ENTITY, "media_title", "Second");
+  CHECK(s.player.get_media_title().empty());
+  CHECK_EQ(s.app_calls, 0u);
+
+  s.player.set_interest(s.app, Interest::BACKGROUND);
+  // The playback state it missed, not the metadata
+  CHECK_EQ(s.app_calls, 1u);
+  CHECK_EQ(s.api.get_state_requests(), 0u);
+
+  s.player.set_interest(s.app, Interest::VISIBLE);
+  CHECK_EQ(s.api.get_state_requests(), 1u);
+  App.loop();
+  CHECK(s.player.get_media_title().ref() == StringRef("Second"));
+  CHECK_EQ(s.app_calls, 2u);
+
+  // Visible: parsed on arrival, nothing more to read again
+  s.api.inject_state(ENTITY, "media_title", "Third");
+  CHECK(s.player.get_media_title().ref() == StringRef("Third"));
+  CHECK_EQ(s.app_calls, 3u);
+  s.player.set_interest(s.app, Interest::NONE);
+  s.player.set_interest(s.app, Interest::VISIBLE);
+  CHECK_EQ(s.api.get_state_requests(), 1u);
+  s.player.set_interest(s.app, Interest::NONE);
+}
+
+// A plain state callback (a YAML lambda) keeps everything visible for itself
+static void listener(Setup &s) {
+  uint32_t listener_calls = 0;
+  s.player.add_on_state_callback([&listener_calls]() { listener_calls++; });
+  uint32_t app_calls = s.app_calls;
+  s.api.inject_state(ENTITY, "media_title", "Fourth");
+  CHECK(s.player.get_media_title().ref() == StringRef("Fourth"));
+  CHECK_EQ(listener_calls, 1u);
+  CHECK_EQ(s.app_calls, app_calls);
+  s.api.inject_state(ENTITY, "", "paused");
+  CHECK_EQ(listener_calls, 2u);
+
+  // The hidden app catches up when it shows, without asking HA again
+  s.player.set_interest(s.app, Interest::VISIBLE);
+  CHECK_EQ(s.app_calls, app_calls + 1);
+  CHECK_EQ(s.api.get_state_requests(), 1u);
+}
+
+int main() {
+  Setup s;
+  hidden_consumer(s);
+  listener(s);
+  return host_test::result();
+}
@@ -0,0 +1,62 @@
+/**
+ * @file test_memory_policy.cpp
+ * @brief Pool fallback, and containers never handed a null pointer
+ *
+ * The host arenas stand in for the ESP32's pools: a full preferred pool
+ * falls back to the other one, and with both full a ColdVector aborts
+ * (checked in a forked child) instead of writing through nullptr.
+ */
+
+#include "host_test.h"
+#include "esphome/components/dial_menu/memory_policy.h"
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace esphome::dial_menu;
+
+static const size_t INTERNAL_CAPACITY = 320 * 1024;
+static const size_t EXTERNAL_CAPACITY = 8 * 1024 * 1024;
+
+// Without PSRAM cold data goes to internal SRAM, counted as a fallback
+static void fallback() {
+  MemoryPolicy::set_arena_capacity(MemoryPool::EXTERNAL, 0);
+  uint32_t fallbacks = MemoryPolicy::get_counters(MemoryPool::INTERNAL).fallbacks;
+  {
+    ColdVector<uint32_t> table(1000, 7);
+    CHECK_EQ(table[999], 7u);
+    CHECK_GE(MemoryPolicy::get_counters(MemoryPool::INTERNAL).in_use, 1000 * sizeof(uint32_t));
+  }
+  CHECK_EQ(MemoryPolicy::get_counters(MemoryPool::INTERNAL).fallbacks, fallbacks + 1);
+  CHECK_EQ(MemoryPolicy::get_counters(MemoryPool::INTERNAL).in_use, (size_t) 0);
+  MemoryPolicy::set_arena_capacity(MemoryPool::EXTERNAL, EXTERNAL_CAPACITY);
+}
+
+// MemoryPolicy::allocate() reports a full heap, a container stops instead
+static void out_of_memory() {
+  MemoryPolicy::set_arena_capacity(MemoryPool::INTERNAL, 1024);
+  MemoryPolicy::set_arena_capacity(MemoryPool::EXTERNAL, 1024);
+  CHECK(MemoryPolicy::allocate(Placement::COLD, 4096) == nullptr);
+  CHECK(MemoryPolicy::get_counters(MemoryPool::EXTERNAL).failures > 0);
+
+  fflush(stdout);
+  pid_t child = fork();
+  if (child == 0) {
+    ColdVector<uint32_t> table;
+    table.resize(1024);
+    table[1023] = 1;
+    _exit(0);
+  }
+  int status = 0;
+  CHECK(child > 0 && waitpid(child, &status, 0) == child);
+  CHECK(WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT);
+
+  MemoryPolicy::set_arena_capacity(MemoryPool::INTERNAL, INTERNAL_CAPACITY);
+  MemoryPolicy::set_arena_capacity(MemoryPool::EXTERNAL, EXTERNAL_CAPACITY);
+}
+
+int main() {
+  fallback();
+  out_of_memory();
+  return host_test::result();
+}
@@ -0,0 +1,110 @@
+/**
+ * @file test_multi_dial.cpp
+ * @brief Two dial_menu blocks on two lvgl displays
+ *
+ * Each controller is bound to its lvgl component (set_lvgl(), lvgl_id in
+ * YAML): its pages, refresh period, encoder group and object counts must
+ * stay on its own display whatever LVGL's default display is.
+ */
+
+#include "../dial_fixture.h"
+#include "host_test.h"
+
+using namespace esphome;
+
+// A dial with a switch app and a cover app, on its own display
+struct Dial {
+  Dial(uint16_t size, const char *cover_entity, uint32_t refresh_ms) : lvgl(size, size) {
+    this->lamp.set_name("Lamp");
+    this->blinds.set_name("Blinds");
+    this->blinds.set_entity_id(cover_entity);
+    this->switches.set_name("Switches");
+    this->switches.set_icon("light");
+    this->switches.add_switch(&this->lamp, "Lamp", 0xFFC107);
+    this->covers.set_name("Blinds");
+    this->covers.set_icon("blinds");
+    this->covers.set_controller(&this->menu);
+    this->covers.add_homeassistant_cover(&this->blinds, "Blinds", 0x4CAF50);
+    this->switches.set_index(0);
+    this->switches.set_position(0, -size / 3);
+    this->covers.set_index(1);
+    this->covers.set_position(0, size / 3);
+    this->menu.add_app(&this->switches);
+    this->menu.add_app(&this->covers);
+    this->menu.set_diameter(size);
+    this->menu.set_refresh_period(refresh_ms);
+    this->menu.set_lvgl(&this->lvgl);
+    this->menu.set_snapshot_key(cover_entity);
+  }
+
+  lv_disp_t *disp() { return this->lvgl.get_disp(); }
+  lv_obj_t *screen() { return lv_disp_get_scr_act(this->disp()); }
+  lvgl::HostDisplay &display() { return this->lvgl.get_display(); }
+
+  lvgl::LvglComponent lvgl;
+  host::HostSwitch lamp;
+  homeassistant_addon::HomeassistantCover blinds;
+  dial_menu::DialMenuController menu;
+  dial_menu::SwitchApp switches;
+  dial_menu::CoverApp covers;
+};
+
+int main() {
+  host::set_manual_clock(true);
+  api::APIServer api;
+  time::RealTimeClock clock;
+  Dial a(240, "cover.kitchen", 30);
+  Dial b(360, "cover.bedroom", 50);
+  b.menu.set_time(&clock);
+
+  // The generated order: entities, both lvgl blocks, then both menus
+  for (Component *component :
+       std::vector<Component *>{&api, &a.blinds, &b.blinds, &clock, &a.lvgl, &b.lvgl, &a.menu, &b.menu}) {
+    App.register_component(component);
+  }
+  App.setup();
+  App.run_for(1000);
+
+  // The first display registered stays LVGL's default: b was still built on its own
+  CHECK(lv_disp_get_default() == a.disp());
+  CHECK(a.screen() != b.screen());
+  CHECK(lv_obj_get_child_cnt(a.screen()) > 0);
+  CHECK(lv_obj_get_child_cnt(b.screen()) > 0);
+  CHECK_EQ(dial_menu::RenderPacer::find_refresh_timer(a.disp())->period, 30u);
+  CHECK_EQ(dial_menu::RenderPacer::find_refresh_timer(b.disp())->period, 50u);
+  CHECK_GE(a.display().get_stats().flushed_px, (uint64_t) 240 * 240);
+  CHECK_GE(b.display().get_stats().flushed_px, (uint64_t) 360 * 360);
+
+  // App pages are counted on their own display
+  CHECK(a.covers.get_memory_stats().ui_objects > 0);
+  CHECK(b.covers.get_memory_stats().ui_objects > 0);
+  CHECK_EQ(a.covers.get_memory_stats().ui_objects, b.covers.get_memory_stats().ui_objects);
+
+  // Each encoder moves its own dial's focus
+  a.lvgl.rotate_encoder(1);
+  App.run_for(100);
+  CHECK_EQ(a.menu.get_selected_index(), 1);
+  CHECK_EQ(b.menu.get_selected_index(), 0);
+
+  // Opening an app on a loads a page of a's display, b is left alone
+  lv_obj_t *b_launcher = b.screen();
+  a.display().reset_stats();
+  b.display().reset_stats();
+  a.menu.on_button_click();
+  App.run_for(300);
+  CHECK(a.menu.get_selected_app() == &a.covers);
+  CHECK(lv_obj_get_disp(a.screen()) == a.disp());
+  CHECK(b.screen() == b_launcher);
+  CHECK(a.display().get_stats().frames > 0);
+  CHECK_EQ(b.display().get_stats().frames, 0u);
+
+  // b's idle screen goes to b's display
+  lv_obj_t *a_page = a.screen();
+  b.menu.show_idle_screen();
+  App.run_for(300);
+  CHECK(b.screen() != b_launcher);
+  CHECK(lv_obj_get_disp(b.screen()) == b.disp());
+  CHECK(a.screen() == a_page);
+
+  return host_test::result();
+}
@@ -0,0 +1,232 @@
+/**
+ * @file test_packed.cpp
+ * @brief Packed mode against one subscription per attribute
+ *
+ * The same changes reach a media player and a climate mirror once as one
+ * packed payload and once attribute by attribute: packed, each change is one
+ * message, one callback and one publish. Payloads with missing, empty, extra
+ * and "None" fields keep what they can't carry, and metadata packed while
+ * nobody looks is read again, as one payload, once a consumer shows.
+ */
+
+#include "host_test.h"
+#include "esphome/components/api/api_server.h"
+#include "esphome/components/homeassistant_addon/climate/homeassistant_climate.h"
+#include "esphome/components/homeassistant_addon/homeassistant_media_player.h"
+#include "esphome/components/homeassistant_addon/packed_payload.h"
+#include "esphome/core/application.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+using namespace esphome;
+using homeassistant_addon::Interest;
+using homeassistant_addon::MediaPlayerState;
+
+static api::APIServer api_server;
+static const uint32_t ROUNDS = 2000;
+
+static std::string number(float value) {
+  char text[16];
+  snprintf(text, sizeof(text), "%.2f", value);
+  return text;
+}
+
+// Each mirror has its own entities: the API stand-in keeps the subscriptions of the ones gone
+
+// A media player mirror counting its callbacks, packed from `packed` or not (nullptr)
+struct Player {
+  Player(const char *entity_id, const char *packed) {
+    this->player.set_entity_id(entity_id);
+    if (packed != nullptr) this->player.set_packed_source(packed, "packed");
+    this->player.add_on_state_callback([this]() { this->callbacks++; });
+    this->player.setup();
+  }
+  homeassistant_addon::HomeassistantMediaPlayer player;
+  uint32_t callbacks{0};
+};
+
+// A climate mirror counting its publishes, packed from `packed` or not (nullptr)
+struct Thermostat {
+  Thermostat(const char *entity_id, const char *packed) {
+    this->climate.set_entity_id(entity_id);
+    if (packed != nullptr) this->climate.set_packed_source(packed, "packed");
+    this->climate.add_on_state_callback([this](climate::Climate &) { this->publishes++; });
+    this->climate.setup();
+  }
+  homeassistant_addon::HomeassistantClimate climate;
+  uint32_t publishes{0};
+};
+
+static void split() {
+  StringRef fields[4];
+  CHECK_EQ(homeassistant_addon::split_packed_payload(StringRef("a|b"), fields), (size_t) 2);
+  CHECK(fields[1] == "b");
+  CHECK(fields[2].empty() && fields[3].empty());
+  CHECK_EQ(homeassistant_addon::split_packed_payload(StringRef(""), fields), (size_t) 1);
+  CHECK(fields[0].empty());
+  CHECK_EQ(homeassistant_addon::split_packed_payload(StringRef("a||c|d|e|f"), fields), (size_t) 4);
+  CHECK(fields[1].empty());
+  CHECK(fields[3] == "d");
+}
+
+// Volume, title and artist change every round: messages, callbacks and decode time per round
+static void media_player() {
+  Player split("media_player.split", nullptr), packed("media_player.packed", "sensor.packed_player");
+  size_t split_messages = 0, packed_messages = 0;
+  double split_ns = 0, packed_ns = 0;
+  for (uint32_t i = 0; i < ROUNDS; i++) {
+    std::string volume = number((i % 100) / 100.0f), title = "Title " + std::to_string(i);
+    std::string artist = "Artist " + std::to_string(i % 7);
+    auto start = std::chrono::steady_clock::now();
+    split_messages += api_server.inject_state("media_player.split", "", "playing");
+    split_messages += api_server.inject_state("media_player.split", "volume_level", volume);
+    split_messages += api_server.inject_state("media_player.split", "is_volume_muted", "False");
+    split_messages += api_server.inject_state("media_player.split", "media_title", title);
+    split_messages += api_server.inject_state("media_player.split", "media_artist", artist);
+    split_messages += api_server.inject_state("media_player.split", "source", "Radio");
+    split_messages += api_server.inject_state("media_player.split", "entity_picture", "/api/art");
+    split_messages += api_server.inject_state("media_player.split", "source_list", "['Radio', 'TV']");
+    auto middle = std::chrono::steady_clock::now();
+    packed_messages += api_server.inject_state("sensor.packed_player", "packed",
+                                               "playing|" + volume + "|False|" + title + "|" + artist +
+                                                   "|Radio|/api/art|['Radio', 'TV']");
+    auto end = std::chrono::steady_clock::now();
+    split_ns += std::chrono::duration<double, std::nano>(middle - start).count();
+    packed_ns += std::chrono::duration<double, std::nano>(end - middle).count();
+  }
+  printf("media_player: %zu messages, %u callbacks, %.0f ns per change; packed: %zu, %u, %.0f ns\n",
+         split_messages, split.callbacks, split_ns / ROUNDS, packed_messages, packed.callbacks, packed_ns / ROUNDS);
+  CHECK_EQ(split_messages, (size_t) ROUNDS * 8);
+  CHECK_EQ(packed_messages, (size_t) ROUNDS);
+  CHECK_EQ(packed.callbacks, ROUNDS);
+  // Every round changes at least the title
+  CHECK_GE(split.callbacks, ROUNDS * 2);
+  CHECK(packed.player.get_media_title().ref() == split.player.get_media_title().ref());
+  CHECK_EQ(packed.player.get_volume(), split.player.get_volume());
+  CHECK_EQ(packed.player.get_source_list().size(), (size_t) 2);
+  CHECK_LE(packed_ns / ROUNDS, 1e6);
+}
+
+// The current temperature changes every round
+static void climate_mirror() {
+  Thermostat split("climate.split", nullptr), packed("climate.packed", "sensor.packed_climate");
+  size_t split_messages = 0, packed_messages = 0;
+  double split_ns = 0, packed_ns = 0;
+  uint32_t split_traits = 0, packed_traits = 0;
+  for (uint32_t i = 0; i < ROUNDS; i++) {
+    if (i == 1) {
+      split_traits = split.climate.get_traits_generation();
+      packed_traits = packed.climate.get_traits_generation();
+    }
+    std::string current = number(18.0f + (i % 50) / 10.0f);
+    auto start = std::chrono::steady_clock::now();
+    split_messages += api_server.inject_state("climate.split", "", "heat");
+    split_messages += api_server.inject_state("climate.split", "current_temperature", current);
+    split_messages += api_server.inject_state("climate.split", "temperature", "21.5");
+    split_messages += api_server.inject_state("climate.split", "hvac_action", "heating");
+    split_messages += api_server.inject_state("climate.split", "min_temp", "7");
+    split_messages += api_server.inject_state("climate.split", "max_temp", "35");
+    split_messages += api_server.inject_state("climate.split", "target_temp_step", "0.5");
+    split_messages += api_server.inject_state("climate.split", "hvac_modes", "['off', 'heat']");
+    auto middle = std::chrono::steady_clock::now();
+    packed_messages +=
+        api_server.inject_state("sensor.packed_climate", "packed", "heat|" + current + "|21.5|heating|7|35|0.5|off,heat");
+    auto end = std::chrono::steady_clock::now();
+    split_ns += std::chrono::duration<double, std::nano>(middle - start).count();
+    packed_ns += std::chrono::duration<double, std::nano>(end - middle).count();
+  }
+  printf("climate: %zu messages, %u publishes, %.0f ns per change; packed: %zu, %u, %.0f ns\n", split_messages,
+         split.publishes, split_ns / ROUNDS, packed_messages, packed.publishes, packed_ns / ROUNDS);
+  CHECK_EQ(split_messages, (size_t) ROUNDS * 8);
+  // One publish per attribute that changes the climate, the traits only when they change
+  CHECK_GE(split.publishes, ROUNDS * 4);
+  CHECK_EQ(packed_messages, (size_t) ROUNDS);
+  CHECK_EQ(packed.publishes, ROUNDS);
+  CHECK_EQ(packed.climate.current_temperature, split.climate.current_temperature);
+  CHECK(packed.climate.get_traits().supports_mode(climate::CLIMATE_MODE_HEAT));
+  // The limits and modes are the same every round: the traits were built once
+  CHECK_EQ(split.climate.get_traits_generation(), split_traits);
+  CHECK_EQ(packed.climate.get_traits_generation(), packed_traits);
+  CHECK_LE(packed_ns / ROUNDS, 1e6);
+}
+
+// Too few fields: dropped whole. Extra fields: ignored. "None": what it can't carry is kept
+static void malformed() {
+  Player media("media_player.malformed", "sensor.malformed_player");
+  api_server.inject_state("sensor.malformed_player", "packed", "playing|0.40|False|Song|Band|Radio|/art|['Radio']");
+  uint32_t callbacks = media.callbacks;
+  api_server.inject_state("sensor.malformed_player", "packed", "paused|0.5");
+  api_server.inject_state("sensor.malformed_player", "packed", "");
+  CHECK_EQ(media.callbacks, callbacks);
+  CHECK(media.player.get_state() == MediaPlayerState::PLAYING);
+
+  api_server.inject_state("sensor.malformed_player", "packed", "paused|0.50|True|Song|Band|Radio|/art|['Radio']|x|y");
+  CHECK(media.player.get_state() == MediaPlayerState::PAUSED);
+  CHECK_EQ(media.player.get_volume(), 0.5f);
+  CHECK(media.player.is_muted());
+
+  // Nothing playing: HA's template renders the missing attributes as None
+  api_server.inject_state("sensor.malformed_player", "packed", "idle|None|False|None|None|None|None|None");
+  CHECK(media.player.get_state() == MediaPlayerState::IDLE);
+  CHECK_EQ(media.player.get_volume(), 0.5f);
+  CHECK(media.player.get_media_title().empty());
+  CHECK_EQ(media.player.get_source_list().size(), (size_t) 1);
+  // Short: the trailing fields are left as they are
+  api_server.inject_state("sensor.malformed_player", "packed", "playing|0.60|False");
+  CHECK(media.player.get_state() == MediaPlayerState::PLAYING);
+  CHECK_EQ(media.player.get_volume(), 0.6f);
+
+  Thermostat thermostat("climate.malformed", "sensor.malformed_climate");
+  api_server.inject_state("sensor.malformed_climate", "packed", "heat|19.5|21|heating|7|35|0.5|off,heat");
+  uint32_t publishes = thermostat.publishes;
+  api_server.inject_state("sensor.malformed_climate", "packed", "cool|20");
+  api_server.inject_state("sensor.malformed_climate", "packed", "");
+  CHECK_EQ(thermostat.publishes, publishes);
+  CHECK(thermostat.climate.mode == climate::CLIMATE_MODE_HEAT);
+
+  api_server.inject_state("sensor.malformed_climate", "packed", "heat|None|22|None|None|None|None|None|extra");
+  CHECK_EQ(thermostat.publishes, publishes + 1);
+  CHECK_EQ(thermostat.climate.current_temperature, 19.5f);
+  CHECK_EQ(thermostat.climate.target_temperature, 22.0f);
+  CHECK_EQ(thermostat.climate.get_traits().get_visual_max_temperature(), 35.0f);
+  CHECK(thermostat.climate.get_traits().supports_mode(climate::CLIMATE_MODE_HEAT));
+}
+
+// A consumer in the background: the metadata is left dirty, one packed re-read when it shows
+static void hidden_metadata() {
+  homeassistant_addon::HomeassistantMediaPlayer player;
+  player.set_entity_id("media_player.hidden");
+  player.set_packed_source("sensor.packed_hidden", "packed");
+  uint32_t calls = 0;
+  size_t app = player.register_consumer(Interest::BACKGROUND, [&calls]() { calls++; });
+  player.setup();
+
+  api_server.inject_state("sensor.packed_hidden", "packed", "playing|0.30|False|Hidden song|Band|Radio|/art|");
+  CHECK_EQ(calls, 1u);
+  CHECK(player.get_state() == MediaPlayerState::PLAYING);
+  CHECK(player.get_media_title().empty());
+
+  // A title change alone does not wake a background consumer
+  api_server.inject_state("sensor.packed_hidden", "packed", "playing|0.30|False|Next song|Band|Radio|/art|");
+  CHECK_EQ(calls, 1u);
+
+  uint32_t requests = api_server.get_state_requests();
+  player.set_interest(app, Interest::VISIBLE);
+  CHECK_EQ(api_server.get_state_requests(), requests + 1);
+  App.loop();
+  CHECK(player.get_media_title().ref() == StringRef("Next song"));
+  CHECK(player.get_media_artist().ref() == StringRef("Band"));
+  CHECK_EQ(calls, 2u);
+}
+
+int main() {
+  App.register_component(&api_server);
+  App.setup();
+  split();
+  media_player();
+  climate_mirror();
+  malformed();
+  hidden_metadata();
+  return host_test::result();
+}
@@ -0,0 +1,89 @@
+/**
+ * @file test_render_pacer.cpp
+ * @brief Page transitions are drawn in slices, the loop keeps running in between
+ *
+ * On the manual clock, the panel's transfer time making the render time:
+ * each flush advances the clock by 10 ns per pixel, so the pacer measures
+ * the same rate on every run. The API server reads its socket once per loop
+ * pass, so the longest pass is how long a message can wait on top of the
+ * loop's own sleep, and with a budget it must stay within it.
+ */
+
+#include "../dial_fixture.h"
+#include "host_test.h"
+#include "esphome/core/hal.h"
+
+using namespace esphome;
+
+// App.run_for(), keeping the longest App.loop() pass
+static uint32_t run_for(uint32_t ms) {
+  uint32_t longest_us = 0;
+  uint32_t start = millis();
+  while (millis() - start < ms) {
+    uint32_t pass_us = micros();
+    App.loop();
+    pass_us = micros() - pass_us;
+    if (pass_us > longest_us) longest_us = pass_us;
+    delay(1);
+  }
+  return longest_us;
+}
+
+static const uint32_t FLUSH_NS_PER_PX = 10;
+static const uint32_t FULL_FRAME_US = 960 * 960 * FLUSH_NS_PER_PX / 1000;
+
+// Open the cover app and go back: the longest loop pass
+static uint32_t transitions(host::HostDial &dial) {
+  uint32_t longest_us = 0;
+  for (int step = 0; step < 2; step++) {
+    dial.display().reset_stats();
+    if (step == 0) {
+      dial.menu.select_app(1);
+      dial.menu.on_button_click();
+    } else {
+      dial.menu.on_long_press();
+      // The button's release after a long press, ignored
+      dial.menu.on_button_click();
+    }
+    longest_us = std::max(longest_us, run_for(300));
+    // The whole display is redrawn either way
+    CHECK_GE(dial.display().get_stats().flushed_px, (uint64_t) 960 * 960);
+  }
+  return longest_us;
+}
+
+int main() {
+  host::set_manual_clock(true);
+  host::HostDial dial(960, 960);
+  dial.display().set_flush_ns_per_px(FLUSH_NS_PER_PX);
+  dial.setup();
+  App.run_for(500);
+
+  // The first frame is drawn whole and sets the render rate
+  CHECK(dial.menu.get_boot_timeline().first_frame_us > 0);
+  CHECK(dial.menu.get_render_stats().px_per_ms > 0);
+
+  // lv_refr_now() runs LVGL's refresh directly on the timer the pacer wrapped
+  lv_obj_invalidate(lv_disp_get_scr_act(dial.lvgl.get_disp()));
+  dial.display().reset_stats();
+  lv_refr_now(dial.lvgl.get_disp());
+  CHECK_GE(dial.display().get_stats().flushed_px, (uint64_t) 960 * 960);
+
+  // Without a budget a page change is one frame, held in one loop pass
+  dial.menu.set_render_budget(0);
+  uint32_t sliced = dial.menu.get_render_stats().sliced;
+  uint32_t unpaced_us = transitions(dial);
+  CHECK_EQ(dial.menu.get_render_stats().sliced, sliced);
+
+  // With a quarter frame as the budget, the frame is spread over several passes, none longer
+  const uint32_t budget_us = FULL_FRAME_US / 4;
+  dial.menu.set_render_budget(budget_us);
+  uint32_t paced_us = transitions(dial);
+  CHECK_GE(dial.menu.get_render_stats().sliced, sliced + 2 * 3);
+  printf("Longest loop pass during page changes: %u us unpaced, %u us paced (budget %u us)\n",
+         (unsigned) unpaced_us, (unsigned) paced_us, (unsigned) budget_us);
+  CHECK_GE(unpaced_us, FULL_FRAME_US * 9 / 10);
+  CHECK_LE(paced_us, budget_us);
+
+  return host_test::result();
+}
@@ -0,0 +1,145 @@
+/**
+ * @file test_render_task.cpp
+ * @brief SpscQueue and RenderTask across two threads
+ *
+ *   test_render_task [--cover]
+ *
+ * Meant to run under ThreadSanitizer as well (-DDIAL_MENU_HOST_TSAN=ON):
+ * every item crosses the queue in order, and with a render task too slow
+ * for the main loop no command is lost, the poster waits instead.
+ *
+ * With --cover, a dial with its render task: a cover command sent from the
+ * main loop goes to the cover and mode the user dialled it for, even when the
+ * render task has moved on by then.
+ */
+
+#include "../dial_fixture.h"
+#include "host_test.h"
+#include "esphome/components/dial_menu/render_task.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+using namespace esphome;
+using namespace esphome::dial_menu;
+
+static const uint32_t ITEMS = 200000;
+static const uint32_t COMMANDS = 5000;
+
+static void queue_order() {
+  static SpscQueue<uint32_t, 16> queue;
+  std::thread producer([]() {
+    for (uint32_t i = 0; i < ITEMS; i++) {
+      while (!queue.push(i)) std::this_thread::yield();
+    }
+  });
+  uint32_t expected = 0, item;
+  bool in_order = true;
+  while (expected < ITEMS) {
+    if (!queue.pop(&item)) {
+      std::this_thread::yield();
+      continue;
+    }
+    in_order &= item == expected;
+    expected++;
+  }
+  producer.join();
+  CHECK(in_order);
+  CHECK(queue.empty());
+}
+
+// Both sides' counters, each written by one side only
+struct Sides {
+  RenderTask task;
+  uint32_t ui_runs{0};     // Render task
+  bool ui_in_task{true};   // Render task
+  uint32_t main_runs{0};   // Main thread
+  bool main_in_task{false};
+  std::atomic<uint32_t> passes{0};
+  uint32_t pass_delay_ms{0};
+};
+
+static uint32_t pass(void *ctx) {
+  auto *sides = static_cast<Sides *>(ctx);
+  sides->passes++;
+  if (sides->pass_delay_ms > 0) std::this_thread::sleep_for(std::chrono::milliseconds(sides->pass_delay_ms));
+  return 5;
+}
+
+// Each command posted to the render task posts one back to the main loop
+static void round_trip(uint32_t pass_delay_ms) {
+  Sides sides;
+  sides.pass_delay_ms = pass_delay_ms;
+  CHECK(sides.task.start(pass, &sides, 0));
+  for (uint32_t i = 0; i < COMMANDS; i++) {
+    sides.task.run_ui({[](void *ctx, int32_t, float) {
+      auto *sides = static_cast<Sides *>(ctx);
+      sides->ui_runs++;
+      sides->ui_in_task &= sides->task.in_task();
+      sides->task.run_main({[](void *ctx, int32_t, float) {
+        auto *sides = static_cast<Sides *>(ctx);
+        sides->main_runs++;
+        sides->main_in_task |= sides->task.in_task();
+      }, sides});
+    }, &sides});
+  }
+  // Posted to the queue, so it runs after all of the above
+  std::atomic<bool> done{false};
+  sides.task.run_ui({[](void *ctx, int32_t, float) { static_cast<std::atomic<bool> *>(ctx)->store(true); }, &done});
+  while (!done.load()) {
+    sides.task.drain_main();
+    std::this_thread::yield();
+  }
+  sides.task.stop();
+
+  CHECK_EQ(sides.ui_runs, COMMANDS);
+  CHECK_EQ(sides.main_runs, COMMANDS);
+  CHECK(sides.ui_in_task);
+  CHECK(!sides.main_in_task);
+  const RenderTaskStats &stats = sides.task.get_stats();
+  CHECK_EQ(stats.to_render, COMMANDS + 1);
+  CHECK_EQ(stats.to_main, COMMANDS);
+  // A slow render task fills the queue: the main thread waited rather than dropped
+  if (pass_delay_ms > 0) CHECK(stats.waits_render > 0);
+}
+
+// Position dialled, then tilt mode: the position is sent as a position
+static void cover_mode_switch() {
+  host::HostDial dial(240, 240, true);
+  dial.setup();
+  App.run_for(500);
+  dial.answer_subscriptions();
+  dial.api.inject_state("cover.living_room", "current_tilt_position", "50");
+  dial.menu.select_app(1);
+  dial.menu.on_button_click();
+  App.run_for(300);
+  dial.api.clear_sent_actions();
+
+  // All on the render task, in one command: the main loop sends after the switch to tilt
+  dial.menu.get_render_task()->run_ui({[](void *ctx, int32_t, float) {
+    auto &covers = static_cast<host::HostDial *>(ctx)->covers;
+    covers.next_mode();
+    covers.on_encoder_rotate(-4);
+    covers.next_mode();
+  }, &dial});
+  App.run_for(300);
+
+  const auto &actions = dial.api.get_sent_actions();
+  if (CHECK_EQ(actions.size(), (size_t) 1)) {
+    CHECK_EQ(actions[0].service, std::string("cover.set_cover_position"));
+    CHECK_EQ(actions[0].get("entity_id"), std::string("cover.living_room"));
+    CHECK_EQ(actions[0].get("position"), std::string("80"));
+  }
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && strcmp(argv[1], "--cover") == 0) {
+    cover_mode_switch();
+    return host_test::result();
+  }
+  queue_order();
+  round_trip(0);
+  round_trip(2);
+  return host_test::result();
+}
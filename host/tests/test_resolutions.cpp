@@ -0,0 +1,84 @@
+/**
+ * @file test_resolutions.cpp
+ * @brief The dial drawn on a round panel of the given size
+ *
+ *   test_resolutions <240|360|466>
+ *
+ * The diameter follows the display as codegen sets it: the launcher ring and
+ * every app page are scaled to it, drawn whole and kept on the panel.
+ */
+
+#include "../dial_fixture.h"
+#include "host_test.h"
+#include <cmath>
+#include <cstdlib>
+
+using namespace esphome;
+
+// Objects of obj's tree, obj included, that are visible but reach outside the display
+static int outside(lv_obj_t *obj, lv_coord_t size) {
+  if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return 0;
+  lv_area_t coords;
+  lv_obj_get_coords(obj, &coords);
+  int count = coords.x1 < 0 || coords.y1 < 0 || coords.x2 >= size || coords.y2 >= size;
+  for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+    count += outside(lv_obj_get_child(obj, i), size);
+  }
+  return count;
+}
+
+// The page on screen is drawn whole and fits the display
+static void check_page(host::HostDial &dial, lv_coord_t size) {
+  lv_obj_t *screen = lv_disp_get_scr_act(dial.lvgl.get_disp());
+  lv_obj_update_layout(screen);
+  CHECK_EQ(outside(screen, size), 0);
+  CHECK_GE(dial.display().get_stats().flushed_px, (uint64_t) size * size);
+}
+
+int main(int argc, char **argv) {
+  lv_coord_t size = argc > 1 ? atoi(argv[1]) : 240;
+  host::set_manual_clock(true);
+  host::HostDial dial(size, size);
+  dial.menu.set_idle_timeout(0);
+  dial.setup();
+  App.run_for(1000);
+  check_page(dial, size);
+  dial.answer_subscriptions();
+  App.run_for(200);
+
+  // The ring and its buttons at the scaled size, the focused one larger
+  int radius = host::HostDial::scale(85, size);
+  dial_menu::DialApp *apps[] = {&dial.switches, &dial.covers, &dial.climate};
+  for (int i = 0; i < 3; i++) {
+    lv_obj_t *button = apps[i]->get_lvgl_obj();
+    lv_area_t coords;
+    lv_obj_get_coords(button, &coords);
+    int width = lv_area_get_width(&coords);
+    CHECK_EQ(width, host::HostDial::scale(i == dial.menu.get_selected_index() ? 58 : 50, size));
+    double dx = (coords.x1 + coords.x2) / 2.0 - (size - 1) / 2.0;
+    double dy = (coords.y1 + coords.y2) / 2.0 - (size - 1) / 2.0;
+    CHECK_LE(std::abs(std::sqrt(dx * dx + dy * dy) - radius), 2.0);
+  }
+
+  // Each app page, then back to the launcher
+  for (int i = 0; i < 3; i++) {
+    lv_obj_t *launcher = lv_disp_get_scr_act(dial.lvgl.get_disp());
+    dial.display().reset_stats();
+    dial.menu.select_app(i);
+    dial.menu.on_button_click();
+    App.run_for(300);
+    CHECK(dial.menu.get_selected_app() == apps[i]);
+    CHECK(lv_disp_get_scr_act(dial.lvgl.get_disp()) != launcher);
+    check_page(dial, size);
+
+    dial.display().reset_stats();
+    dial.menu.on_long_press();
+    // The button's release after a long press, ignored
+    dial.menu.on_button_click();
+    App.run_for(300);
+    CHECK(lv_disp_get_scr_act(dial.lvgl.get_disp()) == launcher);
+    check_page(dial, size);
+  }
+
+  return host_test::result();
+}
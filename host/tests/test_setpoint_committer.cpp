@@ -0,0 +1,129 @@
+/**
+ * @file test_setpoint_committer.cpp
+ * @brief The committer's debounce, deadline and rate limit on the manual clock
+ *
+ * The scheduler runs at every millisecond of the manual clock, so each commit
+ * is checked against the exact time the policies make it due.
+ */
+
+#include "host_test.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/components/dial_menu/setpoint_committer.h"
+#include <vector>
+
+using namespace esphome;
+using dial_menu::SetpointCommitter;
+
+struct Commit {
+  uint32_t time;
+  float value;
+};
+
+// A committer on the shared owner, recording what it sends
+struct Recorder {
+  explicit Recorder(Component *owner) {
+    this->committer.set_owner(owner);
+  }
+  std::vector<Commit> commits;
+  SetpointCommitter committer{[this](float value) { this->commits.push_back(Commit{millis(), value}); }};
+};
+
+// Turn the dial every `step_ms` for `ms`, one more unit each time; returns the time of the last step
+static uint32_t turn(Recorder &recorder, uint32_t ms, uint32_t step_ms, float *value) {
+  uint32_t start = millis(), last = start;
+  while (millis() - start < ms) {
+    last = millis();
+    recorder.committer.update(*value += 1.0f);
+    App.run_for(step_ms);
+  }
+  return last;
+}
+
+// The value is sent once the dial has rested for the debounce
+static void debounce(Component *owner) {
+  Recorder recorder(owner);
+  recorder.committer.set_debounce(500);
+  float value = 0;
+  uint32_t last = turn(recorder, 300, 100, &value);
+  CHECK(recorder.commits.empty());
+  App.run_for(1000);
+  if (CHECK_EQ(recorder.commits.size(), (size_t) 1)) {
+    CHECK_EQ(recorder.commits[0].time - last, 500u);
+    CHECK_EQ(recorder.commits[0].value, value);
+  }
+  CHECK(!recorder.committer.has_pending());
+}
+
+// A dial that keeps turning still sends, max_latency after the first change since the last commit
+static void deadline(Component *owner) {
+  Recorder recorder(owner);
+  recorder.committer.set_debounce(500);
+  recorder.committer.set_max_latency(2000);
+  float value = 0;
+  uint32_t start = millis();
+  turn(recorder, 4500, 100, &value);
+  if (CHECK_EQ(recorder.commits.size(), (size_t) 2)) {
+    CHECK_EQ(recorder.commits[0].time - start, 2000u);
+    // The next change after a commit starts the next deadline (100 ms steps)
+    CHECK_LE(recorder.commits[1].time - recorder.commits[0].time, 2100u);
+    CHECK_GE(recorder.commits[1].time - recorder.commits[0].time, 2000u);
+  }
+  // Resting: the last value follows after the debounce
+  App.run_for(1000);
+  if (CHECK_EQ(recorder.commits.size(), (size_t) 3)) CHECK_EQ(recorder.commits[2].value, value);
+}
+
+// Two commits are never closer than min_interval
+static void min_interval(Component *owner) {
+  Recorder recorder(owner);
+  recorder.committer.set_debounce(100);
+  recorder.committer.set_max_latency(0);
+  recorder.committer.set_min_interval(1000);
+  float value = 0;
+  recorder.committer.update(++value);
+  App.run_for(200);
+  recorder.committer.update(++value);
+  App.run_for(1500);
+  if (CHECK_EQ(recorder.commits.size(), (size_t) 2)) {
+    CHECK_EQ(recorder.commits[1].time - recorder.commits[0].time, 1000u);
+    CHECK_EQ(recorder.commits[1].value, 2.0f);
+  }
+}
+
+// Committers sharing an owner keep their own timeouts: cancelling one leaves the other armed
+static void shared_owner(Component *owner) {
+  Recorder a(owner), b(owner);
+  a.committer.set_debounce(300);
+  b.committer.set_debounce(300);
+  a.committer.update(1.0f);
+  b.committer.update(2.0f);
+  App.run_for(100);
+  a.committer.cancel();
+  App.run_for(500);
+  CHECK(a.commits.empty());
+  if (CHECK_EQ(b.commits.size(), (size_t) 1)) CHECK_EQ(b.commits[0].value, 2.0f);
+
+  // flush() sends at once, the armed timeout then finds nothing pending
+  uint32_t now = millis();
+  a.committer.update(3.0f);
+  a.committer.flush();
+  App.run_for(500);
+  if (CHECK_EQ(a.commits.size(), (size_t) 1)) CHECK_EQ(a.commits[0].time, now);
+}
+
+int main() {
+  host::set_manual_clock(true);
+  Component owner;
+  debounce(&owner);
+  deadline(&owner);
+  min_interval(&owner);
+  shared_owner(&owner);
+
+  // Across the wrap of millis(): durations are compared, not times
+  host::advance_ms(UINT32_MAX - millis() - 1000);
+  deadline(&owner);
+  debounce(&owner);
+
+  return host_test::result();
+}
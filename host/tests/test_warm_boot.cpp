@@ -0,0 +1,124 @@
+/**
+ * @file test_warm_boot.cpp
+ * @brief Mirrors restored before the network and the dial
+ *
+ * A first boot saves each mirror's state. On the second the API is not
+ * connected yet: a component set up at the dial menu's priority must find
+ * every mirror already restored and stale, and once Home Assistant connects
+ * the subscriptions made at setup bring the live values.
+ */
+
+#include "host_test.h"
+#include "esphome/components/api/api_server.h"
+#include "esphome/components/homeassistant_addon/climate/homeassistant_climate.h"
+#include "esphome/components/homeassistant_addon/cover/homeassistant_cover.h"
+#include "esphome/components/homeassistant_addon/homeassistant_light.h"
+#include "esphome/components/homeassistant_addon/homeassistant_media_player.h"
+#include "esphome/components/homeassistant_addon/homeassistant_number.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include <functional>
+#include <string>
+
+using namespace esphome;
+
+static api::APIServer api_server;
+
+// One of each mirror, as configured in YAML
+struct Mirrors {
+  Mirrors() {
+    this->cover.set_entity_id("cover.hall");
+    this->climate.set_entity_id("climate.hall");
+    this->player.set_entity_id("media_player.hall");
+    this->light.set_entity_id("light.hall");
+    this->number.set_entity_id("input_number.hall");
+    this->cover.set_snapshot_interval(1000);
+    this->climate.set_snapshot_interval(1000);
+    this->player.set_snapshot_interval(1000);
+    this->light.set_snapshot_interval(1000);
+    this->number.set_snapshot_interval(1000);
+  }
+  void register_in(Application &app) {
+    for (Component *component : {(Component *) &this->cover, (Component *) &this->climate,
+                                 (Component *) &this->player, (Component *) &this->light,
+                                 (Component *) &this->number}) {
+      app.register_component(component);
+    }
+  }
+  homeassistant_addon::HomeassistantCover cover;
+  homeassistant_addon::HomeassistantClimate climate;
+  homeassistant_addon::HomeassistantMediaPlayer player;
+  homeassistant_addon::HomeassistantLight light;
+  homeassistant_addon::HomeassistantNumber number;
+};
+
+// Stands for the dial menu: set up at its priority, looks at the mirrors it would draw
+class DialProbe : public Component {
+ public:
+  float get_setup_priority() const override { return setup_priority::PROCESSOR; }
+  void setup() override { this->on_setup(); }
+  std::function<void()> on_setup;
+};
+
+static void hall_states(const char *position, const char *volume, const char *value) {
+  api_server.inject_state("cover.hall", "", "open");
+  api_server.inject_state("cover.hall", "current_position", position);
+  api_server.inject_state("climate.hall", "", "heat");
+  api_server.inject_state("climate.hall", "temperature", "21.5");
+  api_server.inject_state("media_player.hall", "", "paused");
+  api_server.inject_state("media_player.hall", "volume_level", volume);
+  api_server.inject_state("light.hall", "", "on");
+  api_server.inject_state("light.hall", "brightness", "51");
+  api_server.inject_state("input_number.hall", "", value);
+}
+
+int main() {
+  host::set_manual_clock(true);
+  App.register_component(&api_server);
+
+  // First boot: Home Assistant answers, each snapshot is written after its interval
+  Mirrors first;
+  first.register_in(App);
+  App.setup();
+  hall_states("40", "0.3", "7");
+  App.run_for(1500);
+
+  // Second boot, still offline
+  api_server.set_connected(false);
+  Application boot;
+  Mirrors second;
+  DialProbe dial;
+  bool checked = false;
+  dial.on_setup = [&]() {
+    checked = true;
+    CHECK(!api_server.is_connected());
+    CHECK(second.cover.is_stale());
+    CHECK_EQ(second.cover.position, 0.4f);
+    CHECK(second.climate.is_stale());
+    CHECK_EQ(second.climate.target_temperature, 21.5f);
+    CHECK(second.player.is_stale());
+    CHECK_EQ(second.player.get_volume(), 0.3f);
+    CHECK(second.light.is_stale());
+    CHECK(second.light.is_on());
+    CHECK_EQ(second.light.get_brightness(), 0.2f);
+    CHECK(second.number.is_stale());
+    CHECK_EQ(second.number.get_value(), 7.0f);
+  };
+  boot.register_component(&dial);
+  second.register_in(boot);
+  boot.setup();
+  CHECK(checked);
+
+  // Connected: the subscriptions made at setup deliver, the values are live
+  api_server.set_connected(true);
+  hall_states("60", "0.5", "8");
+  CHECK(!second.cover.is_stale());
+  CHECK_EQ(second.cover.position, 0.6f);
+  CHECK(!second.climate.is_stale());
+  CHECK(!second.player.is_stale());
+  CHECK_EQ(second.player.get_volume(), 0.5f);
+  CHECK(!second.light.is_stale());
+  CHECK(!second.number.is_stale());
+  CHECK_EQ(second.number.get_value(), 8.0f);
+  return host_test::result();
+}